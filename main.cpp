@@ -1,6 +1,8 @@
 // Project includes
+#include "src/CrossPlatform.h"
 #include "src/Exception.h"
 #include "src/Game/Game.h"
+#include "src/Game/StartupProfiler.h"
 #include "src/Logger.h"
 #include "src/Settings.h"
 #include "src/State/Start.h"
@@ -10,6 +12,7 @@
 
 // stdlib
 #include <memory>
+#include <string>
 
 using namespace Falltergeist;
 
@@ -22,7 +25,26 @@ int main(int argc, char* argv[])
         auto game = Game::Game::getInstance(logger);
         auto uiResourceManager = std::make_shared<UI::ResourceManager>();
         game->setUIResourceManager(uiResourceManager);
+        Game::StartupProfiler::begin("settings");
         game->init(std::unique_ptr<Settings>(new Settings()));
+        for (int i = 1; i < argc; i++)
+        {
+            // --frame-stats[=filename], --startup-profile
+            std::string argument = argv[i];
+            if (argument == "--frame-stats")
+            {
+                game->enableFrameStats(CrossPlatform::getConfigPath() + "/frame_stats.csv");
+            }
+            else if (argument.compare(0, 14, "--frame-stats=") == 0)
+            {
+                game->enableFrameStats(argument.substr(14));
+            }
+            else if (argument == "--startup-profile")
+            {
+                Game::StartupProfiler::setEnabled(true);
+            }
+        }
+        Game::StartupProfiler::begin("first state");
         game->setState(new State::Start(uiResourceManager, logger));
         game->run();
         game->shutdown();
@@ -31,6 +53,7 @@ int main(int argc, char* argv[])
     catch(const Exception &e)
     {
         logger->critical() << e.what() << std::endl;
+        Logger::flush();
 
 #if defined(_WIN32) || defined(WIN32)
         system("PAUSE");
@@ -4,6 +4,7 @@
 #include "../Exception.h"
 #include "../Format/Acm/File.h"
 #include "../Game/Game.h"
+#include "../Logger.h"
 #include "../ResourceManager.h"
 #include "../Settings.h"
 #include "../UI/MvePlayer.h"
@@ -107,7 +108,8 @@ namespace Falltergeist
             _loop = loop;
             musicCallback = std::bind(&Mixer::_musicCallback, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
             acm->rewind();
-            Mix_HookMusic(myMusicPlayer, (void *)acm);
+            _playing = acm;
+            Mix_HookMusic(myMusicPlayer, (void *)acm.get());
         }
 
         void Mixer::_speechCallback(void *udata, uint8_t *stream, uint32_t len)
@@ -142,7 +144,8 @@ namespace Falltergeist
             }
             musicCallback = std::bind(&Mixer::_speechCallback, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
             acm->rewind();
-            Mix_HookMusic(myMusicPlayer, (void *)acm);
+            _playing = acm;
+            Mix_HookMusic(myMusicPlayer, (void *)acm.get());
         }
 
         void Mixer::_movieCallback(void *udata, uint8_t *stream, uint32_t len)
@@ -150,7 +153,7 @@ namespace Falltergeist
             auto pmve = (UI::MvePlayer*)(udata);
             if (pmve->samplesLeft() <= 0)
             {
-                logger->debug() << "[AUDIO] buffer underrun?" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(logger) << "[AUDIO] buffer underrun?" << std::endl;
                 Mix_HookMusic(NULL, NULL);
                 return;
             }
@@ -170,7 +173,7 @@ namespace Falltergeist
             if (!acm) {
                 return;
             }
-            logger->debug() << "[Mixer] playing: " << acm->filename() << std::endl;
+            FALLTERGEIST_LOG_DEBUG(logger) << "[Mixer] playing: " << acm->filename() << std::endl;
             Mix_Chunk *chunk = NULL;
 
             auto it = _sfx.find(acm->filename());
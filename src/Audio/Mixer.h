@@ -14,6 +14,13 @@
 
 namespace Falltergeist
 {
+    namespace Format
+    {
+        namespace Acm
+        {
+            class File;
+        }
+    }
     namespace UI
     {
         class MvePlayer;
@@ -56,6 +63,8 @@ namespace Falltergeist
                 double _musicVolume = 1.0;
                 SDL_AudioFormat _format;
                 std::string _lastMusic = "";
+                // music or speech being played, kept alive in the resource cache while hooked
+                std::shared_ptr<Format::Acm::File> _playing;
                 std::shared_ptr<ILogger> logger;
         };
     }
@@ -0,0 +1,82 @@
+#pragma once
+
+// Project includes
+#include "../Exception.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Base
+    {
+        // Reads values written by BinaryWriter from a memory block without copying it.
+        // Throws Exception when the data ends too early.
+        class BinaryReader
+        {
+            public:
+                BinaryReader(std::string_view data) : _data(data)
+                {
+                }
+
+                template<typename T>
+                T read()
+                {
+                    T value;
+                    std::memcpy(&value, _take(sizeof(T)), sizeof(T));
+                    return value;
+                }
+
+                template<typename T>
+                void readArray(std::vector<T>& values)
+                {
+                    auto size = read<uint32_t>();
+                    auto bytes = _take(size * sizeof(T));
+                    values.resize(size);
+                    std::memcpy(values.data(), bytes, size * sizeof(T));
+                }
+
+                std::string readString()
+                {
+                    auto size = read<uint32_t>();
+                    return std::string(_take(size), size);
+                }
+
+                // Returns next size bytes and skips them
+                std::string_view readBytes(size_t size)
+                {
+                    return std::string_view(_take(size), size);
+                }
+
+                size_t position() const
+                {
+                    return _position;
+                }
+
+                bool atEnd() const
+                {
+                    return _position == _data.size();
+                }
+
+            private:
+                std::string_view _data;
+                size_t _position = 0;
+
+                const char* _take(size_t size)
+                {
+                    if (size > _data.size() - _position) {
+                        throw Exception("BinaryReader - unexpected end of data");
+                    }
+                    auto pointer = _data.data() + _position;
+                    _position += size;
+                    return pointer;
+                }
+        };
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Base
+    {
+        // Appends plain values to a growing byte buffer, in host byte order.
+        // Used for caches and snapshots which are read back by BinaryReader on the same platform.
+        class BinaryWriter
+        {
+            public:
+                template<typename T>
+                void write(T value)
+                {
+                    static_assert(std::is_trivially_copyable<T>::value, "Only plain values are written");
+                    _data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+                }
+
+                template<typename T>
+                void writeArray(const std::vector<T>& values)
+                {
+                    static_assert(std::is_trivially_copyable<T>::value, "Only plain values are written");
+                    write<uint32_t>(static_cast<uint32_t>(values.size()));
+                    _data.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+                }
+
+                void writeString(const std::string& value)
+                {
+                    write<uint32_t>(static_cast<uint32_t>(value.size()));
+                    _data.append(value);
+                }
+
+                // Overwrites already written value at given offset
+                template<typename T>
+                void writeAt(size_t offset, T value)
+                {
+                    static_assert(std::is_trivially_copyable<T>::value, "Only plain values are written");
+                    _data.replace(offset, sizeof(T), reinterpret_cast<const char*>(&value), sizeof(T));
+                }
+
+                size_t size() const
+                {
+                    return _data.size();
+                }
+
+                const std::string& data() const
+                {
+                    return _data;
+                }
+
+            private:
+                std::string _data;
+        };
+    }
+}
@@ -6,12 +6,18 @@
 
 // stdlib
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace Falltergeist
 {
     namespace Base
     {
+        /**
+         * Collection of functors sharing a single copy-on-write storage.
+         * Copying a delegate only shares a handle to its functors, so it can be queued without allocations.
+         * Changing a delegate that is shared with some copy detaches it first, copies keep the functors they were made with.
+         */
         template <typename ...ArgT>
         class Delegate
         {
@@ -28,12 +34,17 @@ namespace Falltergeist
 
                 void add(Functor func)
                 {
-                    _functors.emplace_back(std::move(func));
+                    _mutableFunctors().emplace_back(std::move(func));
                 }
 
                 void add(const Delegate<ArgT...>& other)
                 {
-                    for (auto& func : other.functors())
+                    // other may share storage with this delegate
+                    auto functors = other._functors;
+                    if (!functors) {
+                        return;
+                    }
+                    for (auto& func : *functors)
                     {
                         add(func);
                     }
@@ -41,12 +52,17 @@ namespace Falltergeist
 
                 void clear()
                 {
-                    _functors.clear();
+                    _functors.reset();
                 }
 
                 void invoke(ArgT... args)
                 {
-                    for (auto& func : _functors)
+                    // keep storage alive even if some functor changes this delegate
+                    auto functors = _functors;
+                    if (!functors) {
+                        return;
+                    }
+                    for (auto& func : *functors)
                     {
                         func(args...);
                     }
@@ -54,7 +70,8 @@ namespace Falltergeist
 
                 const FunctorCollection& functors() const
                 {
-                    return _functors;
+                    static const FunctorCollection empty;
+                    return _functors ? *_functors : empty;
                 }
 
                 Delegate<ArgT...>& operator =(Functor func)
@@ -89,11 +106,21 @@ namespace Falltergeist
 
                 explicit operator bool () const
                 {
-                    return _functors.size() > 0;
+                    return _functors && !_functors->empty();
                 }
 
             private:
-                FunctorCollection _functors;
+                std::shared_ptr<FunctorCollection> _functors;
+
+                FunctorCollection& _mutableFunctors()
+                {
+                    if (!_functors) {
+                        _functors = std::make_shared<FunctorCollection>();
+                    } else if (_functors.use_count() > 1) {
+                        _functors = std::make_shared<FunctorCollection>(*_functors);
+                    }
+                    return *_functors;
+                }
         };
     }
 }
@@ -0,0 +1,51 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <memory>
+#include <unordered_map>
+
+namespace Falltergeist
+{
+    namespace Base
+    {
+        // Hands out one shared instance per key for as long as somebody holds it.
+        // Only weak pointers are kept, so an instance is destroyed together with its last user
+        // and built again by the factory on the next request.
+        template <typename Key, typename T>
+        class SharedCache
+        {
+            public:
+                template <typename Factory>
+                std::shared_ptr<T> get(const Key& key, Factory&& factory)
+                {
+                    auto& cached = _instances[key];
+                    if (auto instance = cached.lock()) {
+                        return instance;
+                    }
+
+                    std::shared_ptr<T> instance = factory(key);
+                    cached = instance;
+                    return instance;
+                }
+
+                // Number of keys which currently have a live instance
+                size_t alive() const
+                {
+                    size_t result = 0;
+                    for (auto& it : _instances) {
+                        if (!it.second.expired()) {
+                            ++result;
+                        }
+                    }
+                    return result;
+                }
+
+            private:
+                std::unordered_map<Key, std::weak_ptr<T>> _instances;
+        };
+    }
+}
@@ -1,62 +1,103 @@
 // Project includes
 #include "../Event/Dispatcher.h"
-#include "../Event/Keyboard.h"
-#include "../Event/Mouse.h"
-#include "../Event/State.h"
 
 // Third-party includes
 
 // stdlib
 #include <type_traits>
-#include <memory>
 #include <utility>
 
 namespace Falltergeist
 {
     namespace Event
     {
+        Dispatcher::Dispatcher()
+        {
+        }
 
-        Dispatcher::AbstractTask::AbstractTask(EventTarget* target) : target(target) {}
+        Dispatcher::~Dispatcher()
+        {
+        }
 
         template <typename T>
-        Dispatcher::Task<T>::Task(EventTarget* target, std::unique_ptr<T> event, Base::Delegate<T*> handler)
-            : AbstractTask(target), event(std::move(event)), handler(handler)
+        Dispatcher::PooledEvent<T>::PooledEvent(const T& event, const Base::Delegate<T*>& handler)
+            : event(event), handler(handler)
         {
             static_assert(std::is_base_of<Event, T>::value, "T should be derived from Event::Event.");
         }
 
         template <typename T>
-        void Dispatcher::Task<T>::perform()
+        Dispatcher::PooledEvent<T>* Dispatcher::Pool<T>::acquire(const T& event, const Base::Delegate<T*>& handler)
+        {
+            if (_free.empty()) {
+                _events.emplace_back(std::make_unique<PooledEvent<T>>(event, handler));
+                return _events.back().get();
+            }
+            auto pooledEvent = _free.back();
+            _free.pop_back();
+            pooledEvent->event = event;
+            pooledEvent->handler = handler;
+            return pooledEvent;
+        }
+
+        template <typename T>
+        void Dispatcher::Pool<T>::release(PooledEvent<T>* pooledEvent)
+        {
+            // drop functors reference, so the delegate owner may change them without copying
+            pooledEvent->handler = nullptr;
+            _free.push_back(pooledEvent);
+        }
+
+        template <typename T>
+        Dispatcher::Pool<T>& Dispatcher::_pool()
+        {
+            return std::get<Pool<T>>(_pools);
+        }
+
+        template <typename T>
+        void Dispatcher::_perform(Task& task)
         {
-            for (auto& func : handler.functors())
+            auto pooledEvent = static_cast<PooledEvent<T>*>(task.pooledEvent);
+            for (auto& func : pooledEvent->handler.functors())
             {
-                func(event.get());
+                func(&pooledEvent->event);
                 // handler may call stopPropagation() - to stop other handlers from executing
                 // also, target may be deleted by any handler, so we should check that on every iteration
-                if (event->isHandled() || target == nullptr) {
+                if (pooledEvent->event.isHandled() || task.target == nullptr) {
                     break;
                 }
             }
         }
 
+        template <typename T>
+        void Dispatcher::_release(Dispatcher& dispatcher, void* pooledEvent)
+        {
+            dispatcher._pool<T>().release(static_cast<PooledEvent<T>*>(pooledEvent));
+        }
+
         template<typename T>
-        void Dispatcher::scheduleEvent(EventTarget* target, std::unique_ptr<T> eventArg, Base::Delegate<T*> handlerArg)
+        void Dispatcher::scheduleEvent(EventTarget* target, const T& eventArg, const Base::Delegate<T*>& handlerArg)
         {
-            _scheduledTasks.emplace_back(std::make_unique<Task<T>>(target, std::move(eventArg), std::move(handlerArg)));
+            _scheduledTasks.push_back({target, _pool<T>().acquire(eventArg, handlerArg), &_perform<T>, &_release<T>});
         }
 
         void Dispatcher::processScheduledEvents()
         {
             while (!_scheduledTasks.empty())
             {
-                swap(_tasksInProcess, _scheduledTasks);
-                for (auto& task : _tasksInProcess)
+                std::swap(_tasksInProcess, _scheduledTasks);
+                // handlers may schedule new tasks, so tasks are accessed by index
+                for (size_t i = 0; i < _tasksInProcess.size(); i++)
                 {
                     // after previous tasks this target might already be "dead"
-                    if (task->target == nullptr) {
+                    if (_tasksInProcess[i].target == nullptr) {
                         continue;
                     }
-                    task->perform();
+                    _tasksInProcess[i].perform(_tasksInProcess[i]);
+                }
+                for (auto& task : _tasksInProcess)
+                {
+                    task.release(*this, task.pooledEvent);
                 }
                 _tasksInProcess.clear();
             }
@@ -64,23 +105,27 @@ namespace Falltergeist
 
         void Dispatcher::blockEventHandlers(EventTarget* eventTarget)
         {
-            _scheduledTasks.remove_if([eventTarget](std::unique_ptr<Dispatcher::AbstractTask>& task)
+            // blocked tasks are skipped and returned to the pool on the next processing
+            for (auto& task : _scheduledTasks)
             {
-                return (task->target == eventTarget);
-            });
+                if (task.target == eventTarget)
+                {
+                    task.target = nullptr;
+                }
+            }
             for (auto& task : _tasksInProcess)
             {
-                if (task->target == eventTarget)
+                if (task.target == eventTarget)
                 {
-                    task->target = nullptr;
+                    task.target = nullptr;
                 }
             }
         }
 
         // instantiations for all event types..
-        template void Dispatcher::scheduleEvent<Event>(EventTarget*, std::unique_ptr<Event>, Base::Delegate<Event*>);
-        template void Dispatcher::scheduleEvent<Mouse>(EventTarget*, std::unique_ptr<Mouse>, Base::Delegate<Mouse*>);
-        template void Dispatcher::scheduleEvent<Keyboard>(EventTarget*, std::unique_ptr<Keyboard>, Base::Delegate<Keyboard*>);
-        template void Dispatcher::scheduleEvent<State>(EventTarget*, std::unique_ptr<State>, Base::Delegate<State*>);
+        template void Dispatcher::scheduleEvent<Event>(EventTarget*, const Event&, const Base::Delegate<Event*>&);
+        template void Dispatcher::scheduleEvent<Mouse>(EventTarget*, const Mouse&, const Base::Delegate<Mouse*>&);
+        template void Dispatcher::scheduleEvent<Keyboard>(EventTarget*, const Keyboard&, const Base::Delegate<Keyboard*>&);
+        template void Dispatcher::scheduleEvent<State>(EventTarget*, const State&, const Base::Delegate<State*>&);
     }
 }
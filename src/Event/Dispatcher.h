@@ -1,51 +1,85 @@
+#pragma once
+
 // Project includes
 #include "../Event/Event.h"
 #include "../Event/EventTarget.h"
+#include "../Event/Keyboard.h"
+#include "../Event/Mouse.h"
+#include "../Event/State.h"
 
 // Third-party includes
 
 // stdlib
-#include <list>
 #include <memory>
+#include <tuple>
+#include <vector>
 
 namespace Falltergeist
 {
     namespace Event
     {
+        /**
+         * Queues events for delayed processing.
+         * Event copies and their handlers are kept in per-type pools and tasks are stored contiguously,
+         * so once the pools are warmed up scheduling an event does not allocate.
+         */
         class Dispatcher
         {
             public:
-                Dispatcher() {}
+                Dispatcher();
+                ~Dispatcher();
                 Dispatcher(const Dispatcher&) = delete;
                 void operator=(const Dispatcher&) = delete;
 
                 template<typename T>
-                void scheduleEvent(EventTarget* target, std::unique_ptr<T> eventArg, Base::Delegate<T*> handlerArg);
+                void scheduleEvent(EventTarget* target, const T& eventArg, const Base::Delegate<T*>& handlerArg);
 
                 void processScheduledEvents();
                 void blockEventHandlers(EventTarget* eventTarget);
 
             private:
-                struct AbstractTask
+                template <typename T>
+                struct PooledEvent
                 {
-                    explicit AbstractTask(EventTarget* target);
-                    virtual ~AbstractTask() = default;
-                    virtual void perform() = 0;
+                    PooledEvent(const T& event, const Base::Delegate<T*>& handler);
 
-                    EventTarget* target;
+                    T event;
+                    // shares functors with the emitting delegate, does not copy them
+                    Base::Delegate<T*> handler;
                 };
 
                 template <typename T>
-                struct Task : AbstractTask
+                class Pool
                 {
-                    Task(EventTarget* target, std::unique_ptr<T> event, Base::Delegate<T*> handler);
-                    void perform() override;
+                    public:
+                        PooledEvent<T>* acquire(const T& event, const Base::Delegate<T*>& handler);
+                        void release(PooledEvent<T>* pooledEvent);
 
-                    std::unique_ptr<T> event;
-                    Base::Delegate<T*> handler;
+                    private:
+                        std::vector<std::unique_ptr<PooledEvent<T>>> _events;
+                        std::vector<PooledEvent<T>*> _free;
+                };
+
+                struct Task
+                {
+                    EventTarget* target;
+                    void* pooledEvent;
+                    void (*perform)(Task& task);
+                    void (*release)(Dispatcher& dispatcher, void* pooledEvent);
                 };
 
-                std::list<std::unique_ptr<AbstractTask>> _scheduledTasks, _tasksInProcess;
+                template <typename T>
+                static void _perform(Task& task);
+
+                template <typename T>
+                static void _release(Dispatcher& dispatcher, void* pooledEvent);
+
+                template <typename T>
+                Pool<T>& _pool();
+
+                std::tuple<Pool<Event>, Pool<Mouse>, Pool<Keyboard>, Pool<State>> _pools;
+
+                std::vector<Task> _scheduledTasks, _tasksInProcess;
         };
     }
 }
@@ -25,19 +25,19 @@ namespace Falltergeist
         }
 
         template<typename T>
-        void EventTarget::emitEvent(std::unique_ptr<T> event, const Base::Delegate<T*>& handler)
+        void EventTarget::emitEvent(const T& event, const Base::Delegate<T*>& handler)
         {
             static_assert(std::is_base_of<Event, T>::value, "T should be derived from Event::Event.");
             if (handler)
             {
-                _eventDispatcher->scheduleEvent<T>(this, std::move(event), handler); // handler copy is necessary here
+                _eventDispatcher->scheduleEvent<T>(this, event, handler); // handler shares functors, they are not copied
             }
         }
 
         // this was necessary to decouple EventDispatcher from the rest of the classes
-        template void EventTarget::emitEvent<Event>(std::unique_ptr<Event>, const Base::Delegate<Event*>&);
-        template void EventTarget::emitEvent<Mouse>(std::unique_ptr<Mouse>, const Base::Delegate<Mouse*>&);
-        template void EventTarget::emitEvent<Keyboard>(std::unique_ptr<Keyboard>, const Base::Delegate<Keyboard*>&);
-        template void EventTarget::emitEvent<State>(std::unique_ptr<State>, const Base::Delegate<State*>&);
+        template void EventTarget::emitEvent<Event>(const Event&, const Base::Delegate<Event*>&);
+        template void EventTarget::emitEvent<Mouse>(const Mouse&, const Base::Delegate<Mouse*>&);
+        template void EventTarget::emitEvent<Keyboard>(const Keyboard&, const Base::Delegate<Keyboard*>&);
+        template void EventTarget::emitEvent<State>(const State&, const Base::Delegate<State*>&);
     }
 }
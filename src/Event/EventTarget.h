@@ -23,9 +23,10 @@ namespace Falltergeist
 
                 /**
                  * Emit given event to Event Dispatcher for delayed processing.
+                 * Event is copied into dispatcher's pool, so it can be safely constructed on the stack.
                  */
                 template <typename T>
-                void emitEvent(std::unique_ptr<T> event, const Base::Delegate<T*>& handler);
+                void emitEvent(const T& event, const Base::Delegate<T*>& handler);
 
             private:
                 Dispatcher* _eventDispatcher;
@@ -16,6 +16,7 @@ namespace Falltergeist
 
         Keyboard::Keyboard(const Keyboard& event, const std::string& newName) : Event(newName)
         {
+            _type = event._type;
             _keyCode = event._keyCode;
             _shiftPressed = event._shiftPressed;
             _controlPressed = event._controlPressed;
@@ -26,6 +27,18 @@ namespace Falltergeist
         {
         }
 
+        Keyboard& Keyboard::operator=(const Keyboard& event)
+        {
+            _name = event._name;
+            _handled = false;
+            _type = event._type;
+            _keyCode = event._keyCode;
+            _shiftPressed = event._shiftPressed;
+            _controlPressed = event._controlPressed;
+            _altPressed = event._altPressed;
+            return *this;
+        }
+
         const char* Keyboard::typeToString(Keyboard::Type type)
         {
             switch (type)
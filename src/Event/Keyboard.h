@@ -27,6 +27,11 @@ namespace Falltergeist
                 Keyboard(const Keyboard& event);
                 ~Keyboard() override = default;
 
+                /**
+                 * @brief Copies everything but the handled flag, so the event may be reused for the next OS event.
+                 */
+                Keyboard& operator=(const Keyboard& event);
+
                 /**
                  * @brief Type of an original event from OS.
                  */
@@ -16,6 +16,7 @@ namespace Falltergeist
 
         Mouse::Mouse(const Mouse& event, const std::string& newName) : Event(newName)
         {
+            _type = event._type;
             _button = event._button;
             _position = event._position;
             _shiftPressed = event._shiftPressed;
@@ -31,6 +32,19 @@ namespace Falltergeist
         {
         }
 
+        Mouse& Mouse::operator=(const Mouse& event)
+        {
+            _name = event._name;
+            _handled = false;
+            _type = event._type;
+            _button = event._button;
+            _position = event._position;
+            _shiftPressed = event._shiftPressed;
+            _controlPressed = event._controlPressed;
+            _altPressed = event._altPressed;
+            return *this;
+        }
+
         const char* Mouse::typeToString(Mouse::Type type)
         {
             switch (type)
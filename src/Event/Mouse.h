@@ -39,6 +39,11 @@ namespace Falltergeist
                 Mouse(const Mouse& event);
                 ~Mouse() override;
 
+                /**
+                 * @brief Copies everything but the handled flag, so the event may be reused for the next OS event.
+                 */
+                Mouse& operator=(const Mouse& event);
+
                 /**
                  * @brief Type of an original event from OS.
                  */
@@ -18,7 +18,7 @@ namespace Falltergeist
                 _datFile = datFile;
             }
 
-            std::string Entry::filename() const
+            const std::string& Entry::filename() const
             {
                 return _filename;
             }
@@ -22,7 +22,7 @@ namespace Falltergeist
                 public:
                     Entry(File* datFile);
 
-                    std::string filename() const;
+                    const std::string& filename() const;
                     void setFilename(std::string value);
 
                     uint32_t packedSize() const;
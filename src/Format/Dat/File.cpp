@@ -7,6 +7,8 @@
 // Third-party includes
 
 // stdlib
+#include <algorithm>
+#include <cstring>
 
 namespace Falltergeist
 {
@@ -63,13 +65,61 @@ namespace Falltergeist
                 setPosition(size() - filesTreeSize - 8);
                 *this >> filesTotalNumber;
 
-                //reading files data one by one
+                // the tree is parsed in memory, reading it field by field from the stream costs two seeks per field
+                std::vector<char> tree(filesTreeSize > 4 ? filesTreeSize - 4 : 0);
+                readBytes(tree.data(), static_cast<unsigned>(tree.size()));
+                if (!_stream)
+                {
+                    throw Exception("File::_initialize() - can't read files tree: " + filename());
+                }
+
+                size_t offset = 0;
+                auto read = [&tree, &offset, this](void* destination, size_t numberOfBytes) {
+                    if (offset + numberOfBytes > tree.size())
+                    {
+                        throw Exception("File::_initialize() - files tree is truncated: " + filename());
+                    }
+                    std::memcpy(destination, tree.data() + offset, numberOfBytes);
+                    offset += numberOfBytes;
+                };
+
+                _entries.reserve(filesTotalNumber);
                 for (unsigned int i = 0; i != filesTotalNumber; ++i)
                 {
+                    uint32_t filenameSize = 0;
+                    uint8_t compressed = 0;
+                    uint32_t unpackedSize = 0;
+                    uint32_t packedSize = 0;
+                    uint32_t dataOffset = 0;
+
+                    read(&filenameSize, sizeof(filenameSize));
+                    std::string name(filenameSize, '\0');
+                    read(&name[0], filenameSize);
+                    read(&compressed, sizeof(compressed));
+                    read(&unpackedSize, sizeof(unpackedSize));
+                    read(&packedSize, sizeof(packedSize));
+                    read(&dataOffset, sizeof(dataOffset));
+
                     Entry entry(this);
-                    *this >> entry;
-                    _entries.emplace(entry.filename(), std::move(entry));
+                    entry.setFilename(std::move(name));
+                    entry.setCompressed((bool) compressed);
+                    entry.setUnpackedSize(unpackedSize);
+                    entry.setPackedSize(packedSize);
+                    entry.setDataOffset(dataOffset);
+                    _entries.push_back(std::move(entry));
                 }
+
+                // the first of duplicate entries wins
+                auto less = [](const Entry& a, const Entry& b) {
+                    return a.filename() < b.filename();
+                };
+                std::stable_sort(_entries.begin(), _entries.end(), less);
+                _entries.erase(
+                    std::unique(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) {
+                        return a.filename() == b.filename();
+                    }),
+                    _entries.end()
+                );
             }
 
             File* File::setPosition(unsigned int position)
@@ -108,13 +158,20 @@ namespace Falltergeist
 
             Entry* File::entry(const std::string& filename)
             {
-                auto entryIt = _entries.find(filename);
-                if (entryIt != _entries.end()) {
-                    return &entryIt->second;
+                auto entryIt = std::lower_bound(_entries.begin(), _entries.end(), filename, [](const Entry& entry, const std::string& name) {
+                    return entry.filename() < name;
+                });
+                if (entryIt != _entries.end() && entryIt->filename() == filename) {
+                    return &*entryIt;
                 }
                 return nullptr;
             }
 
+            std::vector<Entry>& File::entries()
+            {
+                return _entries;
+            }
+
             File& File::operator>>(int32_t &value)
             {
                 readBytes(reinterpret_cast<char *>(&value), sizeof(value));
@@ -10,7 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace Falltergeist
 {
@@ -30,6 +30,9 @@ namespace Falltergeist
                     // an pointer to an entry with given name or nullptr if no such entry exists
                     Entry* entry(const std::string& filename);
 
+                    // all entries sorted by filename
+                    std::vector<Entry>& entries();
+
                     File* readBytes(char* destination, unsigned int numberOfBytes);
                     File* skipBytes(unsigned int numberOfBytes);
                     File* setPosition(unsigned int position);
@@ -45,7 +48,7 @@ namespace Falltergeist
                     File& operator>>(Entry &entry);
 
                 protected:
-                    std::unordered_map<std::string, Dat::Entry> _entries;
+                    std::vector<Dat::Entry> _entries;
                     std::ifstream _stream;
                     std::string _filename;
                     void _initialize();
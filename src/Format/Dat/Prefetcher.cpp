@@ -0,0 +1,167 @@
+// Project includes
+#include "../../Format/Dat/Entry.h"
+#include "../../Format/Dat/Prefetcher.h"
+#include "../../Format/Dat/Stream.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <fstream>
+
+namespace Falltergeist
+{
+    namespace Format
+    {
+        namespace Dat
+        {
+            Prefetcher::Prefetcher()
+            {
+                _worker = std::thread([this]() { _run(); });
+            }
+
+            Prefetcher::~Prefetcher()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stopping = true;
+                }
+                _wakeUp.notify_one();
+                _worker.join();
+            }
+
+            unsigned int Prefetcher::startBatch(size_t memoryBudget)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _batches.emplace(++_lastBatch, Batch{memoryBudget, 0});
+                return _lastBatch;
+            }
+
+            bool Prefetcher::request(unsigned int batch, const std::string& filename, Entry* entry, const std::string& datPath)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    auto it = _batches.find(batch);
+                    if (it == _batches.end() || it->second.memoryUsed + entry->unpackedSize() > it->second.memoryBudget) {
+                        return false;
+                    }
+                    it->second.memoryUsed += entry->unpackedSize();
+                    _requests.push_back(Request{batch, filename, entry, datPath});
+                }
+                _wakeUp.notify_one();
+                return true;
+            }
+
+            std::unique_ptr<Stream> Prefetcher::take(const std::string& filename)
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+
+                // reading it right away is cheaper than waiting for the rest of the queue
+                auto request = std::find_if(_requests.begin(), _requests.end(), [&filename](const Request& request) {
+                    return request.filename == filename;
+                });
+                if (request != _requests.end()) {
+                    _release(request->batch, request->entry->unpackedSize());
+                    _requests.erase(request);
+                    return nullptr;
+                }
+
+                _readDone.wait(lock, [this, &filename]() { return _reading != filename; });
+
+                auto result = _results.find(filename);
+                if (result == _results.end()) {
+                    return nullptr;
+                }
+                auto stream = std::move(result->second.stream);
+                _release(result->second.batch, stream->size());
+                _results.erase(result);
+                return stream;
+            }
+
+            bool Prefetcher::ready(const std::string& filename) const
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _results.find(filename) != _results.end();
+            }
+
+            bool Prefetcher::pending(const std::string& filename) const
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_reading == filename) {
+                    return true;
+                }
+                return std::any_of(_requests.begin(), _requests.end(), [&filename](const Request& request) {
+                    return request.filename == filename;
+                });
+            }
+
+            void Prefetcher::cancel(unsigned int batch)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _requests.erase(
+                    std::remove_if(_requests.begin(), _requests.end(), [batch](const Request& request) {
+                        return request.batch == batch;
+                    }),
+                    _requests.end()
+                );
+                for (auto it = _results.begin(); it != _results.end();) {
+                    if (it->second.batch == batch) {
+                        it = _results.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                // a read in progress is thrown away by the worker once the batch is gone
+                _batches.erase(batch);
+            }
+
+            void Prefetcher::_release(unsigned int batch, size_t size)
+            {
+                auto it = _batches.find(batch);
+                if (it != _batches.end()) {
+                    it->second.memoryUsed -= std::min(size, it->second.memoryUsed);
+                }
+            }
+
+            void Prefetcher::_run()
+            {
+                // own handles of DAT files, the shared ones belong to the main thread
+                std::unordered_map<std::string, std::ifstream> datStreams;
+
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (true) {
+                    _wakeUp.wait(lock, [this]() { return _stopping || !_requests.empty(); });
+                    if (_stopping) {
+                        return;
+                    }
+
+                    auto request = std::move(_requests.front());
+                    _requests.pop_front();
+                    _reading = request.filename;
+                    lock.unlock();
+
+                    std::unique_ptr<Stream> stream;
+                    auto& datStream = datStreams[request.datPath];
+                    if (!datStream.is_open()) {
+                        datStream.open(request.datPath, std::ios_base::binary);
+                    }
+                    if (datStream.is_open()) {
+                        datStream.clear();
+                        stream = std::make_unique<Stream>(*request.entry, datStream);
+                    }
+
+                    lock.lock();
+                    _reading.clear();
+                    if (_batches.find(request.batch) != _batches.end()) {
+                        if (stream) {
+                            _results[request.filename] = Result{request.batch, std::move(stream)};
+                        } else {
+                            _release(request.batch, request.entry->unpackedSize());
+                        }
+                    }
+                    _readDone.notify_all();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace Falltergeist
+{
+    namespace Format
+    {
+        namespace Dat
+        {
+            class Entry;
+            class Stream;
+
+            // Reads and unpacks DAT entries on a background thread, so the main thread later gets them without disk access.
+            // Requests are grouped in batches with their own memory budget; a batch is cancelled as a whole.
+            class Prefetcher final
+            {
+                public:
+                    Prefetcher();
+                    ~Prefetcher();
+
+                    unsigned int startBatch(size_t memoryBudget);
+
+                    // Queues reading of the entry, returns false if it doesn't fit into the memory budget of the batch
+                    bool request(unsigned int batch, const std::string& filename, Entry* entry, const std::string& datPath);
+
+                    // Hands over the prefetched stream, waits if it is being read right now.
+                    // Returns nullptr if the file was not requested; a request still in the queue is dropped
+                    std::unique_ptr<Stream> take(const std::string& filename);
+
+                    bool ready(const std::string& filename) const;
+                    bool pending(const std::string& filename) const;
+
+                    // Drops queued requests and not taken streams of the batch
+                    void cancel(unsigned int batch);
+
+                private:
+                    struct Request
+                    {
+                        unsigned int batch;
+                        std::string filename;
+                        Entry* entry;
+                        std::string datPath;
+                    };
+
+                    struct Result
+                    {
+                        unsigned int batch;
+                        std::unique_ptr<Stream> stream;
+                    };
+
+                    struct Batch
+                    {
+                        size_t memoryBudget;
+                        size_t memoryUsed;
+                    };
+
+                    mutable std::mutex _mutex;
+                    std::condition_variable _wakeUp;
+                    std::condition_variable _readDone;
+                    std::deque<Request> _requests;
+                    std::unordered_map<std::string, Result> _results;
+                    std::unordered_map<unsigned int, Batch> _batches;
+                    std::string _reading;
+                    unsigned int _lastBatch = 0;
+                    bool _stopping = false;
+                    std::thread _worker;
+
+                    void _run();
+                    void _release(unsigned int batch, size_t size);
+            };
+        }
+    }
+}
@@ -47,17 +47,32 @@ namespace Falltergeist
 
             Stream::Stream(Entry& datFileEntry)
             {
-                auto size = datFileEntry.unpackedSize();
-                _buffer.resize(size);
-                auto cBuf = _buffer.data();
-
                 auto datFile = datFileEntry.datFile();
                 unsigned int oldPos = datFile->position();
                 datFile->setPosition(datFileEntry.dataOffset());
+                _readEntry(datFileEntry, [datFile](char* destination, unsigned int size) {
+                    datFile->readBytes(destination, size);
+                });
+                datFile->setPosition(oldPos);
+            }
+
+            Stream::Stream(Entry& datFileEntry, std::istream& datStream)
+            {
+                datStream.seekg(datFileEntry.dataOffset(), std::ios::beg);
+                _readEntry(datFileEntry, [&datStream](char* destination, unsigned int size) {
+                    datStream.read(destination, size);
+                });
+            }
+
+            void Stream::_readEntry(Entry& datFileEntry, const std::function<void(char*, unsigned int)>& read)
+            {
+                auto size = datFileEntry.unpackedSize();
+                _buffer.resize(size);
+                auto cBuf = _buffer.data();
 
                 if (datFileEntry.compressed()) {
                     Base::Buffer<char> packedData(datFileEntry.packedSize());
-                    datFile->readBytes(packedData.data(), datFileEntry.packedSize());
+                    read(packedData.data(), datFileEntry.packedSize());
 
                     // unpacking
                     z_stream zStream;
@@ -73,10 +88,9 @@ namespace Falltergeist
                     inflate(&zStream, Z_FINISH);      // zlib function
                     inflateEnd(&zStream);             // zlib function
                 } else {
-                    datFile->readBytes(cBuf, size);
+                    read(cBuf, size);
                 }
 
-                datFile->setPosition(oldPos);
                 setg(cBuf, cBuf, cBuf + size);
             }
 
@@ -177,6 +191,11 @@ namespace Falltergeist
                 return size() - position();
             }
 
+            std::string_view Stream::view() const
+            {
+                return std::string_view(eback(), _buffer.size());
+            }
+
             uint32_t Stream::uint32()
             {
                 uint32_t value = 0;
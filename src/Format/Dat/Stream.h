@@ -8,7 +8,9 @@
 
 // stdlib
 #include <fstream>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <memory>
 
 namespace Falltergeist
@@ -25,6 +27,8 @@ namespace Falltergeist
                 public:
                     Stream(std::ifstream& stream);
                     Stream(Dat::Entry& datFileEntry);
+                    // Reads the entry through given stream of its DAT file instead of the shared one, so it is safe off the main thread
+                    Stream(Dat::Entry& datFileEntry, std::istream& datStream);
 
                     Stream(Stream&& other);
                     Stream(const Stream&) = delete;
@@ -41,6 +45,9 @@ namespace Falltergeist
 
                     size_t bytesRemains();
 
+                    // Read-only view over the whole stream contents, valid while the stream is alive
+                    std::string_view view() const;
+
                     ENDIANNESS endianness();
                     void setEndianness(ENDIANNESS value);
 
@@ -61,6 +68,8 @@ namespace Falltergeist
                 private:
                     Base::Buffer<char> _buffer;
                     ENDIANNESS _endianness = ENDIANNESS::BIG;
+
+                    void _readEntry(Dat::Entry& datFileEntry, const std::function<void(char*, unsigned int)>& read);
             };
         }
     }
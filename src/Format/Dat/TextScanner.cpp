@@ -0,0 +1,126 @@
+// Project includes
+#include "../../Exception.h"
+#include "../../Format/Dat/TextScanner.h"
+
+// Third-party includes
+
+// stdlib
+#include <cctype>
+#include <charconv>
+#include <cstring>
+
+namespace Falltergeist
+{
+    namespace Format
+    {
+        namespace Dat
+        {
+            TextScanner::TextScanner(std::string_view text) : _position(text.data()), _end(text.data() + text.size())
+            {
+            }
+
+            bool TextScanner::atEnd() const
+            {
+                return _position == _end;
+            }
+
+            std::string_view TextScanner::line()
+            {
+                auto result = until('\n');
+                if (!result.empty() && result.back() == '\r')
+                {
+                    result.remove_suffix(1);
+                }
+                return result;
+            }
+
+            std::string_view TextScanner::until(char delimiter)
+            {
+                auto start = _position;
+                auto found = static_cast<const char*>(std::memchr(start, delimiter, _end - start));
+                if (found == nullptr)
+                {
+                    _position = _end;
+                    return std::string_view(start, _end - start);
+                }
+                _position = found + 1;
+                return std::string_view(start, found - start);
+            }
+
+            std::string_view TextScanner::untilAny(std::string_view delimiters)
+            {
+                auto start = _position;
+                std::string_view rest(start, _end - start);
+                auto found = rest.find_first_of(delimiters);
+                if (found == std::string_view::npos)
+                {
+                    found = rest.size();
+                }
+                _position = start + found;
+                return rest.substr(0, found);
+            }
+
+            bool TextScanner::skipPast(char delimiter)
+            {
+                auto found = static_cast<const char*>(std::memchr(_position, delimiter, _end - _position));
+                if (found == nullptr)
+                {
+                    _position = _end;
+                    return false;
+                }
+                _position = found + 1;
+                return true;
+            }
+
+            std::string_view TextScanner::rtrim(std::string_view text)
+            {
+                while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())))
+                {
+                    text.remove_suffix(1);
+                }
+                return text;
+            }
+
+            std::string_view TextScanner::trim(std::string_view text)
+            {
+                while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())))
+                {
+                    text.remove_prefix(1);
+                }
+                return rtrim(text);
+            }
+
+            void TextScanner::appendWithout(std::string& destination, std::string_view text, std::string_view dropped)
+            {
+                destination.reserve(destination.size() + text.size());
+                while (!text.empty())
+                {
+                    auto found = text.find_first_of(dropped);
+                    if (found == std::string_view::npos)
+                    {
+                        destination.append(text.data(), text.size());
+                        return;
+                    }
+                    destination.append(text.data(), found);
+                    text.remove_prefix(found + 1);
+                }
+            }
+
+            int TextScanner::toInt(std::string_view text)
+            {
+                text = trim(text);
+                if (!text.empty() && text.front() == '+')
+                {
+                    text.remove_prefix(1);
+                }
+                int value = 0;
+                auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+                if (result.ec != std::errc())
+                {
+                    throw Exception("TextScanner::toInt() - not a number: " + std::string(text));
+                }
+                return value;
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <string>
+#include <string_view>
+
+namespace Falltergeist
+{
+    namespace Format
+    {
+        namespace Dat
+        {
+            // Forward-only scanner over text resources (MSG, LST, GAM).
+            // Every returned view points into the scanned buffer, nothing is copied.
+            class TextScanner
+            {
+                public:
+                    TextScanner(std::string_view text);
+
+                    bool atEnd() const;
+
+                    // Returns next line without its "\n" or "\r\n" terminator
+                    std::string_view line();
+
+                    // Returns everything up to the next delimiter and consumes the delimiter.
+                    // Returns rest of the text if there is no delimiter.
+                    std::string_view until(char delimiter);
+
+                    // Returns everything up to the next of given delimiters, the delimiter itself is not consumed
+                    std::string_view untilAny(std::string_view delimiters);
+
+                    // Skips everything up to and including the next delimiter. Returns false if there is none.
+                    bool skipPast(char delimiter);
+
+                    static std::string_view rtrim(std::string_view text);
+                    static std::string_view trim(std::string_view text);
+
+                    // Appends text to destination, dropping every occurrence of given characters
+                    static void appendWithout(std::string& destination, std::string_view text, std::string_view dropped);
+
+                    // Parses a decimal integer, ignoring surrounding whitespace and any trailing garbage like std::stoi does
+                    static int toInt(std::string_view text);
+
+                private:
+                    const char* _position;
+                    const char* _end;
+            };
+        }
+    }
+}
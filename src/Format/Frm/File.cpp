@@ -8,6 +8,7 @@
 
 // stdlib
 #include <algorithm>
+#include <thread>
 
 namespace Falltergeist
 {
@@ -124,65 +125,82 @@ namespace Falltergeist
                 // TODO: this looks like a getter, which in fact creates _rgba.
                 // Moreover, the content of _rgba depends on the specific palFile that was provided the first time
                 // This is clearly bad semantics
-                if (!_rgba.empty()) {
-                    return _rgba.data();
-                }
-
-                _rgba.resize(width()*height());
-
-                uint16_t w = width();
-
-                size_t positionY = 0;
-                for (auto& direction : _directions)
-                {
-                    size_t positionX = 0;
-                    for (auto& frame : direction.frames())
-                    {
-                        // TODO: more efficient way to generate texture?
-                        for (uint16_t y = 0; y != frame.height(); ++y)
-                        {
-                            for (uint16_t x = 0; x != frame.width(); ++x)
-                            {
-                                _rgba[((y + positionY)*w) + x + positionX] = *palFile->color(frame.index(x, y));
-                            }
-                        }
-                        positionX += frame.width();
-                    }
-                    positionY += direction.height();
+                if (_rgba.empty()) {
+                    _convert(palFile);
                 }
                 return _rgba.data();
             }
 
             std::vector<bool>& File::mask(Pal::File* palFile)
             {
-                if (!_mask.empty()) {
-                    return _mask;
+                if (_mask.empty()) {
+                    _convert(palFile);
                 }
+                return _mask;
+            }
+
+            size_t File::decodedSize() const
+            {
+                return _rgba.capacity() * sizeof(uint32_t) + _mask.capacity() / 8;
+            }
 
-                uint16_t w = width();
-                uint16_t h = height();
+            void File::_convert(Pal::File* palFile)
+            {
+                size_t w = width();
+                _rgba.assign(w * height(), 0);
 
-                _mask.resize(w*h, true);
+                // every direction gets its own mask rows, bits of std::vector<bool> can't be written from several threads
+                std::vector<std::vector<bool>> masks(_directions.size());
+                auto convertDirection = [this, palFile, w, &masks](size_t i, size_t positionY) {
+                    auto& direction = _directions[i];
+                    // pixels not covered by frames stay opaque, as they always were
+                    masks[i].assign(w * direction.height(), true);
 
-                unsigned positionY = 0;
-                for (auto& direction : _directions)
-                {
-                    unsigned positionX = 0;
+                    size_t positionX = 0;
                     for (auto& frame : direction.frames())
                     {
-                        // TODO: optimize
-                        for (unsigned y = 0; y != frame.height(); ++y)
+                        for (size_t y = 0; y != frame.height(); ++y)
                         {
-                            for (unsigned x = 0; x != frame.width(); ++x)
-                            {
-                                _mask[((y + positionY)*w) + x + positionX] = (palFile->color(frame.index(x, y))->alpha() > 0);
-                            }
+                            palFile->expand(
+                                frame.data() + y * frame.width(),
+                                frame.width(),
+                                _rgba.data() + (y + positionY) * w + positionX,
+                                masks[i].begin() + (y * w + positionX)
+                            );
                         }
                         positionX += frame.width();
                     }
-                    positionY += direction.height();
+                };
+
+                // critters have six directions with lots of frames each, those are converted in parallel
+                bool parallel = _rgba.size() >= PARALLEL_CONVERSION_PIXELS;
+                std::vector<std::thread> threads;
+                size_t positionY = 0;
+                for (size_t i = 0; i != _directions.size(); ++i)
+                {
+                    // the last one is left for this thread
+                    if (parallel && i + 1 != _directions.size()) {
+                        threads.emplace_back(convertDirection, i, positionY);
+                    } else {
+                        convertDirection(i, positionY);
+                    }
+                    positionY += _directions[i].height();
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+
+                if (masks.size() == 1) {
+                    _mask = std::move(masks.front());
+                    return;
+                }
+                _mask.clear();
+                _mask.reserve(_rgba.size());
+                for (auto& mask : masks)
+                {
+                    _mask.insert(_mask.end(), mask.begin(), mask.end());
                 }
-                return _mask;
             }
 
             int16_t File::offsetX(unsigned int direction, unsigned int frame) const
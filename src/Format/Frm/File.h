@@ -8,6 +8,7 @@
 // Third-party includes
 
 // stdlib
+#include <cstddef>
 #include <map>
 #include <vector>
 
@@ -47,6 +48,9 @@ namespace Falltergeist
                     uint32_t* rgba(Pal::File* palFile);
                     std::vector<bool>& mask(Pal::File* palFile);
 
+                    // Bytes held by the converted image and mask, 0 until rgba() or mask() is called
+                    size_t decodedSize() const;
+
                     const std::vector<Direction>& directions() const;
 
                 protected:
@@ -59,6 +63,11 @@ namespace Falltergeist
 
                     std::vector<Direction> _directions;
                     std::vector<bool> _mask;
+
+                    static const size_t PARALLEL_CONVERSION_PIXELS = 256 * 1024;
+
+                    // Fills both _rgba and _mask in one pass over the frames
+                    void _convert(Pal::File* palFile);
             };
         }
     }
@@ -1,14 +1,13 @@
 // Project includes
 #include "../../Exception.h"
 #include "../../Format/Dat/Stream.h"
+#include "../../Format/Dat/TextScanner.h"
 #include "../../Format/Gam/File.h"
 
 // Third-party includes
 
 // stdlib
-#include <vector>
-#include <algorithm>
-#include <cctype>
+#include <string>
 
 namespace Falltergeist
 {
@@ -18,45 +17,23 @@ namespace Falltergeist
         {
             File::File(Dat::Stream&& stream)
             {
-                stream.setPosition(0);
-
-                unsigned int i = 0;
-                unsigned char ch = 0;
-                std::string line;
-                while (i != stream.size())
-                {
-                    stream >> ch;
-                    i++;
-                    if (ch != 0x0D) // \r
-                    {
-                        line += ch;
-                    }
-                    else
-                    {
-                        stream.skipBytes(1);
-                        i++; // 0x0A \n
-                        _parseLine(line);
-                        line.clear();
-                    }
-                }
-                if (line.length() != 0)
+                Dat::TextScanner scanner(stream.view());
+                while (!scanner.atEnd())
                 {
-                    _parseLine(line);
+                    _parseLine(scanner.line());
                 }
             }
 
-            void File::_parseLine(std::string line)
+            void File::_parseLine(std::string_view line)
             {
                 // cut everything after comment
-                if (line.find("//") != std::string::npos)
+                auto comment = line.find("//");
+                if (comment != std::string_view::npos)
                 {
-                    line = line.substr(0, line.find("//"));
+                    line = line.substr(0, comment);
                 }
 
-                // rtrim
-                line.erase(std::find_if(line.rbegin(), line.rend(), [](unsigned char c) {
-                    return !std::isspace(c);
-                }).base(), line.end());
+                line = Dat::TextScanner::rtrim(line);
 
                 if (line.length() == 0) {
                     return;
@@ -73,21 +50,25 @@ namespace Falltergeist
                     return;
                 }
 
-                std::string name = line.substr(0, line.find(":="));
-                std::string value = line.substr(line.find(":=")+2,line.find(";")-line.find(":=")-2);
-                // rtrim
-                name.erase(std::find_if(name.rbegin(), name.rend(), [](unsigned char c) {
-                    return !std::isspace(c);
-                }).base(), name.end());
+                auto assignment = line.find(":=");
+                if (assignment == std::string_view::npos)
+                {
+                    throw Exception("File::_parseLine() - invalid line: " + std::string(line));
+                }
+                auto name = Dat::TextScanner::rtrim(line.substr(0, assignment));
+                auto value = line.substr(assignment + 2);
+                value = value.substr(0, value.find(';'));
 
                 if (_GVARmode)
                 {
-                    _GVARS.insert(std::make_pair(name, std::stoi(value)));
+                    _GVARnumbers.emplace(name, static_cast<unsigned int>(_GVARS.size()));
+                    _GVARS.push_back(Dat::TextScanner::toInt(value));
                     return;
                 }
                 else if(_MVARmode)
                 {
-                    _MVARS.insert(std::make_pair(name, std::stoi(value)));
+                    _MVARnumbers.emplace(name, static_cast<unsigned int>(_MVARS.size()));
+                    _MVARS.push_back(Dat::TextScanner::toInt(value));
                     return;
                 }
                 else
@@ -96,58 +77,62 @@ namespace Falltergeist
                 }
             }
 
-            std::map<std::string, int>* File::GVARS()
+            const std::vector<int>& File::GVARS() const
+            {
+                return _GVARS;
+            }
+
+            const std::vector<int>& File::MVARS() const
+            {
+                return _MVARS;
+            }
+
+            int File::GVAR(const std::string& name) const
             {
-                return &_GVARS;
+                return _GVARS[GVARnumber(name)];
             }
 
-            std::map<std::string, int>* File::MVARS()
+            int File::MVAR(const std::string& name) const
             {
-                return &_MVARS;
+                return _MVARS[MVARnumber(name)];
             }
 
-            int File::GVAR(std::string name)
+            int File::GVAR(unsigned int number) const
             {
-                if (_GVARS.find(name) != _GVARS.end())
+                if (number >= _GVARS.size())
                 {
-                    return _GVARS.at(name);
+                    throw Exception("File::GVAR(number) - not found: " + std::to_string(number));
                 }
-                throw Exception("File::GVAR(name) - GVAR not found:" + name);
+                return _GVARS[number];
             }
 
-            int File::MVAR(std::string name)
+            int File::MVAR(unsigned int number) const
             {
-                if (_MVARS.find(name) != _MVARS.end())
+                if (number >= _MVARS.size())
                 {
-                    return _MVARS.at(name);
+                    throw Exception("File::MVAR(number) - not found: " + std::to_string(number));
                 }
-                throw Exception("File::MVAR(name) - MVAR not found:" + name);
+                return _MVARS[number];
             }
 
-            int File::GVAR(unsigned int number)
+            unsigned int File::GVARnumber(const std::string& name) const
             {
-                unsigned int i = 0;
-                for (auto gvar : _GVARS)
+                auto it = _GVARnumbers.find(name);
+                if (it == _GVARnumbers.end())
                 {
-                    if (i == number) {
-                        return gvar.second;
-                    }
-                    i++;
+                    throw Exception("File::GVARnumber(name) - GVAR not found:" + name);
                 }
-                throw Exception("File::GVAR(number) - not found: " + std::to_string(number));
+                return it->second;
             }
 
-            int File::MVAR(unsigned int number)
+            unsigned int File::MVARnumber(const std::string& name) const
             {
-                unsigned int i = 0;
-                for (auto mvar : _MVARS)
+                auto it = _MVARnumbers.find(name);
+                if (it == _MVARnumbers.end())
                 {
-                    if (i == number) {
-                        return mvar.second;
-                    }
-                    i++;
+                    throw Exception("File::MVARnumber(name) - MVAR not found:" + name);
                 }
-                throw Exception("File::MVAR(number) - not found: " + std::to_string(number));
+                return it->second;
             }
         }
     }
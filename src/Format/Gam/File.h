@@ -7,7 +7,9 @@
 
 // stdlib
 #include <string>
-#include <map>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace Falltergeist
 {
@@ -20,23 +22,28 @@ namespace Falltergeist
 
         namespace Gam
         {
+            // Variables are kept in file order, which is the order scripts address them by
             class File : public Dat::Item
             {
                 public:
                     File(Dat::Stream&& stream);
-                    std::map<std::string, int>* GVARS();
-                    std::map<std::string, int>* MVARS();
-                    int GVAR(std::string name);
-                    int GVAR(unsigned int number);
-                    int MVAR(std::string name);
-                    int MVAR(unsigned int number);
+                    const std::vector<int>& GVARS() const;
+                    const std::vector<int>& MVARS() const;
+                    int GVAR(const std::string& name) const;
+                    int GVAR(unsigned int number) const;
+                    int MVAR(const std::string& name) const;
+                    int MVAR(unsigned int number) const;
+                    unsigned int GVARnumber(const std::string& name) const;
+                    unsigned int MVARnumber(const std::string& name) const;
 
                 protected:
-                    std::map<std::string, int> _GVARS;
-                    std::map<std::string, int> _MVARS;
+                    std::vector<int> _GVARS;
+                    std::vector<int> _MVARS;
+                    std::unordered_map<std::string, unsigned int> _GVARnumbers;
+                    std::unordered_map<std::string, unsigned int> _MVARnumbers;
                     bool _GVARmode = false;
                     bool _MVARmode = false;
-                    void _parseLine(std::string line);
+                    void _parseLine(std::string_view line);
             };
         }
     }
@@ -6,6 +6,7 @@
 // Third-party includes
 
 // stdlib
+#include <string>
 
 namespace Falltergeist
 {
@@ -100,29 +101,29 @@ namespace Falltergeist
                 return _strings;
             }
 
-            size_t File::position() const
-            {
-                return _stream.position();
-            }
-
-            void File::setPosition(size_t pos)
-            {
-                _stream.setPosition(pos);
-            }
-
             size_t File::size() const
             {
                 return _stream.size();
             }
 
-            uint16_t File::readOpcode()
+            uint16_t File::opcodeAt(size_t offset) const
             {
-                return _stream.uint16();
+                auto code = _stream.view();
+                if (offset + 2 > code.size()) {
+                    throw Exception("File::opcodeAt() - offset out of range: " + std::to_string(offset));
+                }
+                auto bytes = reinterpret_cast<const uint8_t*>(code.data()) + offset;
+                return static_cast<uint16_t>((bytes[0] << 8) | bytes[1]);
             }
 
-            uint32_t File::readValue()
+            uint32_t File::valueAt(size_t offset) const
             {
-                return _stream.uint32();
+                auto code = _stream.view();
+                if (offset + 4 > code.size()) {
+                    throw Exception("File::valueAt() - offset out of range: " + std::to_string(offset));
+                }
+                auto bytes = reinterpret_cast<const uint8_t*>(code.data()) + offset;
+                return (static_cast<uint32_t>(bytes[0]) << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
             }
 
             const std::vector<Procedure>& File::procedures() const
@@ -18,6 +18,7 @@ namespace Falltergeist
     {
         namespace Int
         {
+            // Compiled script program. Immutable after loading, so one instance is shared by every VM::Script running it.
             class File : public Dat::Item
             {
                 public:
@@ -31,20 +32,14 @@ namespace Falltergeist
                     const std::map<unsigned int, std::string>& identifiers() const;
                     const std::map<unsigned int, std::string>& strings() const;
 
-                    // current position in script file
-                    size_t position() const;
-
-                    // set current position in script file
-                    void setPosition(size_t);
-
                     // the size of script file
                     size_t size() const;
 
-                    // read the next opcode
-                    uint16_t readOpcode();
+                    // opcode at a given offset
+                    uint16_t opcodeAt(size_t offset) const;
 
-                    // read the next value
-                    uint32_t readValue();
+                    // 32-bit value at a given offset
+                    uint32_t valueAt(size_t offset) const;
 
                 protected:
                     Dat::Stream _stream;
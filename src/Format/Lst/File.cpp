@@ -1,13 +1,13 @@
 // Project includes
 #include "../Dat/Stream.h"
+#include "../Dat/TextScanner.h"
 #include "../Lst/File.h"
 
 // Third-party includes
 
 // stdlib
-#include <algorithm>
-#include <functional>
 #include <cctype>
+#include <utility>
 
 namespace Falltergeist
 {
@@ -17,52 +17,46 @@ namespace Falltergeist
         {
             File::File(Dat::Stream&& stream)
             {
-                stream.setPosition(0);
+                auto text = stream.view();
+                bool unterminated = !text.empty() && text.back() != '\n';
 
-                std::string line;
-                unsigned char ch = 0;
-                for (unsigned int i = 0; i != stream.size(); ++i)
+                Dat::TextScanner scanner(text);
+                while (!scanner.atEnd())
                 {
-                    stream >> ch;
-                    if (ch == 0x0D) // \r
+                    auto line = scanner.line();
+                    // unterminated last line is taken only if it has anything besides \r
+                    if (unterminated && scanner.atEnd() && line.find_first_not_of('\r') == std::string_view::npos)
                     {
-                        // do nothing
+                        break;
                     }
-                    else if (ch == 0x0A) // \n
-                    {
-                        _addString(line);
-                        line.clear();
-                    }
-                    else
-                    {
-                        line += ch;
-                    }
-                }
-                if (line.size() != 0)
-                {
                     _addString(line);
                 }
             }
 
-            void File::_addString(std::string line)
+            void File::_addString(std::string_view line)
             {
                 // strip comments
-                if (auto pos = line.find(";")) {
+                auto pos = line.find(';');
+                if (pos != std::string_view::npos && pos != 0)
+                {
                     line = line.substr(0, pos);
                 }
 
-                // rtrim
-                line.erase(std::find_if(line.rbegin(), line.rend(), [](unsigned char c) {
-                    return !std::isspace(c);
-                }).base(), line.end());
-
-                // replace slashes
-                std::replace(line.begin(),line.end(),'\\','/');
+                line = Dat::TextScanner::rtrim(line);
 
-                // to lower
-                std::transform(line.begin(),line.end(),line.begin(), ::tolower);
+                // drop stray \r, replace slashes and lowercase in one go
+                std::string result;
+                result.reserve(line.size());
+                for (char ch : line)
+                {
+                    if (ch == '\r')
+                    {
+                        continue;
+                    }
+                    result += (ch == '\\') ? '/' : static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+                }
 
-                _strings.push_back(line);
+                _strings.push_back(std::move(result));
             }
 
             std::vector<std::string>* File::strings()
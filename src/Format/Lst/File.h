@@ -7,6 +7,7 @@
 
 // stdlib
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Falltergeist
@@ -30,7 +31,7 @@ namespace Falltergeist
 
                 protected:
                     std::vector<std::string> _strings;
-                    void _addString(std::string line);
+                    void _addString(std::string_view line);
             };
         }
     }
@@ -0,0 +1,355 @@
+// Project includes
+#include "../../Base/BinaryReader.h"
+#include "../../Base/BinaryWriter.h"
+#include "../../Exception.h"
+#include "../Enums.h"
+#include "../Map/Cache.h"
+#include "../Map/File.h"
+#include "../Map/Object.h"
+#include "../Pro/File.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Format
+    {
+        namespace Map
+        {
+            namespace
+            {
+                const char MAGIC[4] = {'F', 'G', 'M', 'C'};
+
+                // bump whenever layout of the cache or parsing of map files changes
+                const uint32_t VERSION = 2;
+
+                // caches are written in host byte order
+                const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+                void writeObject(Base::BinaryWriter& writer, Object& object)
+                {
+                    writer.write<uint32_t>(object.ammount());
+                    writer.write<uint32_t>(object.OID());
+                    writer.write<int32_t>(object.hexPosition());
+                    writer.write<uint32_t>(object.x());
+                    writer.write<uint32_t>(object.y());
+                    writer.write<uint32_t>(object.sx());
+                    writer.write<uint32_t>(object.sy());
+                    writer.write<uint32_t>(object.frameNumber());
+                    writer.write<uint32_t>(object.orientation());
+                    writer.write<uint32_t>(object.frmTypeId());
+                    writer.write<uint32_t>(object.frmId());
+                    writer.write<uint32_t>(object.flags());
+                    writer.write<uint32_t>(object.elevation());
+                    writer.write<uint32_t>(object.objectTypeId());
+                    writer.write<uint32_t>(object.objectId());
+                    writer.write<uint32_t>(object.objectSubtypeId());
+                    writer.write<uint32_t>(object.objectID1());
+                    writer.write<uint32_t>(object.objectID2());
+                    writer.write<uint32_t>(object.objectID3());
+                    writer.write<uint32_t>(object.combatId());
+                    writer.write<uint32_t>(object.lightRadius());
+                    writer.write<uint32_t>(object.lightIntensity());
+                    writer.write<uint32_t>(object.outline());
+                    writer.write<int32_t>(object.scriptId());
+                    writer.write<int32_t>(object.mapScriptId());
+                    writer.write<uint32_t>(object.inventorySize());
+                    writer.write<uint32_t>(object.maxInventorySize());
+                    writer.write<uint32_t>(object.unknown12());
+                    writer.write<uint32_t>(object.unknown13());
+                    writer.write<int32_t>(object.exitMap());
+                    writer.write<int32_t>(object.exitPosition());
+                    writer.write<int32_t>(object.exitElevation());
+                    writer.write<int32_t>(object.exitOrientation());
+                    writer.write<int32_t>(object.elevatorType());
+                    writer.write<int32_t>(object.elevatorLevel());
+                    writer.write<uint8_t>(object.opened() ? 1 : 0);
+                    writer.write<int32_t>(object.AIPacket());
+                    writer.write<int32_t>(object.ammo());
+                    writer.write<int32_t>(object.ammoPID());
+
+                    writer.write<uint32_t>(static_cast<uint32_t>(object.children().size()));
+                    for (auto& child : object.children()) {
+                        writeObject(writer, *child);
+                    }
+                }
+
+                void collectPrototypeSubtypes(Object& object, std::map<uint32_t, uint32_t>& subtypes)
+                {
+                    // only these types look up their prototype while parsing, see File::_readObject()
+                    auto type = static_cast<OBJECT_TYPE>(object.objectTypeId());
+                    if (type == OBJECT_TYPE::ITEM || type == OBJECT_TYPE::SCENERY) {
+                        subtypes[(object.objectTypeId() << 24) | object.objectId()] = object.objectSubtypeId();
+                    }
+                    for (auto& child : object.children()) {
+                        collectPrototypeSubtypes(*child, subtypes);
+                    }
+                }
+
+                std::unique_ptr<Object> readObject(Base::BinaryReader& reader)
+                {
+                    auto object = std::make_unique<Object>();
+                    object->setAmmount(reader.read<uint32_t>());
+                    object->setOID(reader.read<uint32_t>());
+                    object->setHexPosition(reader.read<int32_t>());
+                    object->setX(reader.read<uint32_t>());
+                    object->setY(reader.read<uint32_t>());
+                    object->setSx(reader.read<uint32_t>());
+                    object->setSy(reader.read<uint32_t>());
+                    object->setFrameNumber(reader.read<uint32_t>());
+                    object->setOrientation(reader.read<uint32_t>());
+                    object->setFrmTypeId(reader.read<uint32_t>());
+                    object->setFrmId(reader.read<uint32_t>());
+                    object->setFlags(reader.read<uint32_t>());
+                    object->setElevation(reader.read<uint32_t>());
+                    object->setObjectTypeId(reader.read<uint32_t>());
+                    object->setObjectId(reader.read<uint32_t>());
+                    object->setObjectSubtypeId(reader.read<uint32_t>());
+                    object->setObjectID1(reader.read<uint32_t>());
+                    object->setObjectID2(reader.read<uint32_t>());
+                    object->setObjectID3(reader.read<uint32_t>());
+                    object->setCombatId(reader.read<uint32_t>());
+                    object->setLightRadius(reader.read<uint32_t>());
+                    object->setLightIntensity(reader.read<uint32_t>());
+                    object->setOutline(reader.read<uint32_t>());
+                    object->setScriptId(reader.read<int32_t>());
+                    object->setMapScriptId(reader.read<int32_t>());
+                    object->setInventorySize(reader.read<uint32_t>());
+                    object->setMaxInventorySize(reader.read<uint32_t>());
+                    object->setUnknown12(reader.read<uint32_t>());
+                    object->setUnknown13(reader.read<uint32_t>());
+                    object->setExitMap(reader.read<int32_t>());
+                    object->setExitPosition(reader.read<int32_t>());
+                    object->setExitElevation(reader.read<int32_t>());
+                    object->setExitOrientation(reader.read<int32_t>());
+                    object->setElevatorType(reader.read<int32_t>());
+                    object->setElevatorLevel(reader.read<int32_t>());
+                    object->setOpened(reader.read<uint8_t>() != 0);
+                    object->setAIPacket(reader.read<int32_t>());
+                    object->setAmmo(reader.read<int32_t>());
+                    object->setAmmoPID(reader.read<int32_t>());
+
+                    auto children = reader.read<uint32_t>();
+                    for (uint32_t i = 0; i != children; ++i) {
+                        object->children().emplace_back(readObject(reader));
+                    }
+                    return object;
+                }
+            }
+
+            uint64_t Cache::_sourceHash(const File& file)
+            {
+                // FNV-1a
+                uint64_t hash = 0xcbf29ce484222325ULL;
+                for (char c : file._stream.view()) {
+                    hash ^= static_cast<uint8_t>(c);
+                    hash *= 0x100000001b3ULL;
+                }
+                return hash;
+            }
+
+            std::map<uint32_t, uint32_t> Cache::_prototypeSubtypes(const File& file)
+            {
+                std::map<uint32_t, uint32_t> subtypes;
+                for (auto& elevation : file._elevations) {
+                    for (auto& object : elevation.objects()) {
+                        collectPrototypeSubtypes(*object, subtypes);
+                    }
+                }
+                return subtypes;
+            }
+
+            bool Cache::read(File& file, const std::string& path, ProFileTypeLoaderCallback callback)
+            {
+                if (file._initialized) {
+                    return true;
+                }
+
+                std::ifstream stream(path, std::ios::binary);
+                if (!stream.is_open()) {
+                    return false;
+                }
+                std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+                // everything is parsed into locals first, a broken or stale cache leaves the file untouched
+                uint32_t version, defaultPosition, defaultElevation, defaultOrientation, LVARsize, elevationFlags;
+                uint32_t MVARsize, mapId, timeSinceEpoch;
+                int32_t scriptId, unknown1;
+                std::string name;
+                std::vector<int32_t> MVARS;
+                std::vector<int32_t> LVARS;
+                std::vector<Script> scripts;
+                std::vector<Elevation> elevations;
+
+                try {
+                    Base::BinaryReader reader(data);
+                    char magic[4];
+                    for (auto& c : magic) {
+                        c = reader.read<char>();
+                    }
+                    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0
+                        || reader.read<uint32_t>() != VERSION
+                        || reader.read<uint32_t>() != BYTE_ORDER_MARK
+                        || reader.read<uint64_t>() != _sourceHash(file)
+                    ) {
+                        return false;
+                    }
+
+                    // subtypes decide how the rest of an object record is parsed, so a changed prototype
+                    // (patch DAT, mod, data folder override) invalidates the cache as well
+                    auto prototypes = reader.read<uint32_t>();
+                    for (uint32_t i = 0; i != prototypes; ++i) {
+                        auto PID = reader.read<uint32_t>();
+                        auto subtype = reader.read<uint32_t>();
+                        auto pro = callback(PID);
+                        if (!pro || pro->subtypeId() != subtype) {
+                            return false;
+                        }
+                    }
+
+                    version = reader.read<uint32_t>();
+                    name = reader.readString();
+                    defaultPosition = reader.read<uint32_t>();
+                    defaultElevation = reader.read<uint32_t>();
+                    defaultOrientation = reader.read<uint32_t>();
+                    LVARsize = reader.read<uint32_t>();
+                    scriptId = reader.read<int32_t>();
+                    elevationFlags = reader.read<uint32_t>();
+                    unknown1 = reader.read<int32_t>();
+                    MVARsize = reader.read<uint32_t>();
+                    mapId = reader.read<uint32_t>();
+                    timeSinceEpoch = reader.read<uint32_t>();
+                    reader.readArray(MVARS);
+                    reader.readArray(LVARS);
+
+                    // counts are not trusted for reserve(), a broken one runs out of data instead
+                    auto scriptCount = reader.read<uint32_t>();
+                    for (uint32_t i = 0; i != scriptCount; ++i) {
+                        Script script;
+                        script.setPID(reader.read<int32_t>());
+                        script.setScriptId(reader.read<int32_t>());
+                        script.setType(static_cast<Script::Type>(reader.read<uint32_t>()));
+                        script.setSpatialTile(reader.read<uint32_t>());
+                        script.setSpatialRadius(reader.read<uint32_t>());
+                        script.setTimerTime(reader.read<uint32_t>());
+                        scripts.push_back(script);
+                    }
+
+                    auto elevationCount = reader.read<uint32_t>();
+                    for (uint32_t i = 0; i != elevationCount; ++i) {
+                        elevations.emplace_back();
+                        auto& elevation = elevations.back();
+                        reader.readArray(elevation.floorTiles());
+                        reader.readArray(elevation.roofTiles());
+                        auto objects = reader.read<uint32_t>();
+                        for (uint32_t j = 0; j != objects; ++j) {
+                            elevation.objects().emplace_back(readObject(reader));
+                        }
+                    }
+
+                    if (!reader.atEnd()) {
+                        throw Exception("Map::Cache - trailing data in cache file");
+                    }
+                } catch (const Exception&) {
+                    return false;
+                }
+
+                file._version = version;
+                file._name = std::move(name);
+                file._defaultPosition = defaultPosition;
+                file._defaultElevation = defaultElevation;
+                file._defaultOrientaion = defaultOrientation;
+                file._LVARsize = LVARsize;
+                file._scriptId = scriptId;
+                file._elevationFlags = elevationFlags;
+                file._unknown1 = unknown1;
+                file._MVARsize = MVARsize;
+                file._mapId = mapId;
+                file._timeSinceEpoch = timeSinceEpoch;
+                file._MVARS = std::move(MVARS);
+                file._LVARS = std::move(LVARS);
+                file._scripts = std::move(scripts);
+                file._elevations = std::move(elevations);
+                file._initialized = true;
+                return true;
+            }
+
+            void Cache::write(const File& file, const std::string& path)
+            {
+                Base::BinaryWriter writer;
+                for (auto c : MAGIC) {
+                    writer.write<char>(c);
+                }
+                writer.write<uint32_t>(VERSION);
+                writer.write<uint32_t>(BYTE_ORDER_MARK);
+                writer.write<uint64_t>(_sourceHash(file));
+
+                auto prototypes = _prototypeSubtypes(file);
+                writer.write<uint32_t>(static_cast<uint32_t>(prototypes.size()));
+                for (auto& prototype : prototypes) {
+                    writer.write<uint32_t>(prototype.first);
+                    writer.write<uint32_t>(prototype.second);
+                }
+
+                writer.write<uint32_t>(file._version);
+                writer.writeString(file._name);
+                writer.write<uint32_t>(file._defaultPosition);
+                writer.write<uint32_t>(file._defaultElevation);
+                writer.write<uint32_t>(file._defaultOrientaion);
+                writer.write<uint32_t>(file._LVARsize);
+                writer.write<int32_t>(file._scriptId);
+                writer.write<uint32_t>(file._elevationFlags);
+                writer.write<int32_t>(file._unknown1);
+                writer.write<uint32_t>(file._MVARsize);
+                writer.write<uint32_t>(file._mapId);
+                writer.write<uint32_t>(file._timeSinceEpoch);
+                writer.writeArray(file._MVARS);
+                writer.writeArray(file._LVARS);
+
+                writer.write<uint32_t>(static_cast<uint32_t>(file._scripts.size()));
+                for (auto& script : file._scripts) {
+                    writer.write<int32_t>(script.PID());
+                    writer.write<int32_t>(script.scriptId());
+                    writer.write<uint32_t>(static_cast<uint32_t>(script.type()));
+                    writer.write<uint32_t>(script.spatialTile());
+                    writer.write<uint32_t>(script.spatialRadius());
+                    writer.write<uint32_t>(script.timerTime());
+                }
+
+                writer.write<uint32_t>(static_cast<uint32_t>(file._elevations.size()));
+                for (auto& elevation : file._elevations) {
+                    writer.writeArray(elevation.floorTiles());
+                    writer.writeArray(elevation.roofTiles());
+                    writer.write<uint32_t>(static_cast<uint32_t>(elevation.objects().size()));
+                    for (auto& object : elevation.objects()) {
+                        writeObject(writer, *object);
+                    }
+                }
+
+                // write aside and rename, so a crash never leaves half written cache behind
+                std::string temporaryPath = path + ".tmp";
+                {
+                    std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+                    if (!stream.is_open()) {
+                        return;
+                    }
+                    stream.write(writer.data().data(), writer.data().size());
+                    if (!stream) {
+                        return;
+                    }
+                }
+                std::remove(path.c_str());
+                std::rename(temporaryPath.c_str(), path.c_str());
+            }
+        }
+    }
+}
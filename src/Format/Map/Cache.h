@@ -0,0 +1,39 @@
+#pragma once
+
+// Project includes
+#include "../Map/File.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace Falltergeist
+{
+    namespace Format
+    {
+        namespace Map
+        {
+            // Preprocessed copy of a parsed map file, stored on disk so repeated loads
+            // skip the big-endian parsing.
+            // Caches are keyed by a hash of the source map file plus the subtypes of all prototypes
+            // the parser consulted, and silently ignored when stale.
+            class Cache
+            {
+                public:
+                    // Fills not yet initialized map file from the cache file, returns false if cache is missing or stale
+                    static bool read(File& file, const std::string& path, ProFileTypeLoaderCallback callback);
+
+                    static void write(const File& file, const std::string& path);
+
+                private:
+                    static uint64_t _sourceHash(const File& file);
+
+                    // PID -> subtype of every item and scenery prototype the parsed layout depends on
+                    static std::map<uint32_t, uint32_t> _prototypeSubtypes(const File& file);
+            };
+        }
+    }
+}
@@ -78,10 +78,14 @@ namespace Falltergeist
                 {
                     _elevations.emplace_back();
 
+                    auto& roofTiles = _elevations.back().roofTiles();
+                    auto& floorTiles = _elevations.back().floorTiles();
+                    roofTiles.reserve(10000);
+                    floorTiles.reserve(10000);
                     for (unsigned i = 0; i < 10000; i++)
                     {
-                        _elevations.back().roofTiles().push_back(stream.uint16());
-                        _elevations.back().floorTiles().push_back(stream.uint16());
+                        roofTiles.push_back(stream.uint16());
+                        floorTiles.push_back(stream.uint16());
                     }
                 }
 
@@ -161,6 +165,12 @@ namespace Falltergeist
                     }
                 }
 
+                // the last script wins if several share the same PID
+                for (auto& script : _scripts)
+                {
+                    _scriptIds[script.PID()] = script.scriptId();
+                }
+
                 //OBJECTS SECTION
                 stream.uint32(); // objects total
                 for (auto& elev : _elevations)
@@ -182,6 +192,7 @@ namespace Falltergeist
                         elev.objects().emplace_back(std::move(object));
                     }
                 }
+                _scriptIds.clear();
             }
 
             std::unique_ptr<Object> File::_readObject(Dat::Stream& stream, ProFileTypeLoaderCallback callback)
@@ -211,13 +222,11 @@ namespace Falltergeist
                 int32_t SID = stream.int32();
                 if (SID != -1)
                 {
-                    for (auto& script : _scripts)
+                    // TODO: comparing PID to SID? If this is not bug, need better name for PID
+                    auto it = _scriptIds.find(SID);
+                    if (it != _scriptIds.end())
                     {
-                        // TODO: comparing PID to SID? If this is not bug, need better name for PID
-                        if (script.PID() == SID)
-                        {
-                            object->setMapScriptId(script.scriptId());
-                        }
+                        object->setMapScriptId(it->second);
                     }
                 }
 
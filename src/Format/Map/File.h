@@ -10,6 +10,7 @@
 
 // stdlib
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Falltergeist
@@ -59,6 +60,8 @@ namespace Falltergeist
                     std::string name() const;
 
                 private:
+                    friend class Cache;
+
                     Dat::Stream _stream;
 
                     bool _initialized = false;
@@ -83,6 +86,9 @@ namespace Falltergeist
 
                     std::string _name;
 
+                    // script PID -> script id, used while reading objects only
+                    std::unordered_map<int32_t, int32_t> _scriptIds;
+
                     std::unique_ptr<Object> _readObject(Dat::Stream& stream, ProFileTypeLoaderCallback callback);
             };
         }
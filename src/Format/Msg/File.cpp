@@ -2,11 +2,13 @@
 #include "../../Exception.h"
 #include "../../Format/Msg/File.h"
 #include "../../Format/Dat/Stream.h"
+#include "../../Format/Dat/TextScanner.h"
 
 // Third-party includes
 
 // stdlib
 #include <string>
+#include <utility>
 
 namespace Falltergeist
 {
@@ -16,83 +18,47 @@ namespace Falltergeist
         {
             File::File(Dat::Stream&& stream)
             {
-                stream.setPosition(0);
+                Dat::TextScanner scanner(stream.view());
 
                 /*
                  * Because of bug in CMBATAI2.MSG in messages #1382 and #32020 we need to explode each line with '{' symbol
                  * Any extra '}' symbols must be trimed from exploded parts
                  */
 
-                while (stream.position() < stream.size())
+                std::string number;
+                while (scanner.skipPast('{'))
                 {
-                    uint8_t chr = stream.uint8();
-                    if (chr == '{')
-                    {
-                        std::string number;
-                        std::string sound;
-                        std::string text;
-                        chr = 0;
-                        // number
-                        while (chr != '{')
-                        {
-                            chr = stream.uint8();
-                            if (chr != '{' && chr != '}')
-                            {
-                                number += chr;
-                            }
-                        }
+                    number.clear();
+                    Dat::TextScanner::appendWithout(number, scanner.until('{'), "}");
 
-                        // sound
-                        chr = 0;
-                        while (chr != '{')
-                        {
-                            chr = stream.uint8();
-                            if (chr != '{' && chr != '}')
-                            {
-                                sound += chr;
-                            }
-                        }
+                    std::string sound;
+                    Dat::TextScanner::appendWithout(sound, scanner.until('{'), "}");
 
-                        chr = 0;
-                        // text
-                        while (chr != '}' && chr != '{' && stream.position() < stream.size())
-                        {
-                            chr = stream.uint8();
-                            if (chr != '{' && chr != '}')
-                            {
-                                text += chr;
-                            }
-                        }
+                    // text ends at the next brace, which is left for the outer loop
+                    std::string text;
+                    Dat::TextScanner::appendWithout(text, scanner.untilAny("{}"), "\r\n");
 
-                        // "put back" last character
-                        stream.setPosition(stream.position() - 1);
-
-                        while (text.find("\n") != std::string::npos)
-                        {
-                            text.replace(text.find("\n"), 1, "");
-                        }
-                        while (text.find("\r") != std::string::npos)
-                        {
-                            text.replace(text.find("\r"), 1, "");
-                        }
+                    Message message;
+                    message.setNumber(Dat::TextScanner::toInt(number));
+                    message.setSound(std::move(sound));
+                    message.setText(std::move(text));
+                    _messages.push_back(std::move(message));
+                }
 
-                        Message message;
-                        message.setNumber(std::stoi(number));
-                        message.setSound(sound);
-                        message.setText(text);
-                        _messages.push_back(message);
-                    }
+                // first message wins when a number is duplicated
+                _index.reserve(_messages.size());
+                for (size_t i = 0; i != _messages.size(); ++i)
+                {
+                    _index.emplace(_messages[i].number(), i);
                 }
             }
 
             Message* File::message(unsigned int number)
             {
-                for (auto& message : _messages)
+                auto it = _index.find(number);
+                if (it != _index.end())
                 {
-                    if (message.number() == number)
-                    {
-                        return &message;
-                    }
+                    return &_messages[it->second];
                 }
                 throw Exception("File::message() - number is out of range: " + std::to_string(number));
             }
@@ -7,6 +7,7 @@
 // Third-party includes
 
 // stdlib
+#include <unordered_map>
 #include <vector>
 
 namespace Falltergeist
@@ -29,6 +30,8 @@ namespace Falltergeist
 
                 private:
                     std::vector<Message> _messages;
+                    // message number -> position in _messages
+                    std::unordered_map<unsigned int, size_t> _index;
             };
         }
     }
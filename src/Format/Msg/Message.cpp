@@ -4,6 +4,7 @@
 // Third-party includes
 
 // stdlib
+#include <utility>
 
 namespace Falltergeist
 {
@@ -31,7 +32,7 @@ namespace Falltergeist
 
             void Message::setSound(std::string sound)
             {
-                _sound = sound;
+                _sound = std::move(sound);
             }
 
             std::string Message::sound()
@@ -41,7 +42,7 @@ namespace Falltergeist
 
             void Message::setText(std::string text)
             {
-                _text = text;
+                _text = std::move(text);
             }
 
             std::string Message::text()
@@ -89,6 +89,25 @@ namespace Falltergeist
                 // ALARM
                 _colors.at(254).setGreen(255); //
                 _colors.at(254).setBlue(0);
+
+                for (unsigned i = 0; i != 256; ++i)
+                {
+                    _rgba[i] = _colors.at(i);
+                }
+            }
+
+            void File::expand(const uint8_t* indexes, size_t count, uint32_t* rgba, std::vector<bool>::iterator mask) const
+            {
+                // plain table lookups, so the compiler is free to vectorize this loop
+                for (size_t i = 0; i != count; ++i)
+                {
+                    rgba[i] = _rgba[indexes[i]];
+                }
+                // alpha is the lowest byte, see Color::operator unsigned int()
+                for (size_t i = 0; i != count; ++i)
+                {
+                    mask[i] = (rgba[i] & 0xff) != 0;
+                }
             }
 
             const Color* File::color(unsigned index) const
@@ -7,6 +7,9 @@
 // Third-party includes
 
 // stdlib
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Falltergeist
@@ -27,8 +30,13 @@ namespace Falltergeist
 
                     const Color* color(unsigned index) const;
 
+                    // Converts count palette indexes to RGBA and marks which of the pixels are opaque in mask
+                    void expand(const uint8_t* indexes, size_t count, uint32_t* rgba, std::vector<bool>::iterator mask) const;
+
                 protected:
                     std::vector<Color> _colors;
+                    // colors converted to RGBA once, as the conversion of each pixel is just a lookup then
+                    std::array<uint32_t, 256> _rgba;
             };
         }
     }
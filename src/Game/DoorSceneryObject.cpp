@@ -33,6 +33,7 @@ namespace Falltergeist
             // Don't change if door is locked.
             if (!_locked) {
                 _opened = value;
+                // also refreshes the hex walk blocker, see canWalkThru()
                 setCanLightThru(_opened);
 
                 if (auto queue = ui<UI::AnimationQueue>()) {
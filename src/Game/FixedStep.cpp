@@ -0,0 +1,52 @@
+// Project includes
+#include "../Game/FixedStep.h"
+#include "../Game/FrameClock.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        FixedStep::FixedStep(FrameClock& clock, float step, unsigned int maxSteps)
+            : _clock(clock), _step(step), _maxSteps(maxSteps), _accumulator(step), _frameStart(clock.now())
+        {
+        }
+
+        unsigned int FixedStep::beginFrame()
+        {
+            double now = _clock.now();
+            _frameTime = now - _frameStart;
+            _frameStart = now;
+            _accumulator += _frameTime;
+
+            unsigned int steps = 0;
+            while (_accumulator >= _step && steps < _maxSteps) {
+                _accumulator -= _step;
+                steps++;
+            }
+            if (steps == _maxSteps) {
+                _accumulator = std::min(_accumulator, static_cast<double>(_step));
+            }
+            return steps;
+        }
+
+        float FixedStep::step() const
+        {
+            return _step;
+        }
+
+        double FixedStep::frameStart() const
+        {
+            return _frameStart;
+        }
+
+        double FixedStep::frameTime() const
+        {
+            return _frameTime;
+        }
+    }
+}
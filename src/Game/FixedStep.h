@@ -0,0 +1,51 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        class FrameClock;
+
+        /**
+         * Splits the time between rendered frames into fixed simulation steps.
+         * Time left over from a frame is carried to the next one, except after long stalls
+         * (loading, slow scripts), when at most maxSteps are run and the rest is dropped.
+         */
+        class FixedStep final
+        {
+            public:
+                FixedStep(FrameClock& clock, float step, unsigned int maxSteps);
+
+                // Starts a new frame, returns the number of steps to run during it.
+                // The first frame runs one step, so states think before they are rendered.
+                unsigned int beginFrame();
+
+                float step() const;
+
+                // Clock time at the beginning of current frame
+                double frameStart() const;
+
+                // Time passed since the beginning of previous frame
+                double frameTime() const;
+
+            private:
+                FrameClock& _clock;
+
+                float _step;
+
+                unsigned int _maxSteps;
+
+                double _accumulator;
+
+                double _frameStart;
+
+                double _frameTime = 0;
+        };
+    }
+}
@@ -0,0 +1,26 @@
+// Project includes
+#include "../Game/FrameClock.h"
+
+// Third-party includes
+#include <SDL.h>
+
+// stdlib
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        double SdlFrameClock::now()
+        {
+            static const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+            return static_cast<double>(SDL_GetPerformanceCounter()) * 1000.0 / frequency;
+        }
+
+        void SdlFrameClock::sleep(double milliseconds)
+        {
+            if (milliseconds >= 1.0) {
+                SDL_Delay(static_cast<Uint32>(milliseconds));
+            }
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        /**
+         * Time source of the main loop.
+         * Replace it with Game::setClock() to drive the loop without real time passing, e.g. headless.
+         */
+        class FrameClock
+        {
+            public:
+                virtual ~FrameClock() = default;
+
+                // milliseconds since an arbitrary fixed point
+                virtual double now() = 0;
+
+                virtual void sleep(double milliseconds) = 0;
+        };
+
+        /**
+         * Real time, measured with the SDL performance counter.
+         */
+        class SdlFrameClock final : public FrameClock
+        {
+            public:
+                double now() override;
+
+                void sleep(double milliseconds) override;
+        };
+    }
+}
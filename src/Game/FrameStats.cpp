@@ -0,0 +1,111 @@
+// Project includes
+#include "../Game/FrameStats.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        FrameStats::FrameStats(size_t capacity)
+        {
+            _frames.reserve(std::max<size_t>(capacity, 1));
+        }
+
+        void FrameStats::add(Phase phase, double milliseconds)
+        {
+            _current.phases[static_cast<size_t>(phase)] += milliseconds;
+        }
+
+        void FrameStats::endFrame(unsigned int thinkSteps)
+        {
+            _current.thinkSteps = thinkSteps;
+            if (_frames.size() < _frames.capacity()) {
+                _frames.push_back(_current);
+            } else {
+                _frames[_next] = _current;
+                _next = (_next + 1) % _frames.size();
+            }
+            _current = Frame();
+        }
+
+        size_t FrameStats::size() const
+        {
+            return _frames.size();
+        }
+
+        double FrameStats::Frame::total() const
+        {
+            double total = 0;
+            for (auto value : phases) {
+                total += value;
+            }
+            return total;
+        }
+
+        double FrameStats::percentile(Phase phase, double percent) const
+        {
+            std::vector<double> values;
+            values.reserve(_frames.size());
+            for (auto& frame : _frames) {
+                values.push_back(frame.phases[static_cast<size_t>(phase)]);
+            }
+            return _percentile(values, percent);
+        }
+
+        double FrameStats::percentile(double percent) const
+        {
+            std::vector<double> values;
+            values.reserve(_frames.size());
+            for (auto& frame : _frames) {
+                values.push_back(frame.total());
+            }
+            return _percentile(values, percent);
+        }
+
+        double FrameStats::_percentile(std::vector<double>& values, double percent) const
+        {
+            if (values.empty()) {
+                return 0;
+            }
+            // nearest rank
+            auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * values.size()));
+            rank = std::min(std::max<size_t>(rank, 1), values.size()) - 1;
+            std::nth_element(values.begin(), values.begin() + rank, values.end());
+            return values[rank];
+        }
+
+        bool FrameStats::writeReport(const std::string& filename) const
+        {
+            std::ofstream stream(filename);
+            if (!stream) {
+                return false;
+            }
+
+            stream << "frame,events_ms,think_ms,render_ms,swap_ms,total_ms,think_steps" << std::endl;
+            // oldest frame first
+            for (size_t i = 0; i != _frames.size(); ++i) {
+                auto& frame = _frames[(_next + i) % _frames.size()];
+                stream << i;
+                for (auto value : frame.phases) {
+                    stream << "," << value;
+                }
+                stream << "," << frame.total() << "," << frame.thinkSteps << std::endl;
+            }
+
+            for (double percent : {50.0, 95.0, 99.0}) {
+                stream << "p" << percent;
+                for (size_t phase = 0; phase != PHASES; ++phase) {
+                    stream << "," << percentile(static_cast<Phase>(phase), percent);
+                }
+                stream << "," << percentile(percent) << "," << std::endl;
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        /**
+         * Per-phase durations of the last rendered frames, kept in a ring buffer.
+         * Enabled with the --frame-stats command line option.
+         */
+        class FrameStats final
+        {
+            public:
+                enum class Phase
+                {
+                    EVENTS = 0,
+                    THINK,
+                    RENDER,
+                    SWAP
+                };
+
+                static const size_t PHASES = 4;
+
+                FrameStats(size_t capacity = 3600);
+
+                void add(Phase phase, double milliseconds);
+
+                // Closes current frame, thinkSteps is the number of simulation steps run during it
+                void endFrame(unsigned int thinkSteps);
+
+                // Number of frames in the buffer
+                size_t size() const;
+
+                // Percentile (0..100) of given phase duration over the buffered frames, in milliseconds
+                double percentile(Phase phase, double percent) const;
+
+                // Percentile of whole frame duration
+                double percentile(double percent) const;
+
+                // Writes buffered frames followed by p50/p95/p99 rows as CSV
+                bool writeReport(const std::string& filename) const;
+
+            private:
+                struct Frame
+                {
+                    std::array<double, PHASES> phases{};
+                    unsigned int thinkSteps = 0;
+
+                    double total() const;
+                };
+
+                std::vector<Frame> _frames;
+
+                // next slot to overwrite once the buffer is full
+                size_t _next = 0;
+
+                Frame _current;
+
+                double _percentile(std::vector<double>& values, double percent) const;
+        };
+    }
+}
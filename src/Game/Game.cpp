@@ -6,7 +6,9 @@
 #include "../Exception.h"
 #include "../Format/Gam/File.h"
 #include "../Game/DudeObject.h"
+#include "../Game/FixedStep.h"
 #include "../Game/Game.h"
+#include "../Game/StartupProfiler.h"
 #include "../Game/Time.h"
 #include "../Graphics/AnimatedPalette.h"
 #include "../Graphics/Renderer.h"
@@ -19,6 +21,7 @@
 #include "../State/Location.h"
 #include "../UI/FpsCounter.h"
 #include "../UI/TextArea.h"
+#include "../VM/Profiler.h"
 #include "../Graphics/SdlWindow.h"
 
 // Third-party includes
@@ -36,6 +39,9 @@ namespace Falltergeist
     {
         Game* Game::_instance = nullptr;
 
+        const float Game::THINK_STEP = 1000.0f / 60;
+        const unsigned int Game::MAX_THINK_STEPS = 5;
+
         Game::Game() {
         }
 
@@ -66,9 +72,16 @@ namespace Falltergeist
             _initialized = true;
 
             _settings = std::move(settings);
+            VM::Profiler::setEnabled(_settings->profileScripts());
+
+            StartupProfiler::begin("DAT index");
+            ResourceManager::getInstance()->setMemoryBudget(static_cast<size_t>(_settings->resourceMemory()) * 1024 * 1024);
 
             _eventDispatcher = std::make_unique<Event::Dispatcher>();
+            _mouseEvent = std::make_unique<Event::Mouse>(Event::Mouse::Type::MOVE);
+            _keyboardEvent = std::make_unique<Event::Keyboard>(Event::Keyboard::Type::KEY_DOWN);
 
+            StartupProfiler::begin("window");
             auto rendererConfig = createRendererConfigFromSettings();
 
             std::string version = CrossPlatform::getVersion();
@@ -103,10 +116,12 @@ namespace Falltergeist
             renderer()->init();
 
 
+            StartupProfiler::begin("audio");
             _mixer = std::make_shared<Audio::Mixer>(logger());
             _mixer->setMusicVolume(_settings->musicVolume());
             _mouse = std::make_shared<Input::Mouse>(_uiResourceManager, sdlMouse);
             _mouse->setPosition({320, 240});
+            StartupProfiler::begin("fonts");
             _fpsCounter = std::make_unique<UI::FpsCounter>(Graphics::Point(renderer()->size().width() - 42, 2));
             _fpsCounter->setWidth(42);
             _fpsCounter->setHorizontalAlign(UI::TextArea::HorizontalAlign::RIGHT);
@@ -137,6 +152,14 @@ namespace Falltergeist
 
         void Game::shutdown()
         {
+            if (VM::Profiler::enabled()) {
+                _writeScriptProfile();
+                VM::Profiler::setEnabled(false);
+            }
+            if (_frameStats) {
+                _writeFrameStats();
+                _frameStats.reset();
+            }
             _mixer.reset();
             ResourceManager::getInstance()->shutdown();
             while (!_states.empty()) {
@@ -145,15 +168,25 @@ namespace Falltergeist
             _settings.reset();
         }
 
+        void Game::_writeScriptProfile()
+        {
+            std::string filename = CrossPlatform::getConfigPath() + "/script_profile.csv";
+            if (VM::Profiler::writeReport(filename)) {
+                logger()->info() << "[GAME] Script profile saved to " << filename << std::endl;
+            } else {
+                logger()->warning() << "[GAME] Cannot write script profile to " << filename << std::endl;
+            }
+        }
+
         void Game::pushState(State::State* state)
         {
             _states.push_back(std::unique_ptr<State::State>(state));
             if (!state->initialized()) {
                 state->init();
             }
-            state->emitEvent(std::make_unique<Event::State>("push"), state->pushHandler());
+            state->emitEvent(Event::State("push"), state->pushHandler());
             state->setActive(true);
-            state->emitEvent(std::make_unique<Event::State>("activate"), state->activateHandler());
+            state->emitEvent(Event::State("activate"), state->activateHandler());
         }
 
         void Game::popState(bool doDelete)
@@ -170,8 +203,8 @@ namespace Falltergeist
             }
             _states.pop_back();
             state->setActive(false);
-            state->emitEvent(std::make_unique<Event::State>("deactivate"), state->deactivateHandler());
-            state->emitEvent(std::make_unique<Event::State>("pop"), state->popHandler());
+            state->emitEvent(Event::State("deactivate"), state->deactivateHandler());
+            state->emitEvent(Event::State("pop"), state->popHandler());
         }
 
         void Game::setState(State::State* state)
@@ -187,29 +220,80 @@ namespace Falltergeist
             logger()->info() << "[GAME] Starting main loop" << std::endl;
             _frame = 0;
 
-            uint32_t FPS = 60;
-            uint32_t frameDelay = 1000 / FPS;
+            // rendering is capped at 60 FPS
+            const double frameDelay = 1000.0 / 60;
 
-            uint32_t frameStart = 0;
-            uint32_t frameTime = 0;
+            FixedStep fixedStep(*_clock, THINK_STEP, MAX_THINK_STEPS);
             while (!_quit) {
-                frameStart = SDL_GetTicks();
+                unsigned int steps = fixedStep.beginFrame();
+                double frameStart = fixedStep.frameStart();
+                _fpsCounter->think(static_cast<float>(fixedStep.frameTime()));
+
+                double mark = frameStart;
+                auto measure = [this, &mark](FrameStats::Phase phase) {
+                    double now = _clock->now();
+                    if (_frameStats) {
+                        _frameStats->add(phase, now - mark);
+                    }
+                    mark = now;
+                };
 
                 handle();
-                think(frameTime);
+                measure(FrameStats::Phase::EVENTS);
+
+                for (unsigned int i = 0; i != steps; ++i) {
+                    think(fixedStep.step());
+                }
+                measure(FrameStats::Phase::THINK);
+
                 render();
+                measure(FrameStats::Phase::RENDER);
+
+                renderer()->endFrame();
+                measure(FrameStats::Phase::SWAP);
+
+                if (_frameStats) {
+                    _frameStats->endFrame(steps);
+                }
+                if (_frame == 0) {
+                    StartupProfiler::end();
+                    StartupProfiler::report(*logger());
+                }
                 _statesForDelete.clear();
+                // raw pointers to cached resources don't outlive the frame, so it's safe to evict now
+                ResourceManager::getInstance()->trim();
                 _frame++;
 
-                frameTime = SDL_GetTicks() - frameStart;
+                double frameTime = _clock->now() - frameStart;
                 if (frameDelay > frameTime) {
-                    SDL_Delay(frameDelay - frameTime);
-                    frameTime += (frameDelay - frameTime);
+                    _clock->sleep(frameDelay - frameTime);
                 }
             }
             logger()->info() << "[GAME] Stopping main loop" << std::endl;
         }
 
+        void Game::setClock(std::unique_ptr<FrameClock> clock)
+        {
+            _clock = std::move(clock);
+        }
+
+        void Game::enableFrameStats(const std::string& filename)
+        {
+            _frameStats = std::make_unique<FrameStats>();
+            _frameStatsFilename = filename;
+        }
+
+        void Game::_writeFrameStats()
+        {
+            if (!_frameStats->writeReport(_frameStatsFilename)) {
+                logger()->warning() << "[GAME] Cannot write frame stats to " << _frameStatsFilename << std::endl;
+                return;
+            }
+            logger()->info() << "[GAME] Frame stats saved to " << _frameStatsFilename
+                             << ", frame time p50/p95/p99: " << _frameStats->percentile(50) << "/"
+                             << _frameStats->percentile(95) << "/" << _frameStats->percentile(99) << " ms" << std::endl;
+        }
+
         void Game::quit()
         {
             _quit = true;
@@ -247,7 +331,7 @@ namespace Falltergeist
             if (number >= _GVARS.size()) {
                 throw Exception("Game::setGVAR(num, value) - num out of range: " + std::to_string(number));
             }
-            _GVARS.at(number) = value;
+            _GVARS[number] = value;
         }
 
         int Game::GVAR(unsigned int number)
@@ -256,7 +340,13 @@ namespace Falltergeist
             if (number >= _GVARS.size()) {
                 throw Exception("Game::GVAR(num) - num out of range: " + std::to_string(number));
             }
-            return _GVARS.at(number);
+            return _GVARS[number];
+        }
+
+        const std::vector<int>& Game::GVARS()
+        {
+            _initGVARS();
+            return _GVARS;
         }
 
         void Game::_initGVARS()
@@ -265,9 +355,7 @@ namespace Falltergeist
                 return;
             }
             auto gam = ResourceManager::getInstance()->gamFileType("data/vault13.gam");
-            for (auto gvar : *gam->GVARS()) {
-                _GVARS.push_back(gvar.second);
-            }
+            _GVARS = gam->GVARS();
         }
 
         State::State* Game::topState(unsigned offset) const
@@ -275,9 +363,10 @@ namespace Falltergeist
             return (_states.rbegin() + offset)->get();
         }
 
-        std::vector<State::State*> Game::_getVisibleStates()
+        const std::vector<State::State*>& Game::_getVisibleStates()
         {
-            std::vector<State::State*> subset;
+            auto& subset = _visibleStates;
+            subset.clear();
             if (_states.empty()) {
                 return subset;
             }
@@ -293,17 +382,18 @@ namespace Falltergeist
             return subset;
         }
 
-        std::vector<State::State*> Game::_getActiveStates()
+        const std::vector<State::State*>& Game::_getActiveStates()
         {
             // we must handle all states from top to bottom of stack
-            std::vector<State::State*> subset;
+            auto& subset = _activeStates;
+            subset.clear();
 
             auto it = _states.rbegin();
             // active states
             for (; it != _states.rend(); ++it) {
                 auto state = it->get();
                 if (!state->active()) {
-                    state->emitEvent(std::make_unique<Event::State>("activate"), state->activateHandler());
+                    state->emitEvent(Event::State("activate"), state->activateHandler());
                     state->setActive(true);
                 }
                 subset.push_back(state);
@@ -316,7 +406,7 @@ namespace Falltergeist
             for (; it != _states.rend(); ++it) {
                 auto state = it->get();
                 if (state->active()) {
-                    state->emitEvent(std::make_unique<Event::State>("deactivate"), state->deactivateHandler());
+                    state->emitEvent(Event::State("deactivate"), state->deactivateHandler());
                     state->setActive(false);
                 }
             }
@@ -334,7 +424,7 @@ namespace Falltergeist
         }
 
         // TODO: probably need to move this to factory class
-        std::unique_ptr<Event::Event> Game::_createEventFromSDL(const SDL_Event& sdlEvent)
+        Event::Event* Game::_createEventFromSDL(const SDL_Event& sdlEvent)
         {
             using Mouse = Event::Mouse;
             using Keyboard = Event::Keyboard;
@@ -344,7 +434,8 @@ namespace Falltergeist
                 case SDL_MOUSEBUTTONUP:
                 {
                     SDL_Keymod mods = SDL_GetModState();
-                    auto mouseEvent = std::make_unique<Mouse>((sdlEvent.type == SDL_MOUSEBUTTONDOWN) ? Mouse::Type::BUTTON_DOWN : Mouse::Type::BUTTON_UP);
+                    auto& mouseEvent = _mouseEvent;
+                    *mouseEvent = Mouse((sdlEvent.type == SDL_MOUSEBUTTONDOWN) ? Mouse::Type::BUTTON_DOWN : Mouse::Type::BUTTON_UP);
                     mouseEvent->setPosition({sdlEvent.button.x, sdlEvent.button.y});
                     switch (sdlEvent.button.button)
                     {
@@ -367,29 +458,32 @@ namespace Falltergeist
                     mouseEvent->setShiftPressed(mods & KMOD_SHIFT);
                     mouseEvent->setControlPressed(mods & KMOD_CTRL);
                     mouseEvent->setAltPressed(mods & KMOD_ALT);
-                    return std::move(mouseEvent);
+                    return mouseEvent.get();
                 }
                 case SDL_MOUSEMOTION:
                 {
-                    auto mouseEvent = std::make_unique<Event::Mouse>(Mouse::Type::MOVE);
+                    auto& mouseEvent = _mouseEvent;
+                    *mouseEvent = Mouse(Mouse::Type::MOVE);
                     mouseEvent->setPosition({sdlEvent.motion.x, sdlEvent.motion.y});
 
                     // TODO move position update to window class polling
                     //((Graphics::SdlWindow*)_window.get())->_mousePosition = {sdlEvent.motion.x, sdlEvent.motion.y};
-                    return std::move(mouseEvent);
+                    return mouseEvent.get();
                 }
                 case SDL_KEYDOWN:
                 {
-                    auto keyboardEvent = std::make_unique<Event::Keyboard>(Keyboard::Type::KEY_DOWN);
+                    auto& keyboardEvent = _keyboardEvent;
+                    *keyboardEvent = Keyboard(Keyboard::Type::KEY_DOWN);
                     keyboardEvent->setKeyCode(sdlEvent.key.keysym.sym);
                     keyboardEvent->setAltPressed(sdlEvent.key.keysym.mod & KMOD_ALT);
                     keyboardEvent->setShiftPressed(sdlEvent.key.keysym.mod & KMOD_SHIFT);
                     keyboardEvent->setControlPressed(sdlEvent.key.keysym.mod & KMOD_CTRL);
-                    return std::move(keyboardEvent);
+                    return keyboardEvent.get();
                 }
                 case SDL_KEYUP:
                 {
-                    auto keyboardEvent = std::make_unique<Event::Keyboard>(Keyboard::Type::KEY_UP);
+                    auto& keyboardEvent = _keyboardEvent;
+                    *keyboardEvent = Keyboard(Keyboard::Type::KEY_UP);
                     keyboardEvent->setKeyCode(sdlEvent.key.keysym.sym);
                     keyboardEvent->setAltPressed(sdlEvent.key.keysym.mod & KMOD_ALT);
                     keyboardEvent->setShiftPressed(sdlEvent.key.keysym.mod & KMOD_SHIFT);
@@ -400,10 +494,14 @@ namespace Falltergeist
                     {
                         renderer()->screenshot();
                     }
-                    return std::move(keyboardEvent);
+                    if (keyboardEvent->keyCode() == SDLK_F11 && VM::Profiler::enabled())
+                    {
+                        _writeScriptProfile();
+                    }
+                    return keyboardEvent.get();
                 }
             }
-            return std::unique_ptr<Event::Event>();
+            return nullptr;
         }
 
         void Game::handle()
@@ -423,7 +521,7 @@ namespace Falltergeist
                     auto event = _createEventFromSDL(_event);
                     if (event) {
                         for (auto state : _getActiveStates()) {
-                            state->handle(event.get());
+                            state->handle(event);
                         }
                     }
                 }
@@ -434,8 +532,6 @@ namespace Falltergeist
 
         void Game::think(const float &deltaTime)
         {
-            _fpsCounter->think(deltaTime);
-
             _mouse->think(deltaTime);
 
             _animatedPalette->think(deltaTime);
@@ -484,7 +580,6 @@ namespace Falltergeist
             if (_mouse->state() != Input::Mouse::Cursor::HEXAGON_RED) {
                 _mouse->render();
             }
-            renderer()->endFrame();
         }
 
         Graphics::AnimatedPalette* Game::animatedPalette()
@@ -1,6 +1,8 @@
 #pragma once
 
 // Project includes
+#include "../Game/FrameClock.h"
+#include "../Game/FrameStats.h"
 #include "../Game/Time.h"
 #include "../Graphics/IRendererConfig.h"
 #include "../Graphics/IWindow.h"
@@ -26,7 +28,8 @@ namespace Falltergeist
     {
         class Event;
         class Dispatcher;
-        class Event;
+        class Keyboard;
+        class Mouse;
     }
     namespace Graphics
     {
@@ -81,6 +84,9 @@ namespace Falltergeist
 
                 void popState(bool doDelete = true);
 
+                /**
+                 * @brief Main loop. Logic runs in fixed THINK_STEP steps, independent of the rendering rate.
+                 */
                 void run();
 
                 void quit();
@@ -96,10 +102,16 @@ namespace Falltergeist
                  */
                 void think(const float &deltaTime);
                 /**
-                 * @brief Render the game.
+                 * @brief Render the game. The frame is presented by run().
                  */
                 void render();
 
+                // Replaces time source of the main loop
+                void setClock(std::unique_ptr<FrameClock> clock);
+
+                // Collects per-phase frame times and writes them to given CSV file on shutdown
+                void enableFrameStats(const std::string& filename);
+
                 void setPlayer(std::shared_ptr<DudeObject> player);
 
                 std::shared_ptr<DudeObject> player() const;
@@ -122,6 +134,8 @@ namespace Falltergeist
 
                 int GVAR(unsigned int number);
 
+                const std::vector<int>& GVARS();
+
                 std::shared_ptr<Settings> settings() const;
 
                 Graphics::AnimatedPalette* animatedPalette();
@@ -131,6 +145,12 @@ namespace Falltergeist
                 void setUIResourceManager(std::shared_ptr<UI::IResourceManager> uiResourceManager);
 
             protected:
+                // Simulation step of think(), in milliseconds
+                static const float THINK_STEP;
+
+                // Simulation steps allowed per rendered frame, the rest of a long frame is dropped
+                static const unsigned int MAX_THINK_STEPS;
+
                 std::vector<int> _GVARS;
 
                 std::vector<std::unique_ptr<State::State>> _states;
@@ -141,6 +161,12 @@ namespace Falltergeist
 
                 unsigned int _frame = 0;
 
+                std::unique_ptr<FrameClock> _clock = std::make_unique<SdlFrameClock>();
+
+                std::unique_ptr<FrameStats> _frameStats;
+
+                std::string _frameStatsFilename;
+
                 std::shared_ptr<Graphics::Renderer> _renderer;
 
                 std::shared_ptr<Audio::Mixer> _mixer;
@@ -165,9 +191,12 @@ namespace Falltergeist
 
                 SDL_Event _event;
 
-                std::vector<State::State*> _getVisibleStates();
+                // reused between frames to avoid allocations
+                std::vector<State::State*> _visibleStates, _activeStates;
+
+                const std::vector<State::State*>& _getVisibleStates();
 
-                std::vector<State::State*> _getActiveStates();
+                const std::vector<State::State*>& _getActiveStates();
 
             private:
                 static Game* _instance;
@@ -178,7 +207,17 @@ namespace Falltergeist
 
                 void _initGVARS();
 
-                std::unique_ptr<Event::Event> _createEventFromSDL(const SDL_Event& sdlEvent);
+                // Dumps VM::Profiler statistics, on exit and on F11
+                void _writeScriptProfile();
+
+                void _writeFrameStats();
+
+                // OS events are converted into these objects instead of allocating new ones
+                std::unique_ptr<Event::Mouse> _mouseEvent;
+
+                std::unique_ptr<Event::Keyboard> _keyboardEvent;
+
+                Event::Event* _createEventFromSDL(const SDL_Event& sdlEvent);
 
                 std::unique_ptr<Graphics::IRendererConfig> createRendererConfigFromSettings();
 
@@ -1,4 +1,5 @@
 // Project includes
+#include "../Base/SharedCache.h"
 #include "../Game/ItemObject.h"
 #include "../Graphics/ObjectUIFactory.h"
 #include "../ResourceManager.h"
@@ -14,6 +15,26 @@ namespace Falltergeist
 {
     namespace Game
     {
+        namespace
+        {
+            typedef Base::SharedCache<int, UI::Base> InventoryUiCache;
+
+            // Inventory images keep no per-item state, so they live as long as some item uses them
+            std::shared_ptr<UI::Base> sharedInventoryUi(InventoryUiCache& cache, int FID)
+            {
+                if (FID == -1) {
+                    return nullptr;
+                }
+
+                return cache.get(FID, [](int FID) -> std::shared_ptr<UI::Base> {
+                    Graphics::ObjectUIFactory uiFactory;
+                    return uiFactory.buildByFID(FID);
+                });
+            }
+
+            InventoryUiCache inventoryUis, inventorySlotUis, inventoryDragUis;
+        }
+
         ItemObject::ItemObject() : Object()
         {
             _type = Type::ITEM;
@@ -27,7 +48,9 @@ namespace Falltergeist
         void ItemObject::setAmount(unsigned int value)
         {
             _amount = value;
-            _inventoryAmountUi->setText("x" + std::to_string(value));
+            if (_inventoryAmountUi) {
+                _inventoryAmountUi->setText("x" + std::to_string(value));
+            }
         }
 
         unsigned int ItemObject::weight() const
@@ -57,16 +80,30 @@ namespace Falltergeist
 
         void ItemObject::setInventoryFID(int value)
         {
+            if (_inventoryFID == value) {
+                return;
+            }
             _inventoryFID = value;
+            _inventoryUi.reset();
+            _inventorySlotUi.reset();
+            _inventoryDragUi.reset();
         }
 
         std::shared_ptr<UI::Base> ItemObject::inventoryDragUi()
         {
+            // Big unscaled image of item
+            if (!_inventoryDragUi) {
+                _inventoryDragUi = sharedInventoryUi(inventoryDragUis, inventoryFID());
+            }
             return _inventoryDragUi;
         }
 
         std::shared_ptr<UI::TextArea>& ItemObject::inventoryAmountUi()
         {
+            if (!_inventoryAmountUi) {
+                _inventoryAmountUi = std::make_shared<UI::TextArea>("x" + std::to_string(_amount));
+                _inventoryAmountUi->setColor({ 255, 255, 255, 0 });
+            }
             return _inventoryAmountUi;
         }
 
@@ -82,30 +119,18 @@ namespace Falltergeist
 
         std::shared_ptr<UI::Base> ItemObject::inventoryUi()
         {
+            if (!_inventoryUi) {
+                _inventoryUi = sharedInventoryUi(inventoryUis, inventoryFID());
+            }
             return _inventoryUi;
         }
 
         std::shared_ptr<UI::Base> ItemObject::inventorySlotUi()
         {
-            return _inventorySlotUi;
-        }
-
-        void ItemObject::_generateUi()
-        {
-            Object::_generateUi();
-
-            if (inventoryFID() == -1) {
-                return;
+            if (!_inventorySlotUi) {
+                _inventorySlotUi = sharedInventoryUi(inventorySlotUis, inventoryFID());
             }
-
-            Graphics::ObjectUIFactory uiFactory;
-
-            // Big unscaled image of item
-            _inventoryDragUi = uiFactory.buildByFID(inventoryFID());
-            _inventoryUi = uiFactory.buildByFID(inventoryFID());
-            _inventorySlotUi = uiFactory.buildByFID(inventoryFID());
-            _inventoryAmountUi = std::make_unique<UI::TextArea>("x" + std::to_string(_amount), inventorySlotUi()->position());
-            _inventoryAmountUi->setColor({ 255, 255, 255, 0 });
+            return _inventorySlotUi;
         }
 
         ItemObject::Subtype ItemObject::subtype() const
@@ -54,6 +54,8 @@ namespace Falltergeist
                 int inventoryFID() const;
                 void setInventoryFID(int value);
 
+                // Inventory UIs are built on first use. Images are shared by all items with the same inventory FID,
+                // so callers must set position right before rendering them.
                 std::shared_ptr<UI::Base> inventoryUi();
 
                 std::shared_ptr<UI::Base> inventorySlotUi();
@@ -78,8 +80,6 @@ namespace Falltergeist
                 std::shared_ptr<UI::TextArea> _inventoryAmountUi;
 
                 std::shared_ptr<UI::Base> _inventoryUi, _inventorySlotUi, _inventoryDragUi;
-
-                void _generateUi() override;
         };
     }
 }
@@ -39,9 +39,7 @@ namespace Falltergeist
             if (!mapFile->MVARS().empty()) {
                 auto gam = ResourceManager::getInstance()->gamFileType("maps/" + name() + ".gam");
                 if (gam) {
-                    for (auto mvar : *gam->MVARS()) {
-                        _MVARS.push_back(mvar.second);
-                    }
+                    _MVARS.assign(gam->MVARS().begin(), gam->MVARS().end());
                 }
             }
 
@@ -78,12 +76,15 @@ namespace Falltergeist
 
                     unsigned int tileNum = mapElevation.floorTiles().at(i);
                     if (tileNum > 1) {
-                        elevation->floor()->tiles()[i] = std::make_unique<UI::Tile>(tileNum, Graphics::Point(x, y));
+                        // tiles come in order, so every insert goes to the end of the map
+                        auto& tiles = elevation->floor()->tiles();
+                        tiles.emplace_hint(tiles.end(), i, std::make_unique<UI::Tile>(tileNum, Graphics::Point(x, y)));
                     }
 
                     tileNum = mapElevation.roofTiles().at(i);
                     if (tileNum > 1) {
-                        elevation->roof()->tiles()[i] = std::make_unique<UI::Tile>(tileNum, Graphics::Point(x, y - 96));
+                        auto& tiles = elevation->roof()->tiles();
+                        tiles.emplace_hint(tiles.end(), i, std::make_unique<UI::Tile>(tileNum, Graphics::Point(x, y - 96)));
                     }
                 }
 
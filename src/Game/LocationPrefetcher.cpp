@@ -0,0 +1,167 @@
+// Project includes
+#include "../Format/Lst/File.h"
+#include "../Format/Map/Elevation.h"
+#include "../Format/Map/File.h"
+#include "../Format/Map/Object.h"
+#include "../Format/Txt/MapsFile.h"
+#include "../Game/ExitMiscObject.h"
+#include "../Game/Location.h"
+#include "../Game/LocationElevation.h"
+#include "../Game/LocationPrefetcher.h"
+#include "../ResourceManager.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <chrono>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        LocationPrefetcher::LocationPrefetcher(Location& location, size_t memoryBudget)
+        {
+            auto resourceManager = ResourceManager::getInstance();
+            _batch = resourceManager->startPrefetch(memoryBudget);
+
+            std::string currentName = location.name();
+            std::transform(currentName.begin(), currentName.end(), currentName.begin(), ::tolower);
+
+            auto& maps = resourceManager->mapsTxt()->maps();
+            for (auto& elevation : *location.elevations()) {
+                for (auto object : *elevation->objects()) {
+                    auto exitGrid = dynamic_cast<ExitMiscObject*>(object);
+                    // negative numbers lead to the world map
+                    if (!exitGrid || exitGrid->exitMapNumber() < 0 || static_cast<size_t>(exitGrid->exitMapNumber()) >= maps.size()) {
+                        continue;
+                    }
+
+                    std::string name = maps.at(exitGrid->exitMapNumber()).name;
+                    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                    if (name == currentName) {
+                        continue;
+                    }
+
+                    // same path as GameLocationHelper::getByName() uses
+                    std::string filename = "maps/" + name + ".map";
+                    if (_requested.insert(filename).second && resourceManager->prefetch(_batch, filename)) {
+                        _maps.push_back(filename);
+                    }
+                }
+            }
+        }
+
+        LocationPrefetcher::~LocationPrefetcher()
+        {
+            ResourceManager::getInstance()->cancelPrefetch(_batch);
+        }
+
+        void LocationPrefetcher::think(double budget)
+        {
+            if (_nextMap == _maps.size() && _nextFile == _files.size()) {
+                return;
+            }
+
+            auto resourceManager = ResourceManager::getInstance();
+            auto start = std::chrono::steady_clock::now();
+            auto timeLeft = [&start, budget]() {
+                std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+                return elapsed.count() < budget;
+            };
+
+            // maps come first, their contents tell what else to read
+            while (_nextMap != _maps.size() && timeLeft()) {
+                auto& filename = _maps[_nextMap];
+                if (resourceManager->prefetching(filename)) {
+                    return;
+                }
+                _parseMap(filename);
+                ++_nextMap;
+            }
+
+            while (_nextFile != _files.size() && timeLeft()) {
+                auto& file = _files[_nextFile];
+                if (resourceManager->prefetching(file.filename)) {
+                    return;
+                }
+                // files dropped from the budget or already loaded are skipped
+                if (resourceManager->prefetched(file.filename)) {
+                    switch (file.type) {
+                        case Type::FRM:
+                            resourceManager->frmFileType(file.filename);
+                            break;
+                        case Type::GAM:
+                            resourceManager->gamFileType(file.filename);
+                            break;
+                        case Type::INT:
+                            resourceManager->intFileType(file.SID);
+                            break;
+                    }
+                }
+                ++_nextFile;
+            }
+        }
+
+        void LocationPrefetcher::_parseMap(const std::string& filename)
+        {
+            auto resourceManager = ResourceManager::getInstance();
+            // takes the prefetched data, the parsed map stays in the resource cache
+            auto mapFile = resourceManager->mapFileType(filename);
+            if (!mapFile) {
+                return;
+            }
+
+            // see Location::loadFromMapFile()
+            _request(filename.substr(0, filename.size() - 4) + ".gam", Type::GAM);
+            if (mapFile->scriptId() > 0) {
+                _requestScript(mapFile->scriptId() - 1);
+            }
+
+            auto tilesLst = resourceManager->lstFileType("art/tiles/tiles.lst");
+            for (auto& elevation : mapFile->elevations()) {
+                for (auto& object : elevation.objects()) {
+                    _request(resourceManager->FIDtoFrmName(object->FID()), Type::FRM);
+                    if (object->scriptId() > 0) {
+                        _requestScript(object->scriptId());
+                    }
+                    if (object->mapScriptId() > 0) {
+                        _requestScript(object->mapScriptId());
+                    }
+                }
+                for (auto tiles : {&elevation.floorTiles(), &elevation.roofTiles()}) {
+                    for (auto tileNum : *tiles) {
+                        if (tileNum > 1 && tileNum < tilesLst->strings()->size()) {
+                            _request("art/tiles/" + tilesLst->strings()->at(tileNum), Type::FRM);
+                        }
+                    }
+                }
+            }
+        }
+
+        void LocationPrefetcher::_request(const std::string& filename, Type type)
+        {
+            if (filename.empty() || !_requested.insert(filename).second) {
+                return;
+            }
+            if (ResourceManager::getInstance()->prefetch(_batch, filename)) {
+                _files.push_back(File{filename, type, 0});
+            }
+        }
+
+        void LocationPrefetcher::_requestScript(int SID)
+        {
+            auto scriptsLst = ResourceManager::getInstance()->lstFileType("scripts/scripts.lst");
+            if (SID < 0 || static_cast<size_t>(SID) >= scriptsLst->strings()->size()) {
+                return;
+            }
+            std::string filename = "scripts/" + scriptsLst->strings()->at(SID);
+            if (!_requested.insert(filename).second) {
+                return;
+            }
+            if (ResourceManager::getInstance()->prefetch(_batch, filename)) {
+                _files.push_back(File{filename, Type::INT, static_cast<unsigned int>(SID)});
+            }
+        }
+    }
+}
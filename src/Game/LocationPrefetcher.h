@@ -0,0 +1,62 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        class Location;
+
+        /**
+         * Warms up maps reachable through exit grids of a location, so walking into them doesn't stall.
+         * DAT reads happen on the resource manager's background thread; map parsing and warming of
+         * read files into the resource cache are spread over frames on the main thread.
+         * Everything not used yet is dropped when the prefetcher is destroyed, i.e. when the player leaves.
+         */
+        class LocationPrefetcher final
+        {
+            public:
+                LocationPrefetcher(Location& location, size_t memoryBudget);
+                ~LocationPrefetcher();
+
+                // Advances prefetching, spending about budget milliseconds
+                void think(double budget);
+
+            private:
+                enum class Type
+                {
+                    FRM,
+                    GAM,
+                    INT
+                };
+
+                struct File
+                {
+                    std::string filename;
+                    Type type;
+                    // scripts are warmed by SID, so the SID cache is filled too
+                    unsigned int SID;
+                };
+
+                unsigned int _batch = 0;
+                std::vector<std::string> _maps;
+                size_t _nextMap = 0;
+                std::vector<File> _files;
+                size_t _nextFile = 0;
+                std::unordered_set<std::string> _requested;
+
+                void _parseMap(const std::string& filename);
+                void _request(const std::string& filename, Type type);
+                void _requestScript(int SID);
+        };
+    }
+}
@@ -162,6 +162,7 @@ namespace Falltergeist
         void Object::setCanWalkThru(bool value)
         {
             _canWalkThru = value;
+            _updateHexagonBlockers();
         }
 
         bool Object::canLightThru() const
@@ -172,6 +173,7 @@ namespace Falltergeist
         void Object::setCanLightThru(bool value)
         {
             _canLightThru = value;
+            _updateHexagonBlockers();
         }
 
         bool Object::canShootThru() const
@@ -182,6 +184,7 @@ namespace Falltergeist
         void Object::setCanShootThru(bool value)
         {
             _canShootThru = value;
+            _updateHexagonBlockers();
         }
 
         bool Object::wallTransEnd() const
@@ -241,14 +244,10 @@ namespace Falltergeist
                 return;
             }
 
-            auto camera = Game::getInstance()->locationState()->camera();
-            _ui->setPosition(
-                hexagon()->position()
-                - camera->topLeft()
-                - Graphics::Point(_ui->size().width() / 2, _ui->size().height())
-            );
+            _updateScreenPosition();
 
             // don't draw if outside of screen
+            auto camera = Game::getInstance()->locationState()->camera();
             if (!Graphics::Rect::intersects(_ui->position(), _ui->size(), Graphics::Point(0, 0), camera->size())) {
                 setInRender(false);
                 return;
@@ -283,9 +282,34 @@ namespace Falltergeist
 
         void Object::setInRender(bool value)
         {
+            if (_inRender != value) {
+                Game::getInstance()->locationState()->invalidateHitTest();
+            }
             _inRender = value;
         }
 
+        void Object::_updateScreenPosition()
+        {
+            auto camera = Game::getInstance()->locationState()->camera();
+            _ui->setPosition(
+                hexagon()->position()
+                - camera->topLeft()
+                - Graphics::Point(_ui->size().width() / 2, _ui->size().height())
+            );
+
+            if (_ui.get() != _screenUi
+                || _ui->position() != _screenPosition
+                || _ui->offset() != _screenOffset
+                || _ui->size() != _screenSize
+            ) {
+                _screenUi = _ui.get();
+                _screenPosition = _ui->position();
+                _screenOffset = _ui->offset();
+                _screenSize = _ui->size();
+                Game::getInstance()->locationState()->invalidateHitTest();
+            }
+        }
+
         void Object::description_p_proc()
         {
             Logger::info("SCRIPT") << "description_p_proc() - 0x" << std::hex << PID() << " " << name() << " "
@@ -499,6 +523,18 @@ namespace Falltergeist
         void Object::setFlat(bool value)
         {
             _flat = value;
+            _updateHexagonBlockers();
+        }
+
+        void Object::_updateHexagonBlockers()
+        {
+            if (_position < 0) {
+                return;
+            }
+            auto location = Game::getInstance()->locationState();
+            if (location && location->hexagonGrid()) {
+                location->hexagonGrid()->at(_position)->updateBlockers();
+            }
         }
 
         unsigned int Object::defaultFrame()
@@ -522,14 +558,10 @@ namespace Falltergeist
                 return;
             }
 
-            auto camera = Game::getInstance()->locationState()->camera();
-            _ui->setPosition(
-                    hexagon()->position()
-                    - camera->topLeft()
-                    - Graphics::Point(_ui->size().width() / 2, _ui->size().height())
-            );
+            _updateScreenPosition();
 
             // don't draw if outside of screen
+            auto camera = Game::getInstance()->locationState()->camera();
             if (!Graphics::Rect::intersects(_ui->position(), _ui->size(), Graphics::Point(0, 0), camera->size())) {
                 setInRender(false);
                 return;
@@ -240,6 +240,12 @@ namespace Falltergeist
             protected:
                 virtual void _generateUi();
 
+                // Refreshes blocking state of the hex the object stands on
+                void _updateHexagonBlockers();
+
+                // Places the UI on screen and tells the location when its hit test bounds have changed
+                void _updateScreenPosition();
+
                 bool _canWalkThru = true;
 
                 bool _canLightThru = false;
@@ -278,6 +284,15 @@ namespace Falltergeist
 
                 bool _inRender = false;
 
+                // UI bounds as of the last render, used to detect camera scrolling and frame changes
+                UI::Base* _screenUi = nullptr;
+
+                Graphics::Point _screenPosition;
+
+                Graphics::Point _screenOffset;
+
+                Graphics::Size _screenSize;
+
                 Graphics::TransFlags::Trans _trans = Graphics::TransFlags::Trans::DEFAULT;
 
                 Orientation _lightOrientation;
@@ -0,0 +1,96 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        /**
+         * Groups objects placed on the map by their PID, so scripts don't have to scan the whole map.
+         * T should provide int PID(). Objects are referenced, not owned.
+         */
+        template <typename T>
+        class PidIndex final
+        {
+            public:
+                void add(T* object)
+                {
+                    _objects[object->PID()].push_back(object);
+                }
+
+                void remove(T* object)
+                {
+                    auto it = _objects.find(object->PID());
+                    if (it == _objects.end()) {
+                        return;
+                    }
+                    auto& objects = it->second;
+                    auto found = std::find(objects.begin(), objects.end(), object);
+                    if (found != objects.end()) {
+                        objects.erase(found);
+                    }
+                    if (objects.empty()) {
+                        _objects.erase(it);
+                    }
+                }
+
+                void clear()
+                {
+                    _objects.clear();
+                }
+
+                const std::vector<T*>& objects(int PID) const
+                {
+                    static const std::vector<T*> none;
+                    auto it = _objects.find(PID);
+                    return it != _objects.end() ? it->second : none;
+                }
+
+                // First object with given PID among the objects of some place, e.g. a hexagon.
+                // isThere tells whether an object of the index is at that place.
+                // Walks whichever list is shorter: objects with the PID or objects of the place.
+                // Places with a few objects are walked right away, that is cheaper than the hash lookup.
+                template <typename Container, typename Predicate>
+                T* find(int PID, const Container& objectsThere, Predicate isThere) const
+                {
+                    if (objectsThere.size() <= SHORT_PLACE) {
+                        return _findThere(PID, objectsThere, isThere);
+                    }
+                    auto& withPID = objects(PID);
+                    if (withPID.size() <= objectsThere.size()) {
+                        for (auto object : withPID) {
+                            if (isThere(object)) {
+                                return object;
+                            }
+                        }
+                        return nullptr;
+                    }
+                    return _findThere(PID, objectsThere, isThere);
+                }
+
+            private:
+                static constexpr size_t SHORT_PLACE = 8;
+
+                std::unordered_map<int, std::vector<T*>> _objects;
+
+                template <typename Container, typename Predicate>
+                static T* _findThere(int PID, const Container& objectsThere, Predicate isThere)
+                {
+                    for (auto object : objectsThere) {
+                        if (object->PID() == PID && isThere(object)) {
+                            return object;
+                        }
+                    }
+                    return nullptr;
+                }
+        };
+    }
+}
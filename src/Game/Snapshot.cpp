@@ -0,0 +1,463 @@
+// Project includes
+#include "../CrossPlatform.h"
+#include "../Exception.h"
+#include "../Game/ArmorItemObject.h"
+#include "../Game/ContainerItemObject.h"
+#include "../Game/CritterObject.h"
+#include "../Game/DoorSceneryObject.h"
+#include "../Game/DudeObject.h"
+#include "../Game/Game.h"
+#include "../Game/ItemObject.h"
+#include "../Game/Location.h"
+#include "../Game/LocationElevation.h"
+#include "../Game/ObjectFactory.h"
+#include "../Game/Snapshot.h"
+#include "../Game/SnapshotData.h"
+#include "../Game/SpatialObject.h"
+#include "../Game/Time.h"
+#include "../Helpers/GameLocationHelper.h"
+#include "../ILogger.h"
+#include "../PathFinding/Hexagon.h"
+#include "../ResourceManager.h"
+#include "../State/Location.h"
+#include "../UI/ResourceManager.h"
+#include "../VM/Script.h"
+#include "../VM/StackValue.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        namespace
+        {
+            SnapshotData::Object saveObject(Object* object)
+            {
+                SnapshotData::Object record;
+                record.PID = object->PID();
+                record.FID = object->FID();
+                record.SID = object->SID();
+                record.position = object->hexagon() ? static_cast<int32_t>(object->hexagon()->number()) : object->position();
+                record.elevation = object->elevation();
+                record.orientation = object->orientation();
+                record.lightOrientation = static_cast<uint8_t>(object->lightOrientation());
+                record.lightRadius = object->lightRadius();
+                record.lightIntensity = object->lightIntensity();
+                record.flags |= object->flat() ? SnapshotData::FLAG_FLAT : 0;
+                record.flags |= object->canWalkThru() ? SnapshotData::FLAG_WALK_THRU : 0;
+                record.flags |= object->canLightThru() ? SnapshotData::FLAG_LIGHT_THRU : 0;
+                record.flags |= object->canShootThru() ? SnapshotData::FLAG_SHOOT_THRU : 0;
+                record.flags |= object->wallTransEnd() ? SnapshotData::FLAG_WALL_TRANS_END : 0;
+                record.trans = static_cast<uint8_t>(object->trans());
+
+                if (auto item = dynamic_cast<ItemObject*>(object)) {
+                    record.amount = item->amount();
+                }
+                auto door = dynamic_cast<DoorSceneryObject*>(object);
+                record.opened = door && door->opened();
+                auto critter = dynamic_cast<CritterObject*>(object);
+                record.hitPoints = critter ? critter->hitPoints() : 0;
+
+                std::vector<ItemObject*>* inventory = nullptr;
+                if (critter) {
+                    inventory = critter->inventory();
+                } else if (auto container = dynamic_cast<ContainerItemObject*>(object)) {
+                    inventory = container->inventory();
+                }
+                if (inventory) {
+                    for (auto inventoryItem : *inventory) {
+                        record.inventory.push_back(saveObject(inventoryItem));
+                    }
+                }
+
+                if (object->script()) {
+                    for (auto& value : *object->script()->LVARS()) {
+                        SnapshotData::Variable variable;
+                        // strings and object references are not kept between sessions
+                        if (value.type() == VM::StackValue::Type::FLOAT) {
+                            variable.isFloat = true;
+                            variable.floatValue = value.floatValue();
+                        } else if (value.type() == VM::StackValue::Type::INTEGER) {
+                            variable.integerValue = value.integerValue();
+                        }
+                        record.LVARS.push_back(variable);
+                    }
+                }
+                return record;
+            }
+
+            std::unique_ptr<SnapshotData::Object> saveOptionalObject(Object* object)
+            {
+                return object ? std::make_unique<SnapshotData::Object>(saveObject(object)) : nullptr;
+            }
+
+            std::unique_ptr<ItemObject> restoreItem(const SnapshotData::Object& record, ObjectFactory& objectFactory);
+
+            std::unique_ptr<Object> restoreObject(const SnapshotData::Object& record, ObjectFactory& objectFactory)
+            {
+                std::unique_ptr<Object> object(objectFactory.createObjectByPID(record.PID));
+                if (!object) {
+                    throw Exception("Snapshot - can't create object with PID: " + std::to_string(record.PID));
+                }
+
+                // flags are applied before the position, so old map grid is not touched
+                object->setFlat(record.flags & SnapshotData::FLAG_FLAT);
+                object->setCanWalkThru(record.flags & SnapshotData::FLAG_WALK_THRU);
+                object->setCanLightThru(record.flags & SnapshotData::FLAG_LIGHT_THRU);
+                object->setCanShootThru(record.flags & SnapshotData::FLAG_SHOOT_THRU);
+                object->setWallTransEnd(record.flags & SnapshotData::FLAG_WALL_TRANS_END);
+                object->setTrans(static_cast<Graphics::TransFlags::Trans>(record.trans));
+                object->setFID(record.FID);
+                object->setElevation(record.elevation);
+                object->setOrientation(record.orientation);
+                object->setLightOrientation(record.lightOrientation);
+                object->setLightRadius(record.lightRadius);
+                object->setLightIntensity(record.lightIntensity);
+                object->setPosition(record.position);
+
+                if (auto item = dynamic_cast<ItemObject*>(object.get())) {
+                    item->setAmount(record.amount);
+                }
+                if (auto door = dynamic_cast<DoorSceneryObject*>(object.get())) {
+                    door->setOpened(record.opened);
+                }
+                auto critter = dynamic_cast<CritterObject*>(object.get());
+                if (critter) {
+                    critter->setHitPoints(record.hitPoints);
+                }
+
+                std::vector<ItemObject*>* inventory = nullptr;
+                if (critter) {
+                    inventory = critter->inventory();
+                } else if (auto container = dynamic_cast<ContainerItemObject*>(object.get())) {
+                    inventory = container->inventory();
+                }
+                if (!record.inventory.empty() && !inventory) {
+                    throw Exception("Snapshot - object without inventory has items, PID: " + std::to_string(record.PID));
+                }
+                if (inventory) {
+                    // prototype inventory is replaced by the saved one
+                    inventory->clear();
+                    inventory->reserve(record.inventory.size());
+                    for (auto& itemRecord : record.inventory) {
+                        inventory->push_back(restoreItem(itemRecord, objectFactory).release());
+                    }
+                }
+
+                if (record.SID > 0) {
+                    auto intFile = ResourceManager::getInstance()->intFileType(record.SID);
+                    if (intFile) {
+                        object->setScript(std::make_unique<VM::Script>(std::move(intFile), object.get()));
+                        object->setSID(record.SID);
+                    }
+                }
+                if (object->script()) {
+                    auto LVARS = object->script()->LVARS();
+                    LVARS->clear();
+                    for (auto& variable : record.LVARS) {
+                        LVARS->push_back(variable.isFloat ? VM::StackValue(variable.floatValue) : VM::StackValue(static_cast<int>(variable.integerValue)));
+                    }
+                }
+                return object;
+            }
+
+            std::unique_ptr<ItemObject> restoreItem(const SnapshotData::Object& record, ObjectFactory& objectFactory)
+            {
+                auto object = restoreObject(record, objectFactory);
+                if (!dynamic_cast<ItemObject*>(object.get())) {
+                    throw Exception("Snapshot - inventory object is not an item");
+                }
+                return std::unique_ptr<ItemObject>(static_cast<ItemObject*>(object.release()));
+            }
+
+            std::unique_ptr<ItemObject> restoreOptionalItem(const std::unique_ptr<SnapshotData::Object>& record, ObjectFactory& objectFactory)
+            {
+                return record ? restoreItem(*record, objectFactory) : nullptr;
+            }
+        }
+
+        bool Snapshot::save(const std::string& filename)
+        {
+            auto game = Game::getInstance();
+            auto locationState = game->locationState();
+            if (!locationState) {
+                return false;
+            }
+            auto location = locationState->location();
+            auto player = game->player();
+
+            SnapshotData snapshot;
+
+            auto gameTime = game->gameTime();
+            snapshot.time = {
+                gameTime->_ticks,
+                gameTime->_milliseconds,
+                gameTime->_seconds,
+                gameTime->_minutes,
+                gameTime->_hours,
+                gameTime->_day,
+                gameTime->_month,
+                gameTime->_year
+            };
+
+            snapshot.GVARS.assign(game->GVARS().begin(), game->GVARS().end());
+
+            snapshot.location = location->name();
+            snapshot.elevation = locationState->elevation();
+            snapshot.MVARS = *location->MVARS();
+            snapshot.playerPosition = player->hexagon() ? static_cast<int32_t>(player->hexagon()->number()) : player->position();
+            snapshot.playerOrientation = player->orientation();
+
+            auto& playerRecord = snapshot.player;
+            playerRecord.name = player->name();
+            playerRecord.gender = player->gender();
+            playerRecord.age = player->age();
+            for (unsigned i = 0; i != SnapshotData::STATS; i++) {
+                playerRecord.stats[i] = {player->stat((STAT)i), player->statBonus((STAT)i)};
+            }
+            for (unsigned i = 0; i != SnapshotData::SKILLS; i++) {
+                playerRecord.skills[i] = {player->skillTagged((SKILL)i), player->skillGainedValue((SKILL)i)};
+            }
+            for (unsigned i = 0; i != SnapshotData::TRAITS; i++) {
+                playerRecord.traits[i] = player->traitTagged((TRAIT)i);
+            }
+            playerRecord.hitPoints = player->hitPoints();
+            playerRecord.poisonLevel = player->poisonLevel();
+            playerRecord.radiationLevel = player->radiationLevel();
+            playerRecord.experience = player->experience();
+            playerRecord.level = player->level();
+            playerRecord.statsPoints = player->statsPoints();
+            playerRecord.skillsPoints = player->skillsPoints();
+            for (auto item : *player->inventory()) {
+                playerRecord.inventory.push_back(saveObject(item));
+            }
+            playerRecord.armorSlot = saveOptionalObject(player->armorSlot());
+            playerRecord.leftHandSlot = saveOptionalObject(player->leftHandSlot());
+            playerRecord.rightHandSlot = saveOptionalObject(player->rightHandSlot());
+
+            // objects of current elevation come from the running state, other elevations are as they were loaded
+            std::vector<Object*> objects;
+            for (auto& object : locationState->flatObjects()) {
+                objects.push_back(object.get());
+            }
+            for (auto& object : locationState->objects()) {
+                if (object != player) {
+                    objects.push_back(object.get());
+                }
+            }
+            for (unsigned int i = 0; i != location->elevations()->size(); ++i) {
+                if (i == locationState->elevation()) {
+                    continue;
+                }
+                for (auto object : *location->elevations()->at(i)->objects()) {
+                    if (!dynamic_cast<SpatialObject*>(object)) {
+                        objects.push_back(object);
+                    }
+                }
+            }
+
+            // timer events refer to objects by index, the player is 0
+            std::unordered_map<Object*, uint32_t> indices;
+            indices.emplace(player.get(), 0);
+            for (auto object : objects) {
+                indices.emplace(object, static_cast<uint32_t>(indices.size()));
+                snapshot.objects.push_back(saveObject(object));
+            }
+
+            locationState->timerEvents().forEach([&indices, &snapshot](Object* object, double remaining, int fixedParam) {
+                auto it = indices.find(object);
+                // events of objects which are gone for good are dropped
+                if (it != indices.end()) {
+                    snapshot.timers.push_back(SnapshotData::Timer{it->second, remaining, fixedParam});
+                }
+            });
+
+            auto data = snapshot.write();
+
+            auto directoryDelimiter = filename.find_last_of('/');
+            if (directoryDelimiter != std::string::npos) {
+                CrossPlatform::createDirectory(filename.substr(0, directoryDelimiter));
+            }
+            std::string temporaryFilename = filename + ".tmp";
+            {
+                std::ofstream stream(temporaryFilename, std::ios::binary | std::ios::trunc);
+                if (!stream.is_open()) {
+                    return false;
+                }
+                stream.write(data.data(), data.size());
+                if (!stream) {
+                    return false;
+                }
+            }
+            std::remove(filename.c_str());
+            return std::rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+        }
+
+        bool Snapshot::load(const std::string& filename)
+        {
+            std::ifstream stream(filename, std::ios::binary);
+            if (!stream.is_open()) {
+                return false;
+            }
+            std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+            auto game = Game::getInstance();
+            auto player = game->player();
+
+            try {
+                SnapshotData snapshot;
+                if (!snapshot.read(data)) {
+                    game->logger()->warning() << "[GAME] Snapshot::load() - unsupported save file: " << filename << std::endl;
+                    return false;
+                }
+
+                // All objects are created before anything is changed, a broken file leaves the current game as it is
+
+                Helpers::GameLocationHelper gameLocationHelper(game->logger());
+                auto location = gameLocationHelper.getByName(snapshot.location);
+                if (!location || snapshot.elevation >= location->elevations()->size()) {
+                    throw Exception("Snapshot::load() - can't load location: " + snapshot.location);
+                }
+
+                ObjectFactory objectFactory(game->logger());
+
+                std::vector<std::unique_ptr<Object>> objects;
+                objects.reserve(snapshot.objects.size());
+                for (auto& record : snapshot.objects) {
+                    if (record.elevation < 0 || static_cast<size_t>(record.elevation) >= location->elevations()->size()) {
+                        throw Exception("Snapshot::load() - object elevation out of range");
+                    }
+                    objects.push_back(restoreObject(record, objectFactory));
+                }
+
+                auto& playerRecord = snapshot.player;
+                std::vector<std::unique_ptr<ItemObject>> inventory;
+                inventory.reserve(playerRecord.inventory.size());
+                for (auto& record : playerRecord.inventory) {
+                    inventory.push_back(restoreItem(record, objectFactory));
+                }
+                std::unique_ptr<ItemObject> armor = restoreOptionalItem(playerRecord.armorSlot, objectFactory);
+                if (armor && !dynamic_cast<ArmorItemObject*>(armor.get())) {
+                    throw Exception("Snapshot::load() - armor slot holds not an armor");
+                }
+                std::unique_ptr<ItemObject> leftHand = restoreOptionalItem(playerRecord.leftHandSlot, objectFactory);
+                std::unique_ptr<ItemObject> rightHand = restoreOptionalItem(playerRecord.rightHandSlot, objectFactory);
+
+                // everything is read, nothing below throws on bad data
+
+                location->MVARS()->assign(snapshot.MVARS.begin(), snapshot.MVARS.end());
+                location->setDefaultElevationIndex(snapshot.elevation);
+                location->setDefaultPosition(static_cast<unsigned int>(snapshot.playerPosition));
+                location->setDefaultOrientation(snapshot.playerOrientation);
+
+                // map objects are replaced by saved ones, spatial scripts stay as the map defines them
+                for (auto& elevation : *location->elevations()) {
+                    auto elevationObjects = elevation->objects();
+                    auto spatials = std::remove_if(elevationObjects->begin(), elevationObjects->end(), [](Object* object) {
+                        if (dynamic_cast<SpatialObject*>(object)) {
+                            return false;
+                        }
+                        delete object;
+                        return true;
+                    });
+                    elevationObjects->erase(spatials, elevationObjects->end());
+                }
+                // object index 0 is the player, the rest are saved map objects
+                std::vector<Object*> timerObjects{player.get()};
+                for (auto& object : objects) {
+                    timerObjects.push_back(object.get());
+                    location->elevations()->at(object->elevation())->objects()->push_back(object.release());
+                }
+
+                player->setName(playerRecord.name);
+                player->setGender(playerRecord.gender);
+                player->setAge(playerRecord.age);
+                for (unsigned i = 0; i != SnapshotData::STATS; i++) {
+                    player->setStat((STAT)i, playerRecord.stats[i].first);
+                    player->setStatBonus((STAT)i, playerRecord.stats[i].second);
+                }
+                for (unsigned i = 0; i != SnapshotData::SKILLS; i++) {
+                    player->setSkillTagged((SKILL)i, playerRecord.skills[i].first);
+                    player->setSkillGainedValue((SKILL)i, playerRecord.skills[i].second);
+                }
+                for (unsigned i = 0; i != SnapshotData::TRAITS; i++) {
+                    player->setTraitTagged((TRAIT)i, playerRecord.traits[i]);
+                }
+                player->setHitPoints(playerRecord.hitPoints);
+                player->setPoisonLevel(playerRecord.poisonLevel);
+                player->setRadiationLevel(playerRecord.radiationLevel);
+                player->setExperience(playerRecord.experience);
+                player->setLevel(playerRecord.level);
+                player->setStatsPoints(playerRecord.statsPoints);
+                player->setSkillsPoints(playerRecord.skillsPoints);
+                player->inventory()->clear();
+                for (auto& item : inventory) {
+                    player->inventory()->push_back(item.release());
+                }
+                player->setArmorSlot(dynamic_cast<ArmorItemObject*>(armor.release()));
+                player->setLeftHandSlot(leftHand.release());
+                player->setRightHandSlot(rightHand.release());
+
+                auto gameTime = game->gameTime();
+                gameTime->_ticks = snapshot.time[0];
+                gameTime->_milliseconds = snapshot.time[1];
+                gameTime->_seconds = snapshot.time[2];
+                gameTime->_minutes = snapshot.time[3];
+                gameTime->_hours = snapshot.time[4];
+                gameTime->_day = snapshot.time[5];
+                gameTime->_month = snapshot.time[6];
+                gameTime->_year = snapshot.time[7];
+
+                for (unsigned int i = 0; i != snapshot.GVARS.size() && i != game->GVARS().size(); ++i) {
+                    game->setGVAR(i, snapshot.GVARS[i]);
+                }
+
+                // TODO move this instantiation to StateLocationHelper or some kind of state manager
+                auto locationState = new State::Location(
+                    player,
+                    game->mouse(),
+                    game->settings(),
+                    game->renderer(),
+                    game->mixer(),
+                    game->gameTime(),
+                    std::make_shared<UI::ResourceManager>(),
+                    game->logger()
+                );
+                locationState->setElevation(snapshot.elevation);
+                locationState->setLocation(location);
+                locationState->setPlayerRestored(true);
+                game->setState(locationState);
+
+                for (auto& timer : snapshot.timers) {
+                    // timer events count in ticks of 100 ms
+                    auto ticks = static_cast<int>(timer.remaining / 100.0 + 0.5);
+                    locationState->addTimerEvent(timerObjects[timer.object], ticks > 0 ? ticks : 0, timer.fixedParam);
+                }
+            } catch (const Exception& e) {
+                game->logger()->error() << "[GAME] Snapshot::load() - " << filename << ": " << e.what() << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        std::string Snapshot::slotFilename(unsigned int slot)
+        {
+            std::string number = std::to_string(slot);
+            if (number.size() < 2) {
+                number.insert(0, 2 - number.size(), '0');
+            }
+            return CrossPlatform::getConfigPath() + "/savegame/slot" + number + ".sav";
+        }
+    }
+}
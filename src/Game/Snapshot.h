@@ -0,0 +1,32 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <string>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        /**
+         * Binary save game.
+         * Holds game clock, GVARs, player, current location with MVARs and objects of all its elevations,
+         * and pending timer events. The file starts with a section table, so sections may be added later
+         * without breaking older saves.
+         */
+        class Snapshot final
+        {
+            public:
+                // Saves current game, returns false if there is no location to save or the file can't be written
+                static bool save(const std::string& filename);
+
+                // Replaces current game with the saved one, returns false if the file is missing or broken
+                static bool load(const std::string& filename);
+
+                static std::string slotFilename(unsigned int slot);
+        };
+    }
+}
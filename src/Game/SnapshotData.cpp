@@ -0,0 +1,269 @@
+// Project includes
+#include "../Base/BinaryReader.h"
+#include "../Base/BinaryWriter.h"
+#include "../Exception.h"
+#include "../Game/SnapshotData.h"
+#include "../Game/SnapshotSections.h"
+
+// Third-party includes
+
+// stdlib
+#include <map>
+#include <unordered_map>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        namespace
+        {
+            const uint32_t SECTION_TIME = SnapshotSections::id("TIME");
+            const uint32_t SECTION_GVARS = SnapshotSections::id("GVAR");
+            const uint32_t SECTION_LOCATION = SnapshotSections::id("LOCN");
+            const uint32_t SECTION_PLAYER = SnapshotSections::id("PLYR");
+            const uint32_t SECTION_OBJECTS = SnapshotSections::id("OBJS");
+            const uint32_t SECTION_TIMERS = SnapshotSections::id("TIMR");
+
+            // same values as VM::StackValue::Type
+            const uint8_t VARIABLE_INTEGER = 1;
+            const uint8_t VARIABLE_FLOAT = 2;
+
+            // Object records are written recursively, with inventories inline
+            void writeObject(Base::BinaryWriter& writer, const SnapshotData::Object& object)
+            {
+                writer.write<int32_t>(object.PID);
+                writer.write<int32_t>(object.FID);
+                writer.write<int32_t>(object.SID);
+                writer.write<int32_t>(object.position);
+                writer.write<int32_t>(object.elevation);
+                writer.write<uint8_t>(object.orientation);
+                writer.write<uint8_t>(object.lightOrientation);
+                writer.write<uint32_t>(object.lightRadius);
+                writer.write<uint32_t>(object.lightIntensity);
+                writer.write<uint8_t>(object.flags);
+                writer.write<uint8_t>(object.trans);
+                writer.write<uint32_t>(object.amount);
+                writer.write<uint8_t>(object.opened ? 1 : 0);
+                writer.write<int32_t>(object.hitPoints);
+                writer.write<uint32_t>(static_cast<uint32_t>(object.inventory.size()));
+                for (auto& item : object.inventory) {
+                    writeObject(writer, item);
+                }
+                writer.write<uint32_t>(static_cast<uint32_t>(object.LVARS.size()));
+                for (auto& variable : object.LVARS) {
+                    if (variable.isFloat) {
+                        writer.write<uint8_t>(VARIABLE_FLOAT);
+                        writer.write<float>(variable.floatValue);
+                    } else {
+                        writer.write<uint8_t>(VARIABLE_INTEGER);
+                        writer.write<int32_t>(variable.integerValue);
+                    }
+                }
+            }
+
+            // optional object, e.g. an empty hand slot
+            void writeOptionalObject(Base::BinaryWriter& writer, const std::unique_ptr<SnapshotData::Object>& object)
+            {
+                writer.write<uint8_t>(object ? 1 : 0);
+                if (object) {
+                    writeObject(writer, *object);
+                }
+            }
+
+            void readObject(Base::BinaryReader& reader, SnapshotData::Object& object)
+            {
+                object.PID = reader.read<int32_t>();
+                object.FID = reader.read<int32_t>();
+                object.SID = reader.read<int32_t>();
+                object.position = reader.read<int32_t>();
+                object.elevation = reader.read<int32_t>();
+                object.orientation = reader.read<uint8_t>();
+                object.lightOrientation = reader.read<uint8_t>();
+                object.lightRadius = reader.read<uint32_t>();
+                object.lightIntensity = reader.read<uint32_t>();
+                object.flags = reader.read<uint8_t>();
+                object.trans = reader.read<uint8_t>();
+                object.amount = reader.read<uint32_t>();
+                object.opened = reader.read<uint8_t>() != 0;
+                object.hitPoints = reader.read<int32_t>();
+                // counts are not trusted for reserve(), a broken one runs out of data instead
+                auto items = reader.read<uint32_t>();
+                for (uint32_t i = 0; i != items; ++i) {
+                    object.inventory.emplace_back();
+                    readObject(reader, object.inventory.back());
+                }
+                auto variables = reader.read<uint32_t>();
+                for (uint32_t i = 0; i != variables; ++i) {
+                    SnapshotData::Variable variable;
+                    variable.isFloat = reader.read<uint8_t>() == VARIABLE_FLOAT;
+                    if (variable.isFloat) {
+                        variable.floatValue = reader.read<float>();
+                    } else {
+                        variable.integerValue = reader.read<int32_t>();
+                    }
+                    object.LVARS.push_back(variable);
+                }
+            }
+
+            std::unique_ptr<SnapshotData::Object> readOptionalObject(Base::BinaryReader& reader)
+            {
+                if (!reader.read<uint8_t>()) {
+                    return nullptr;
+                }
+                auto object = std::make_unique<SnapshotData::Object>();
+                readObject(reader, *object);
+                return object;
+            }
+        }
+
+        std::string SnapshotData::write() const
+        {
+            std::map<uint32_t, Base::BinaryWriter> sections;
+
+            auto& timeSection = sections[SECTION_TIME];
+            for (auto value : time) {
+                timeSection.write<uint32_t>(value);
+            }
+
+            sections[SECTION_GVARS].writeArray(GVARS);
+
+            auto& locationSection = sections[SECTION_LOCATION];
+            locationSection.writeString(location);
+            locationSection.write<uint32_t>(elevation);
+            locationSection.writeArray(MVARS);
+            locationSection.write<int32_t>(playerPosition);
+            locationSection.write<uint8_t>(playerOrientation);
+
+            auto& playerSection = sections[SECTION_PLAYER];
+            playerSection.writeString(player.name);
+            playerSection.write<uint8_t>(static_cast<uint8_t>(player.gender));
+            playerSection.write<uint32_t>(player.age);
+            for (auto& stat : player.stats) {
+                playerSection.write<int32_t>(stat.first);
+                playerSection.write<int32_t>(stat.second);
+            }
+            for (auto& skill : player.skills) {
+                playerSection.write<int32_t>(skill.first);
+                playerSection.write<int32_t>(skill.second);
+            }
+            for (auto trait : player.traits) {
+                playerSection.write<int32_t>(trait);
+            }
+            playerSection.write<int32_t>(player.hitPoints);
+            playerSection.write<int32_t>(player.poisonLevel);
+            playerSection.write<int32_t>(player.radiationLevel);
+            playerSection.write<int32_t>(player.experience);
+            playerSection.write<int32_t>(player.level);
+            playerSection.write<int32_t>(player.statsPoints);
+            playerSection.write<int32_t>(player.skillsPoints);
+            playerSection.write<uint32_t>(static_cast<uint32_t>(player.inventory.size()));
+            for (auto& item : player.inventory) {
+                writeObject(playerSection, item);
+            }
+            writeOptionalObject(playerSection, player.armorSlot);
+            writeOptionalObject(playerSection, player.leftHandSlot);
+            writeOptionalObject(playerSection, player.rightHandSlot);
+
+            auto& objectsSection = sections[SECTION_OBJECTS];
+            objectsSection.write<uint32_t>(static_cast<uint32_t>(objects.size()));
+            for (auto& object : objects) {
+                writeObject(objectsSection, object);
+            }
+
+            auto& timersSection = sections[SECTION_TIMERS];
+            timersSection.write<uint32_t>(static_cast<uint32_t>(timers.size()));
+            for (auto& timer : timers) {
+                timersSection.write<uint32_t>(timer.object);
+                timersSection.write<double>(timer.remaining);
+                timersSection.write<int32_t>(timer.fixedParam);
+            }
+
+            return SnapshotSections::write(sections);
+        }
+
+        bool SnapshotData::read(std::string_view data)
+        {
+            std::unordered_map<uint32_t, std::string_view> sections;
+            if (!SnapshotSections::read(data, sections)) {
+                return false;
+            }
+            for (auto id : {SECTION_TIME, SECTION_GVARS, SECTION_LOCATION, SECTION_PLAYER, SECTION_OBJECTS, SECTION_TIMERS}) {
+                if (!sections.count(id)) {
+                    throw Exception("SnapshotData::read() - section is missing");
+                }
+            }
+
+            SnapshotData result;
+
+            Base::BinaryReader timeReader(sections[SECTION_TIME]);
+            for (auto& value : result.time) {
+                value = timeReader.read<uint32_t>();
+            }
+
+            Base::BinaryReader GVARSReader(sections[SECTION_GVARS]);
+            GVARSReader.readArray(result.GVARS);
+
+            Base::BinaryReader locationReader(sections[SECTION_LOCATION]);
+            result.location = locationReader.readString();
+            result.elevation = locationReader.read<uint32_t>();
+            locationReader.readArray(result.MVARS);
+            result.playerPosition = locationReader.read<int32_t>();
+            result.playerOrientation = locationReader.read<uint8_t>();
+
+            Base::BinaryReader playerReader(sections[SECTION_PLAYER]);
+            auto& player = result.player;
+            player.name = playerReader.readString();
+            player.gender = static_cast<GENDER>(playerReader.read<uint8_t>());
+            player.age = playerReader.read<uint32_t>();
+            for (auto& stat : player.stats) {
+                stat.first = playerReader.read<int32_t>();
+                stat.second = playerReader.read<int32_t>();
+            }
+            for (auto& skill : player.skills) {
+                skill.first = playerReader.read<int32_t>();
+                skill.second = playerReader.read<int32_t>();
+            }
+            for (auto& trait : player.traits) {
+                trait = playerReader.read<int32_t>();
+            }
+            player.hitPoints = playerReader.read<int32_t>();
+            player.poisonLevel = playerReader.read<int32_t>();
+            player.radiationLevel = playerReader.read<int32_t>();
+            player.experience = playerReader.read<int32_t>();
+            player.level = playerReader.read<int32_t>();
+            player.statsPoints = playerReader.read<int32_t>();
+            player.skillsPoints = playerReader.read<int32_t>();
+            auto items = playerReader.read<uint32_t>();
+            for (uint32_t i = 0; i != items; ++i) {
+                player.inventory.emplace_back();
+                readObject(playerReader, player.inventory.back());
+            }
+            player.armorSlot = readOptionalObject(playerReader);
+            player.leftHandSlot = readOptionalObject(playerReader);
+            player.rightHandSlot = readOptionalObject(playerReader);
+
+            Base::BinaryReader objectsReader(sections[SECTION_OBJECTS]);
+            auto objectCount = objectsReader.read<uint32_t>();
+            for (uint32_t i = 0; i != objectCount; ++i) {
+                result.objects.emplace_back();
+                readObject(objectsReader, result.objects.back());
+            }
+
+            Base::BinaryReader timersReader(sections[SECTION_TIMERS]);
+            auto timerCount = timersReader.read<uint32_t>();
+            for (uint32_t i = 0; i != timerCount; ++i) {
+                Timer timer;
+                timer.object = timersReader.read<uint32_t>();
+                timer.remaining = timersReader.read<double>();
+                timer.fixedParam = timersReader.read<int32_t>();
+                if (timer.object > result.objects.size()) {
+                    throw Exception("SnapshotData::read() - timer event of unknown object");
+                }
+                result.timers.push_back(timer);
+            }
+
+            *this = std::move(result);
+            return true;
+        }
+    }
+}
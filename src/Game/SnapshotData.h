@@ -0,0 +1,130 @@
+#pragma once
+
+// Project includes
+#include "../Format/Enums.h"
+
+// Third-party includes
+
+// stdlib
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        /**
+         * Contents of a save file as plain values, see Snapshot.
+         * Snapshot fills it from the running game and applies it back, this class only reads and writes the sections.
+         */
+        class SnapshotData final
+        {
+            public:
+                static const uint8_t FLAG_FLAT = 1;
+                static const uint8_t FLAG_WALK_THRU = 2;
+                static const uint8_t FLAG_LIGHT_THRU = 4;
+                static const uint8_t FLAG_SHOOT_THRU = 8;
+                static const uint8_t FLAG_WALL_TRANS_END = 16;
+
+                static const unsigned int STATS = static_cast<unsigned int>(STAT::LUCK) + 1;
+                static const unsigned int SKILLS = static_cast<unsigned int>(SKILL::OUTDOORSMAN) + 1;
+                static const unsigned int TRAITS = static_cast<unsigned int>(TRAIT::GIFTED) + 1;
+
+                // Script local variable, strings and object references are saved as 0
+                struct Variable
+                {
+                    bool isFloat = false;
+                    int32_t integerValue = 0;
+                    float floatValue = 0;
+                };
+
+                struct Object
+                {
+                    int32_t PID = 0;
+                    int32_t FID = 0;
+                    int32_t SID = 0;
+                    // hexagon number or position of an object in inventory
+                    int32_t position = 0;
+                    int32_t elevation = 0;
+                    uint8_t orientation = 0;
+                    uint8_t lightOrientation = 0;
+                    uint32_t lightRadius = 0;
+                    uint32_t lightIntensity = 0;
+                    uint8_t flags = 0;
+                    uint8_t trans = 0;
+                    uint32_t amount = 1;
+                    bool opened = false;
+                    int32_t hitPoints = 0;
+                    std::vector<Object> inventory;
+                    std::vector<Variable> LVARS;
+                };
+
+                struct Player
+                {
+                    std::string name;
+                    GENDER gender = GENDER::MALE;
+                    uint32_t age = 0;
+                    // (value, bonus) of every stat
+                    std::array<std::pair<int32_t, int32_t>, STATS> stats{};
+                    // (tagged, gained value) of every skill
+                    std::array<std::pair<int32_t, int32_t>, SKILLS> skills{};
+                    std::array<int32_t, TRAITS> traits{};
+                    int32_t hitPoints = 0;
+                    int32_t poisonLevel = 0;
+                    int32_t radiationLevel = 0;
+                    int32_t experience = 0;
+                    int32_t level = 0;
+                    int32_t statsPoints = 0;
+                    int32_t skillsPoints = 0;
+                    std::vector<Object> inventory;
+                    // empty slots are null
+                    std::unique_ptr<Object> armorSlot;
+                    std::unique_ptr<Object> leftHandSlot;
+                    std::unique_ptr<Object> rightHandSlot;
+                };
+
+                struct Timer
+                {
+                    // 0 is the player, the rest are indices in objects plus one
+                    uint32_t object = 0;
+                    // milliseconds left
+                    double remaining = 0;
+                    int32_t fixedParam = 0;
+                };
+
+                // ticks, milliseconds, seconds, minutes, hours, day, month, year
+                std::array<uint32_t, 8> time{};
+
+                std::vector<int32_t> GVARS;
+
+                std::string location;
+
+                uint32_t elevation = 0;
+
+                std::vector<int32_t> MVARS;
+
+                int32_t playerPosition = 0;
+
+                uint8_t playerOrientation = 0;
+
+                Player player;
+
+                // map objects of all elevations, without the player and spatial scripts
+                std::vector<Object> objects;
+
+                std::vector<Timer> timers;
+
+                // Returns the whole save file
+                std::string write() const;
+
+                // Returns false if data is not a save file of this version, throws Exception if it is a broken one.
+                // Nothing is changed when reading fails.
+                bool read(std::string_view data);
+        };
+    }
+}
@@ -0,0 +1,75 @@
+// Project includes
+#include "../Base/BinaryReader.h"
+#include "../Exception.h"
+#include "../Game/SnapshotSections.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstring>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        namespace
+        {
+            const char MAGIC[4] = {'F', 'G', 'S', 'V'};
+
+            const uint32_t VERSION = 1;
+
+            // snapshots are written in host byte order
+            const uint32_t BYTE_ORDER_MARK = 0x01020304;
+        }
+
+        std::string SnapshotSections::write(const std::map<uint32_t, Base::BinaryWriter>& sections)
+        {
+            Base::BinaryWriter writer;
+            for (auto c : MAGIC) {
+                writer.write<char>(c);
+            }
+            writer.write<uint32_t>(VERSION);
+            writer.write<uint32_t>(BYTE_ORDER_MARK);
+            writer.write<uint32_t>(static_cast<uint32_t>(sections.size()));
+            uint32_t offset = static_cast<uint32_t>(writer.size() + sections.size() * 3 * sizeof(uint32_t));
+            for (auto& section : sections) {
+                writer.write<uint32_t>(section.first);
+                writer.write<uint32_t>(offset);
+                writer.write<uint32_t>(static_cast<uint32_t>(section.second.size()));
+                offset += static_cast<uint32_t>(section.second.size());
+            }
+
+            std::string data;
+            data.reserve(offset);
+            data.append(writer.data());
+            for (auto& section : sections) {
+                data.append(section.second.data());
+            }
+            return data;
+        }
+
+        bool SnapshotSections::read(std::string_view data, std::unordered_map<uint32_t, std::string_view>& sections)
+        {
+            Base::BinaryReader header(data);
+            if (data.size() < sizeof(MAGIC)
+                || std::memcmp(header.readBytes(sizeof(MAGIC)).data(), MAGIC, sizeof(MAGIC)) != 0
+                || header.read<uint32_t>() != VERSION
+                || header.read<uint32_t>() != BYTE_ORDER_MARK
+            ) {
+                return false;
+            }
+
+            auto count = header.read<uint32_t>();
+            for (uint32_t i = 0; i != count; ++i) {
+                auto id = header.read<uint32_t>();
+                auto offset = header.read<uint32_t>();
+                auto size = header.read<uint32_t>();
+                if (offset > data.size() || size > data.size() - offset) {
+                    throw Exception("SnapshotSections::read() - section out of file bounds");
+                }
+                sections.emplace(id, data.substr(offset, size));
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+// Project includes
+#include "../Base/BinaryWriter.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        /**
+         * Framing of save files: magic, version and byte order mark, then a table of (id, offset, size)
+         * entries followed by the data of each section. Sections a reader doesn't know are skipped.
+         */
+        class SnapshotSections final
+        {
+            public:
+                // Section id from four characters, e.g. id("TIME")
+                static constexpr uint32_t id(const char (&name)[5])
+                {
+                    return static_cast<uint32_t>(name[0])
+                        | static_cast<uint32_t>(name[1]) << 8
+                        | static_cast<uint32_t>(name[2]) << 16
+                        | static_cast<uint32_t>(name[3]) << 24;
+                }
+
+                // Returns the whole file, sections are stored in id order
+                static std::string write(const std::map<uint32_t, Base::BinaryWriter>& sections);
+
+                // Fills sections with views into data. Returns false if data is not a save file of this version,
+                // throws Exception if it is one but the header or section table is broken.
+                static bool read(std::string_view data, std::unordered_map<uint32_t, std::string_view>& sections);
+        };
+    }
+}
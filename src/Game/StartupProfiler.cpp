@@ -0,0 +1,78 @@
+// Project includes
+#include "../Game/StartupProfiler.h"
+#include "../ILogger.h"
+
+// Third-party includes
+
+// stdlib
+#include <iomanip>
+#include <sstream>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        bool StartupProfiler::_enabled = false;
+        bool StartupProfiler::_finished = false;
+        std::vector<std::pair<std::string, StartupProfiler::Clock::duration>> StartupProfiler::_phases;
+        StartupProfiler::Clock::time_point StartupProfiler::_firstStart;
+        StartupProfiler::Clock::time_point StartupProfiler::_phaseStart;
+        StartupProfiler::Clock::time_point StartupProfiler::_lastEnd;
+
+        void StartupProfiler::begin(const std::string& phase)
+        {
+            if (_finished) {
+                return;
+            }
+            auto now = Clock::now();
+            if (_phases.empty()) {
+                _firstStart = now;
+            } else {
+                _phases.back().second = now - _phaseStart;
+            }
+            _phases.emplace_back(phase, Clock::duration::zero());
+            _phaseStart = now;
+        }
+
+        void StartupProfiler::end()
+        {
+            if (_finished || _phases.empty()) {
+                return;
+            }
+            _lastEnd = Clock::now();
+            _phases.back().second = _lastEnd - _phaseStart;
+            _finished = true;
+        }
+
+        bool StartupProfiler::enabled()
+        {
+            return _enabled;
+        }
+
+        void StartupProfiler::setEnabled(bool value)
+        {
+            _enabled = value;
+        }
+
+        void StartupProfiler::report(ILogger& logger)
+        {
+            if (!_enabled || !_finished) {
+                return;
+            }
+
+            // formatted separately, so flags don't stick to the log stream
+            auto line = [](const std::string& name, Clock::duration duration) {
+                std::ostringstream stream;
+                stream << std::left << std::setw(12) << name << " " << std::right << std::fixed << std::setprecision(1)
+                       << std::setw(8) << std::chrono::duration<double, std::milli>(duration).count() << " ms";
+                return stream.str();
+            };
+
+            logger.info() << "[STARTUP] Cold start:" << std::endl;
+            for (auto& phase : _phases) {
+                logger.info() << "[STARTUP] " << line(phase.first, phase.second) << std::endl;
+            }
+            logger.info() << "[STARTUP] " << line("total", _lastEnd - _firstStart) << std::endl;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Falltergeist
+{
+    class ILogger;
+
+    namespace Game
+    {
+        /**
+         * Wall time of consecutive startup phases, from settings loading to the first rendered frame.
+         * Phases are always timed, the report is logged only with the --startup-profile command line option.
+         */
+        class StartupProfiler final
+        {
+            public:
+                // Closes the running phase and starts the next one
+                static void begin(const std::string& phase);
+
+                // Closes the running phase, later calls to begin() are ignored
+                static void end();
+
+                static bool enabled();
+
+                static void setEnabled(bool value);
+
+                // Logs duration of every phase and the total cold start time
+                static void report(ILogger& logger);
+
+            private:
+                using Clock = std::chrono::steady_clock;
+
+                static bool _enabled;
+                static bool _finished;
+                static std::vector<std::pair<std::string, Clock::duration>> _phases;
+                static Clock::time_point _firstStart;
+                static Clock::time_point _phaseStart;
+                static Clock::time_point _lastEnd;
+        };
+    }
+}
@@ -29,6 +29,8 @@ namespace Falltergeist
                 uint32_t year();
 
             protected:
+                friend class Snapshot;
+
                 uint32_t _ticks = 300000;
                 uint32_t _milliseconds = 0;
                 uint32_t _seconds = 0;
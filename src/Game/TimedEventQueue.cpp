@@ -0,0 +1,143 @@
+// Project includes
+#include "../Game/TimedEventQueue.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        namespace
+        {
+            struct LaterFirst
+            {
+                template <typename T>
+                bool operator()(const T& lhs, const T& rhs) const
+                {
+                    if (lhs.due != rhs.due) {
+                        return lhs.due > rhs.due;
+                    }
+                    return lhs.handle > rhs.handle;
+                }
+            };
+        }
+
+        TimedEventQueue::Handle TimedEventQueue::add(Object* object, const float& delay, int fixedParam)
+        {
+            Handle handle = _nextHandle++;
+            _heap.push_back(Entry{_time + delay, handle, object, fixedParam});
+            std::push_heap(_heap.begin(), _heap.end(), LaterFirst());
+
+            // lots of add/cancel pairs may leave the heap full of dead events
+            if (_heap.size() >= 1024 && _heap.size() >= _compactedSize * 2) {
+                _compact();
+            }
+            return handle;
+        }
+
+        void TimedEventQueue::cancel(Handle handle)
+        {
+            if (handle < _nextHandle) {
+                _cancelled.insert(handle);
+            }
+        }
+
+        void TimedEventQueue::cancel(Object* object)
+        {
+            _objectCancelledBefore[object] = _nextHandle;
+        }
+
+        void TimedEventQueue::cancel(Object* object, int fixedParam)
+        {
+            _fixedParamCancelledBefore[std::make_pair(object, fixedParam)] = _nextHandle;
+        }
+
+        void TimedEventQueue::clear()
+        {
+            _heap.clear();
+            _objectCancelledBefore.clear();
+            _fixedParamCancelledBefore.clear();
+            _cancelled.clear();
+            _compactedSize = 0;
+        }
+
+        void TimedEventQueue::think(const float& deltaTime, const Handler& handler)
+        {
+            _time += deltaTime;
+
+            const Handle firstNew = _nextHandle;
+            std::vector<Entry> postponed;
+            while (!_heap.empty() && _heap.front().due <= _time) {
+                std::pop_heap(_heap.begin(), _heap.end(), LaterFirst());
+                Entry entry = _heap.back();
+                _heap.pop_back();
+
+                if (entry.handle >= firstNew) {
+                    postponed.push_back(entry);
+                    continue;
+                }
+                if (_isCancelled(entry)) {
+                    _cancelled.erase(entry.handle);
+                    continue;
+                }
+                handler(entry.object, entry.fixedParam);
+            }
+
+            for (auto& entry : postponed) {
+                _heap.push_back(entry);
+                std::push_heap(_heap.begin(), _heap.end(), LaterFirst());
+            }
+
+            // nothing left to cancel
+            if (_heap.empty()) {
+                clear();
+            }
+        }
+
+        void TimedEventQueue::forEach(const Visitor& visitor) const
+        {
+            std::vector<const Entry*> pending;
+            pending.reserve(_heap.size());
+            for (auto& entry : _heap) {
+                if (!_isCancelled(entry)) {
+                    pending.push_back(&entry);
+                }
+            }
+            std::sort(pending.begin(), pending.end(), [](const Entry* lhs, const Entry* rhs) {
+                return lhs->handle < rhs->handle;
+            });
+            for (auto entry : pending) {
+                visitor(entry->object, entry->due - _time, entry->fixedParam);
+            }
+        }
+
+        bool TimedEventQueue::_isCancelled(const Entry& entry) const
+        {
+            auto objectIt = _objectCancelledBefore.find(entry.object);
+            if (objectIt != _objectCancelledBefore.end() && entry.handle < objectIt->second) {
+                return true;
+            }
+            auto fixedParamIt = _fixedParamCancelledBefore.find(std::make_pair(entry.object, entry.fixedParam));
+            if (fixedParamIt != _fixedParamCancelledBefore.end() && entry.handle < fixedParamIt->second) {
+                return true;
+            }
+            return _cancelled.count(entry.handle) != 0;
+        }
+
+        void TimedEventQueue::_compact()
+        {
+            auto dead = std::remove_if(_heap.begin(), _heap.end(), [this](const Entry& entry) {
+                return _isCancelled(entry);
+            });
+            for (auto it = dead; it != _heap.end(); ++it) {
+                _cancelled.erase(it->handle);
+            }
+            _heap.erase(dead, _heap.end());
+            std::make_heap(_heap.begin(), _heap.end(), LaterFirst());
+            _compactedSize = _heap.size();
+        }
+    }
+}
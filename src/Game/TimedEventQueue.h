@@ -0,0 +1,69 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Game
+    {
+        class Object;
+
+        // Scripted timed events (add_timer_event) ordered by due time in a binary min-heap.
+        // Cancelled events are not searched for, they are dropped when they reach the top of the heap.
+        class TimedEventQueue final
+        {
+            public:
+                using Handle = uint32_t;
+                using Handler = std::function<void(Object* object, int fixedParam)>;
+                using Visitor = std::function<void(Object* object, double remaining, int fixedParam)>;
+
+                Handle add(Object* object, const float& delay, int fixedParam = 0);
+
+                void cancel(Handle handle);
+                void cancel(Object* object);
+                void cancel(Object* object, int fixedParam);
+
+                void clear();
+
+                // Advances the queue clock and passes every event due by now to the handler, oldest first.
+                // Events added by the handler itself are left for the next call.
+                void think(const float& deltaTime, const Handler& handler);
+
+                // Passes every pending event with its remaining delay to the visitor, in the order they were added
+                void forEach(const Visitor& visitor) const;
+
+            private:
+                struct Entry
+                {
+                    double due;
+                    Handle handle;
+                    Object* object;
+                    int fixedParam;
+                };
+
+                std::vector<Entry> _heap;
+                double _time = 0;
+                Handle _nextHandle = 0;
+                size_t _compactedSize = 0;
+
+                // Events created before these handles are cancelled
+                std::unordered_map<Object*, Handle> _objectCancelledBefore;
+                std::map<std::pair<Object*, int>, Handle> _fixedParamCancelledBefore;
+                std::unordered_set<Handle> _cancelled;
+
+                bool _isCancelled(const Entry& entry) const;
+                void _compact();
+        };
+    }
+}
@@ -23,7 +23,7 @@ namespace Falltergeist
         {
             _texture = ResourceManager::getInstance()->texture(filename);
 
-            Format::Frm::File* frm = ResourceManager::getInstance()->frmFileType(filename);
+            auto frm = ResourceManager::getInstance()->frmFileType(filename);
 
             _stride = frm->framesPerDirection();
 
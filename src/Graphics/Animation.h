@@ -12,6 +12,7 @@
 
 // stdlib
 #include <iosfwd>
+#include <memory>
 
 namespace Falltergeist
 {
@@ -34,7 +35,7 @@ namespace Falltergeist
 
                 std::unique_ptr<VertexBuffer> _textureCoordinatesVertexBuffer;
 
-                Texture* _texture;
+                std::shared_ptr<Texture> _texture;
 
                 int _stride;
 
@@ -1,9 +1,11 @@
 // Project includes
 #include "../Game/Game.h"
+#include "../Graphics/GLCheck.h"
 #include "../Graphics/Movie.h"
 #include "../Graphics/Renderer.h"
 #include "../Graphics/Shader.h"
 #include "../Graphics/VertexArray.h"
+#include "../Logger.h"
 
 // Third-party includes
 
@@ -18,19 +20,70 @@ namespace Falltergeist
         Movie::Movie() : _size(Size(640, 320)) {
         }
 
+        Movie::~Movie()
+        {
+            if (_pixelBuffer > 0) {
+                glDeleteBuffers(1, &_pixelBuffer);
+                _pixelBuffer = 0;
+            }
+        }
+
         const Size& Movie::size() const {
             return _size;
         }
 
-        void Movie::loadFromSurface(SDL_Surface* surface)
+        uint32_t* Movie::lockPixels(const Size& frameSize)
+        {
+            if (!_texture || _texture->size().width() != frameSize.width() || _texture->size().height() != frameSize.height()) {
+                _texture = std::make_unique<Texture>(Pixels(nullptr, frameSize, Pixels::Format::RGBA));
+            }
+
+            _pixelBufferSize = frameSize.width() * frameSize.height() * sizeof(uint32_t);
+            _pixelBufferMapped = false;
+
+            if (_mapPixelBuffer) {
+                if (_pixelBuffer == 0) {
+                    GL_CHECK(glGenBuffers(1, &_pixelBuffer));
+                }
+
+                GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pixelBuffer));
+                // Orphan previous storage so the driver doesn't stall on a frame that is still being uploaded
+                GL_CHECK(glBufferData(GL_PIXEL_UNPACK_BUFFER, _pixelBufferSize, nullptr, GL_STREAM_DRAW));
+                // Not GL_CHECK'ed: a driver which can't map the buffer is not fatal
+                void* pixels = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+                GLenum error = glGetError();
+                if (pixels && error == GL_NO_ERROR) {
+                    _pixelBufferMapped = true;
+                    return static_cast<uint32_t*>(pixels);
+                }
+
+                Logger::warning("RENDERER") << "Can't map movie pixel buffer (GL error " << error << "), uploading frames from client memory" << std::endl;
+                _mapPixelBuffer = false;
+                GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+                GL_CHECK(glDeleteBuffers(1, &_pixelBuffer));
+                _pixelBuffer = 0;
+            }
+
+            _clientPixels.resize(frameSize.width() * frameSize.height());
+            return _clientPixels.data();
+        }
+
+        void Movie::unlockPixels()
         {
-            _texture = std::make_unique<Texture>(
-                Pixels(
-                surface->pixels,
-                Size(surface->w, surface->h),
-                Pixels::Format::RGBA
-                )
-            );
+            if (!_pixelBufferMapped) {
+                _texture->update(Pixels(_clientPixels.data(), _texture->size(), Pixels::Format::RGBA));
+                return;
+            }
+
+            _pixelBufferMapped = false;
+            GLboolean intact = GL_FALSE;
+            GL_CHECK(intact = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+            // Buffer contents are undefined if the mapping was lost, keep the previous frame then
+            if (intact) {
+                // Data pointer is an offset into the bound unpack buffer
+                _texture->update(Pixels(nullptr, _texture->size(), Pixels::Format::RGBA));
+            }
+            GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
         }
 
         void Movie::render(const Point& point)
@@ -7,6 +7,7 @@
 
 // stdlib
 #include <string>
+#include <vector>
 
 namespace Falltergeist
 {
@@ -16,14 +17,25 @@ namespace Falltergeist
         {
             public:
                 Movie();
-                ~Movie() = default;
+                ~Movie();
                 void render(const Point& point);
                 const Size& size() const;
-                void loadFromSurface(SDL_Surface* surface);
+
+                // Maps the texture upload buffer for writing RGBA8888 pixels of the given frame size.
+                // Falls back to a client memory buffer if the driver can't map it.
+                uint32_t* lockPixels(const Size& frameSize);
+
+                // Unmaps the upload buffer and transfers its contents to the texture
+                void unlockPixels();
 
             private:
                 std::unique_ptr<Texture> _texture;
                 const Size _size;
+                GLuint _pixelBuffer = 0;
+                unsigned int _pixelBufferSize = 0;
+                bool _pixelBufferMapped = false;
+                bool _mapPixelBuffer = true;
+                std::vector<uint32_t> _clientPixels;
         };
     }
 }
@@ -32,7 +32,7 @@ namespace Falltergeist
                 return queue;
             }
 
-            auto image = std::make_unique<UI::Image>(std::make_unique<Sprite>(frm));
+            auto image = std::make_unique<UI::Image>(std::make_unique<Sprite>(frm.get()));
             auto direction = static_cast<unsigned>(orientation);
             if (direction >= frm->directions().size()) {
                 //throw Exception("Image::Image(frm, direction) - direction not found: " + std::to_string(direction));
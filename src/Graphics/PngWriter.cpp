@@ -0,0 +1,42 @@
+// Project includes
+#include "../Graphics/PngWriter.h"
+
+// Third-party includes
+#include <SDL.h>
+#include <SDL_image.h>
+
+// stdlib
+
+namespace Falltergeist
+{
+    namespace Graphics
+    {
+        std::string PngWriter::write(const std::string& filename, const Size& size, std::vector<uint8_t>& pixels) {
+            Uint32 rmask = 0, gmask = 0, bmask = 0, amask = 0;
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            rmask = 0xff000000;
+            gmask = 0x00ff0000;
+            bmask = 0x0000ff00;
+            amask = 0x000000ff;
+#else
+            rmask = 0x000000ff;
+            gmask = 0x0000ff00;
+            bmask = 0x00ff0000;
+            amask = 0xff000000;
+#endif
+
+            int width = size.width();
+            SDL_Surface* surface = SDL_CreateRGBSurfaceFrom(pixels.data(), width, size.height(), 32, width * 4, rmask, gmask, bmask, amask);
+            if (!surface) {
+                return SDL_GetError();
+            }
+
+            std::string error;
+            if (IMG_SavePNG(surface, filename.c_str()) != 0) {
+                error = IMG_GetError();
+            }
+            SDL_FreeSurface(surface);
+            return error;
+        }
+    }
+}
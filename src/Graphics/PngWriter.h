@@ -0,0 +1,27 @@
+#pragma once
+
+// Project includes
+#include "../Graphics/Size.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Graphics
+    {
+        /**
+         * Saves top-down RGBA8888 images as PNG files, with SDL_image.
+         */
+        class PngWriter final
+        {
+            public:
+                // Returns an error message, empty on success
+                static std::string write(const std::string& filename, const Size& size, std::vector<uint8_t>& pixels);
+        };
+    }
+}
@@ -35,5 +35,19 @@ namespace Falltergeist
             return !(std::max(topLeft1.x(), topLeft2.x()) > std::min(bottomRight1.x(), bottomRight2.x())
                      || std::max(topLeft1.y(), topLeft2.y()) > std::min(bottomRight1.y(), bottomRight2.y()));
         }
+
+        std::pair<int, int> Rect::visibleTiles(int offset, unsigned int length, unsigned int tileSize, unsigned int tilesNumber)
+        {
+            // offset is negative when the span starts before the first tile
+            if (offset + static_cast<int>(length) <= 0) {
+                return std::make_pair(0, -1);
+            }
+            int first = std::max(offset, 0) / static_cast<int>(tileSize);
+            int last = std::min(
+                (offset + static_cast<int>(length) - 1) / static_cast<int>(tileSize),
+                static_cast<int>(tilesNumber) - 1
+            );
+            return std::make_pair(first, last);
+        }
     }
 }
@@ -7,6 +7,7 @@
 // Third-party includes
 
 // stdlib
+#include <utility>
 
 namespace Falltergeist
 {
@@ -24,6 +25,10 @@ namespace Falltergeist
 
                 // checks if two rectangles, given as their top-left positions and sizes, intersect each other
                 static bool intersects(const Point& topLeft1, const Size& size1, const Point& topLeft2, const Size& size2);
+
+                // first and last of tilesNumber tiles in a row which intersect the span of given length starting at offset,
+                // first > last if none does
+                static std::pair<int, int> visibleTiles(int offset, unsigned int length, unsigned int tileSize, unsigned int tilesNumber);
         };
     }
 }
@@ -4,11 +4,14 @@
 #include "../Event/State.h"
 #include "../Exception.h"
 #include "../Game/Game.h"
+#include "../Game/StartupProfiler.h"
 #include "../Graphics/GLCheck.h"
 #include "../Graphics/IRendererConfig.h"
 #include "../Graphics/IndexBuffer.h"
+#include "../Graphics/PngWriter.h"
 #include "../Graphics/Point.h"
 #include "../Graphics/Renderer.h"
+#include "../Graphics/ScreenshotWriter.h"
 #include "../Graphics/SdlWindow.h"
 #include "../Graphics/Shader.h"
 #include "../Graphics/Texture.h"
@@ -42,6 +45,14 @@ namespace Falltergeist {
         }
 
         Renderer::~Renderer() {
+            if (_screenshotWriter) {
+                _readScreenshots(0);
+                if (_screenshotBuffers[0] != 0) {
+                    glDeleteBuffers(static_cast<GLsizei>(_screenshotBuffers.size()), _screenshotBuffers.data());
+                }
+                // waits for queued screenshots to be written
+                _screenshotWriter.reset();
+            }
             SDL_GL_DeleteContext(_glcontext);
         }
 
@@ -130,6 +141,9 @@ namespace Falltergeist {
             _logger->info() << "[RENDERER] "
                             << "Using GLEW " << glewGetString(GLEW_VERSION) << std::endl;
 
+            // without pixel buffers screenshots are read synchronously
+            _pixelBuffers = GLEW_VERSION_2_1 || GLEW_ARB_pixel_buffer_object;
+
             _logger->info() << "[RENDERER] "
                             << "Extensions: " << std::endl;
 
@@ -144,6 +158,7 @@ namespace Falltergeist {
                 _logger->info() << "[RENDERER] " << (const char*)glGetString(GL_EXTENSIONS) << std::endl;
             }
 
+            Falltergeist::Game::StartupProfiler::begin("shaders");
             _logger->info() << "[RENDERER] "
                             << "Loading default shaders" << std::endl;
             ResourceManager::getInstance()->shader("default");
@@ -163,6 +178,8 @@ namespace Falltergeist {
 
             // load egg
             _egg = ResourceManager::getInstance()->texture("data/egg.png");
+
+            _screenshotWriter = std::make_unique<ScreenshotWriter>(SCREENSHOT_QUEUE_SIZE, PngWriter::write);
         }
 
         void Renderer::think(const float deltaTime) {
@@ -185,7 +202,7 @@ namespace Falltergeist {
                     _fadeDone = true;
 
                     auto state = Game::getInstance()->topState();
-                    state->emitEvent(std::make_unique<Event::State>("fadedone"), state->fadeDoneHandler());
+                    state->emitEvent(Event::State("fadedone"), state->fadeDoneHandler());
                     return;
                 }
             }
@@ -223,8 +240,22 @@ namespace Falltergeist {
         }
 
         void Renderer::endFrame() {
+            // the oldest buffer is read first, so it is free when a capture below needs it
+            _readScreenshots(2);
+            if (_screenshotRequested) {
+                _captureScreenshot();
+            }
+            for (auto& result : _screenshotWriter->finished()) {
+                if (result.error.empty()) {
+                    _logger->info() << "[RENDERER] Screenshot saved to " + result.filename << std::endl;
+                } else {
+                    _logger->error() << "[RENDERER] Could not save screenshot " + result.filename + ": " + result.error << std::endl;
+                }
+            }
+
             GL_CHECK(glDisable(GL_BLEND));
             SDL_GL_SwapWindow(_sdlWindow->sdlWindowPtr());
+            _frame++;
         }
 
         const Size& Renderer::size() const {
@@ -232,58 +263,87 @@ namespace Falltergeist {
         }
 
         void Renderer::screenshot() {
-            std::string filename;
-            Uint32 rmask = 0, gmask = 0, bmask = 0, amask = 0;
-            SDL_Surface* output = nullptr;
+            _screenshotRequested = true;
+        }
 
-            int iter = 0;
-            do {
-                std::string siter = std::to_string(iter);
+        std::string Renderer::_nextScreenshotFilename() {
+            // files still in the writer queue don't exist yet, so numbering continues from the last taken one
+            while (_screenshotIndex < 1000) {
+                std::string siter = std::to_string(_screenshotIndex++);
                 if (siter.size() < 3) {
                     siter.insert(0, 3 - siter.size(), '0');
                 }
-                filename = "screenshot" + siter + ".png";
-                iter++;
-            } while (CrossPlatform::fileExists(filename) && iter < 1000);
+                std::string filename = "screenshot" + siter + ".png";
+                if (!CrossPlatform::fileExists(filename)) {
+                    return filename;
+                }
+            }
+            return "";
+        }
+
+        void Renderer::_captureScreenshot() {
+            _screenshotRequested = false;
 
-            if (CrossPlatform::fileExists(filename)) {
+            std::string filename = _nextScreenshotFilename();
+            if (filename.empty()) {
                 _logger->warning() << "[RENDERER] Too many screenshots" << std::endl;
                 return;
             }
 
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-            rmask = 0xff000000;
-            gmask = 0x00ff0000;
-            bmask = 0x0000ff00;
-            amask = 0x000000ff;
-#else
-            rmask = 0x000000ff;
-            gmask = 0x0000ff00;
-            bmask = 0x00ff0000;
-            amask = 0xff000000;
-#endif
+            GL_CHECK(glReadBuffer(GL_BACK));
+
+            if (!_pixelBuffers) {
+                Base::Buffer<uint8_t> pixels(size().width() * size().height() * 4);
+                GL_CHECK(glReadPixels(0, 0, size().width(), size().height(), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+                _writeScreenshot(filename, size(), pixels.data());
+                return;
+            }
 
-            output = SDL_CreateRGBSurface(0, size().width(), size().height(), 32, rmask, gmask, bmask, amask);
-            uint8_t* destPixels = (uint8_t*)output->pixels;
-            Base::Buffer<uint8_t> srcPixels(size().width() * size().height() * 4);
-
-            glReadBuffer(GL_BACK);
-            glReadPixels(0, 0, size().width(), size().height(), GL_RGBA, GL_UNSIGNED_BYTE, srcPixels.data());
-
-            for (int y = 0; y < static_cast<int>(size().height()); ++y) {
-                for (int x = 0; x < static_cast<int>(size().width()); ++x) {
-                    uint8_t* pDestPix = &destPixels[((size().width() * y) + x) * 4];
-                    uint8_t* pSrcPix = &srcPixels[((size().width() * ((size().height() - 1) - y)) + x) * 4];
-                    pDestPix[0] = pSrcPix[0];
-                    pDestPix[1] = pSrcPix[1];
-                    pDestPix[2] = pSrcPix[2];
-                    pDestPix[3] = 255;
+            if (_screenshotBuffers[0] == 0) {
+                GL_CHECK(glGenBuffers(static_cast<GLsizei>(_screenshotBuffers.size()), _screenshotBuffers.data()));
+            }
+
+            auto& capture = _screenshotCaptures[_nextScreenshotBuffer];
+            GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, _screenshotBuffers[_nextScreenshotBuffer]));
+            GL_CHECK(glBufferData(GL_PIXEL_PACK_BUFFER, size().width() * size().height() * 4, nullptr, GL_STREAM_READ));
+            // returns right away, data pointer is an offset into the bound pack buffer
+            GL_CHECK(glReadPixels(0, 0, size().width(), size().height(), GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+            GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+            capture.filename = filename;
+            capture.size = size();
+            capture.frame = _frame;
+            _nextScreenshotBuffer = (_nextScreenshotBuffer + 1) % _screenshotBuffers.size();
+        }
+
+        void Renderer::_readScreenshots(unsigned int minAge) {
+            for (size_t i = 0; i != _screenshotCaptures.size(); ++i) {
+                auto& capture = _screenshotCaptures[i];
+                if (capture.filename.empty() || _frame - capture.frame < minAge) {
+                    continue;
+                }
+
+                GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, _screenshotBuffers[i]));
+                void* pixels = nullptr;
+                GL_CHECK(pixels = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+                if (pixels) {
+                    _writeScreenshot(capture.filename, capture.size, static_cast<const uint8_t*>(pixels));
+                    GL_CHECK(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+                } else {
+                    _logger->error() << "[RENDERER] Could not read screenshot " + capture.filename << std::endl;
                 }
+                GL_CHECK(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+                capture.filename.clear();
             }
+        }
 
-            IMG_SavePNG(output, filename.c_str());
-            SDL_FreeSurface(output);
-            _logger->info() << "[RENDERER] Screenshot saved to " + filename << std::endl;
+        void Renderer::_writeScreenshot(const std::string& filename, const Size& size, const uint8_t* bottomUpPixels) {
+            size_t rowSize = static_cast<size_t>(size.width()) * 4;
+            std::vector<uint8_t> pixels(rowSize * size.height());
+            ScreenshotWriter::flipRows(bottomUpPixels, pixels.data(), rowSize, size.height());
+            if (!_screenshotWriter->write(filename, size, std::move(pixels))) {
+                _logger->warning() << "[RENDERER] Screenshot queue is full, " + filename + " dropped" << std::endl;
+            }
         }
 
         float Renderer::scaleX() {
@@ -506,7 +566,7 @@ namespace Falltergeist {
         }
 
         Texture* Renderer::egg() {
-            return _egg;
+            return _egg.get();
         }
 
         Renderer::RenderPath Renderer::renderPath() {
@@ -16,6 +16,7 @@
 #include <SDL.h>
 
 // stdlib
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,6 +25,7 @@ namespace Falltergeist
 {
     namespace Graphics
     {
+        class ScreenshotWriter;
         class Texture;
 
         class Renderer
@@ -93,6 +95,7 @@ namespace Falltergeist
 
                 glm::vec4 fadeColor();
 
+                // Captures the frame being rendered at the end of it, the file is written in the background
                 void screenshot();
 
                 int32_t maxTextureSize();
@@ -132,7 +135,7 @@ namespace Falltergeist
 
                 int32_t _maxTexSize;
 
-                Texture* _egg;
+                std::shared_ptr<Texture> _egg;
 
             private:
                 std::unique_ptr<IRendererConfig> _rendererConfig;
@@ -143,6 +146,41 @@ namespace Falltergeist
                 Size _size;
 
                 std::shared_ptr<SdlWindow> _sdlWindow;
+
+                struct ScreenshotCapture
+                {
+                    std::string filename;
+                    Size size;
+                    unsigned int frame = 0;
+                };
+
+                static constexpr size_t SCREENSHOT_QUEUE_SIZE = 8;
+
+                unsigned int _frame = 0;
+
+                bool _screenshotRequested = false;
+
+                unsigned int _screenshotIndex = 0;
+
+                // readback goes through two pixel buffers in turn, each is mapped two frames after its capture
+                bool _pixelBuffers = false;
+
+                std::array<GLuint, 2> _screenshotBuffers = {{0, 0}};
+
+                std::array<ScreenshotCapture, 2> _screenshotCaptures;
+
+                unsigned int _nextScreenshotBuffer = 0;
+
+                std::unique_ptr<ScreenshotWriter> _screenshotWriter;
+
+                std::string _nextScreenshotFilename();
+
+                void _captureScreenshot();
+
+                // Maps buffers of captures at least minAge frames old and queues them for writing
+                void _readScreenshots(unsigned int minAge);
+
+                void _writeScreenshot(const std::string& filename, const Size& size, const uint8_t* bottomUpPixels);
         };
     }
 }
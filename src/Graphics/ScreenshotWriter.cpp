@@ -0,0 +1,80 @@
+// Project includes
+#include "../Graphics/ScreenshotWriter.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstring>
+#include <utility>
+
+namespace Falltergeist
+{
+    namespace Graphics
+    {
+        ScreenshotWriter::ScreenshotWriter(size_t queueSize, Encoder encoder) : _queueSize(queueSize), _encoder(std::move(encoder)) {
+            _worker = std::thread([this]() { _run(); });
+        }
+
+        ScreenshotWriter::~ScreenshotWriter() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _wakeUp.notify_one();
+            // queued screenshots are still written
+            _worker.join();
+        }
+
+        bool ScreenshotWriter::write(const std::string& filename, const Size& size, std::vector<uint8_t> pixels) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_queue.size() >= _queueSize) {
+                    return false;
+                }
+                _queue.push_back(Image{filename, size, std::move(pixels)});
+            }
+            _wakeUp.notify_one();
+            return true;
+        }
+
+        std::vector<ScreenshotWriter::Result> ScreenshotWriter::finished() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::vector<Result> results;
+            results.swap(_finished);
+            return results;
+        }
+
+        void ScreenshotWriter::flipRows(const uint8_t* source, uint8_t* destination, size_t rowSize, size_t rows) {
+            for (size_t y = 0; y < rows; ++y) {
+                std::memcpy(destination + y * rowSize, source + (rows - 1 - y) * rowSize, rowSize);
+            }
+        }
+
+        void ScreenshotWriter::_run() {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true) {
+                _wakeUp.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+                if (_queue.empty()) {
+                    return;
+                }
+
+                auto image = std::move(_queue.front());
+                _queue.pop_front();
+                lock.unlock();
+
+                std::string error = _encode(image);
+
+                lock.lock();
+                _finished.push_back(Result{image.filename, error});
+            }
+        }
+
+        std::string ScreenshotWriter::_encode(Image& image) {
+            // the back buffer alpha is whatever blending left there
+            for (size_t i = 3; i < image.pixels.size(); i += 4) {
+                image.pixels[i] = 255;
+            }
+            return _encoder(image.filename, image.size, image.pixels);
+        }
+    }
+}
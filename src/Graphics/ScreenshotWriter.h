@@ -0,0 +1,73 @@
+#pragma once
+
+// Project includes
+#include "../Graphics/Size.h"
+
+// Third-party includes
+
+// stdlib
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Graphics
+    {
+        /**
+         * Encodes screenshots and writes them to disk on a background thread.
+         * Doesn't touch OpenGL, images are handed over as top-down RGBA8888 pixels.
+         */
+        class ScreenshotWriter final
+        {
+            public:
+                struct Result
+                {
+                    std::string filename;
+                    // empty on success
+                    std::string error;
+                };
+
+                // Writes the image to filename, returns an error message or an empty string, e.g. PngWriter::write
+                using Encoder = std::function<std::string(const std::string& filename, const Size& size, std::vector<uint8_t>& pixels)>;
+
+                ScreenshotWriter(size_t queueSize, Encoder encoder);
+                ~ScreenshotWriter();
+
+                // Queues the image for writing, returns false if the queue is full
+                bool write(const std::string& filename, const Size& size, std::vector<uint8_t> pixels);
+
+                // Results of writes finished since the last call
+                std::vector<Result> finished();
+
+                // Copies rows of the image in reverse order, turning bottom-up OpenGL readback into top-down and back
+                static void flipRows(const uint8_t* source, uint8_t* destination, size_t rowSize, size_t rows);
+
+            private:
+                struct Image
+                {
+                    std::string filename;
+                    Size size;
+                    std::vector<uint8_t> pixels;
+                };
+
+                size_t _queueSize;
+                Encoder _encoder;
+                std::mutex _mutex;
+                std::condition_variable _wakeUp;
+                std::deque<Image> _queue;
+                std::vector<Result> _finished;
+                bool _stopping = false;
+                std::thread _worker;
+
+                void _run();
+                std::string _encode(Image& image);
+        };
+    }
+}
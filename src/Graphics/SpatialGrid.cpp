@@ -0,0 +1,65 @@
+// Project includes
+#include "../Graphics/SpatialGrid.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+
+namespace Falltergeist
+{
+    namespace Graphics
+    {
+        SpatialGrid::SpatialGrid(const Size& cellSize) : _cellSize(cellSize)
+        {
+        }
+
+        void SpatialGrid::reset(const Point& topLeft, const Size& area)
+        {
+            _topLeft = topLeft;
+            _columns = std::max(0, (area.width() + _cellSize.width() - 1) / _cellSize.width());
+            _rows = std::max(0, (area.height() + _cellSize.height() - 1) / _cellSize.height());
+
+            // keep cells capacity between rebuilds
+            _cells.resize(_columns * _rows);
+            for (auto& cell : _cells) {
+                cell.clear();
+            }
+        }
+
+        void SpatialGrid::insert(unsigned int id, const Point& topLeft, const Size& size)
+        {
+            if (size.width() <= 0 || size.height() <= 0) {
+                return;
+            }
+            Point relative = topLeft - _topLeft;
+            if (relative.x() + size.width() <= 0 || relative.y() + size.height() <= 0) {
+                return;
+            }
+            int left = std::max(0, relative.x() / _cellSize.width());
+            int top = std::max(0, relative.y() / _cellSize.height());
+            int right = std::min(_columns - 1, (relative.x() + size.width() - 1) / _cellSize.width());
+            int bottom = std::min(_rows - 1, (relative.y() + size.height() - 1) / _cellSize.height());
+
+            for (int row = top; row <= bottom; row++) {
+                for (int column = left; column <= right; column++) {
+                    _cells[row * _columns + column].push_back(id);
+                }
+            }
+        }
+
+        const std::vector<unsigned int>& SpatialGrid::itemsAt(const Point& point) const
+        {
+            Point relative = point - _topLeft;
+            if (relative.x() < 0 || relative.y() < 0) {
+                return _noItems;
+            }
+            int column = relative.x() / _cellSize.width();
+            int row = relative.y() / _cellSize.height();
+            if (column >= _columns || row >= _rows) {
+                return _noItems;
+            }
+            return _cells[row * _columns + column];
+        }
+    }
+}
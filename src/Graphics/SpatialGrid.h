@@ -0,0 +1,49 @@
+#pragma once
+
+// Project includes
+#include "../Graphics/Point.h"
+#include "../Graphics/Size.h"
+
+// Third-party includes
+
+// stdlib
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace Graphics
+    {
+        /**
+         * Uniform grid over a rectangular area, used to find items which bounding rectangles contain some point.
+         * Items are referenced by ids chosen by the caller and are returned in insertion order.
+         * Rebuilding the grid with the same area reuses the memory of previous build.
+         */
+        class SpatialGrid final
+        {
+            public:
+                explicit SpatialGrid(const Size& cellSize);
+
+                // Removes all items and covers the given area with cells
+                void reset(const Point& topLeft, const Size& area);
+
+                // Adds item to all cells intersecting given rectangle, the part outside of grid area is ignored
+                void insert(unsigned int id, const Point& topLeft, const Size& size);
+
+                // Ids of items which rectangles may contain given point
+                const std::vector<unsigned int>& itemsAt(const Point& point) const;
+
+            private:
+                Size _cellSize;
+
+                Point _topLeft;
+
+                int _columns = 0;
+
+                int _rows = 0;
+
+                std::vector<std::vector<unsigned int>> _cells;
+
+                std::vector<unsigned int> _noItems;
+        };
+    }
+}
@@ -118,7 +118,7 @@ namespace Falltergeist
 
             Game::getInstance()->renderer()->drawRectangle(
                 Rectangle(point, size),
-                _texture,
+                _texture.get(),
                 Game::getInstance()->renderer()->egg(),
                 _shader
             );
@@ -193,7 +193,7 @@ namespace Falltergeist
                 _shader->setUniform(_uniformTexSize, glm::vec2((float)_texture->size().width(), (float)_texture->size().height()));
             }
 
-            Game::getInstance()->renderer()->drawPartialRectangle(point, part, _texture, Game::getInstance()->renderer()->egg(), _shader);
+            Game::getInstance()->renderer()->drawPartialRectangle(point, part, _texture.get(), Game::getInstance()->renderer()->egg(), _shader);
         }
 
         bool Sprite::opaque(const Point& point)
@@ -11,6 +11,7 @@
 // Third-party includes
 
 // stdlib
+#include <memory>
 #include <string>
 
 namespace Falltergeist
@@ -58,7 +59,7 @@ namespace Falltergeist
 
                 GLint _attribTex;
 
-                Texture* _texture;
+                std::shared_ptr<Texture> _texture;
 
                 Graphics::TransFlags::Trans _trans = Graphics::TransFlags::Trans::NONE;
 
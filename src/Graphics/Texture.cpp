@@ -38,6 +38,28 @@ namespace Falltergeist {
             }
         }
 
+        void Texture::update(const Pixels &pixels) {
+            if (pixels.size().width() != _size.width() || pixels.size().height() != _size.height()) {
+                throw std::logic_error("Texture size mismatch");
+            }
+
+            GLenum format = GL_NONE;
+            switch (pixels.format()) {
+                case Pixels::Format::RGB:
+                    format = GL_BGRA;
+                    break;
+                case Pixels::Format::RGBA:
+                    format = GL_RGBA;
+                    break;
+                default:
+                    throw std::logic_error("Unsupported pixels format");
+            }
+
+            GL_CHECK(glBindTexture(GL_TEXTURE_2D, _textureID));
+            GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, _size.width(), _size.height(), format,
+                                     GL_UNSIGNED_INT_8_8_8_8, pixels.data()));
+        }
+
         const Size &Texture::size() const {
             return _size;
         }
@@ -27,6 +27,9 @@ namespace Falltergeist
                 void bind(uint8_t unit=0) const;
                 void unbind(uint8_t unit=0);
 
+                // Replaces texture contents. Pixels data is treated as an offset when a pixel unpack buffer is bound
+                void update(const Pixels& pixels);
+
                 bool opaque(unsigned int x, unsigned int y);
                 void setMask(std::vector<bool> mask);
 
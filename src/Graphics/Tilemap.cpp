@@ -85,7 +85,8 @@ namespace Falltergeist {
             _shader->setUniform(_uniformCnt, Game::getInstance()->animatedPalette()->counters());
 
             int lightLevel = 100;
-            if (auto state = Game::getInstance()->locationState()) {
+            auto state = Game::getInstance()->locationState();
+            if (_lightEnabled && state) {
                 if (state->lightLevel() < 0xA000) {
                     lightLevel = (state->lightLevel() - 0x4000) * 100 / 0x6000;
 
@@ -104,6 +105,10 @@ namespace Falltergeist {
             GL_CHECK(glDrawElements(GL_TRIANGLES, indexes.size(), GL_UNSIGNED_INT, nullptr));
         }
 
+        void Tilemap::setLightEnabled(bool value) {
+            _lightEnabled = value;
+        }
+
         void Tilemap::addTexture(SDL_Surface *surface) {
             _textures.push_back(std::make_unique<Texture>(
                 Pixels(
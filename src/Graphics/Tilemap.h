@@ -24,6 +24,9 @@ namespace Falltergeist
                 void render(const Point &pos, std::vector<GLuint> indexes, uint32_t atlas);
                 void addTexture(SDL_Surface* surface);
 
+                // Tiles shown outside of locations, like the world map, don't take the light level of the location
+                void setLightEnabled(bool value);
+
             private:
                 std::unique_ptr<VertexBuffer> _coordinatesVertexBuffer;
 
@@ -49,6 +52,8 @@ namespace Falltergeist
 
                 GLint _attribTex;
 
+                bool _lightEnabled = true;
+
                 std::shared_ptr<Graphics::Shader> _shader;
         };
     }
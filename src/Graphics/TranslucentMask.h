@@ -8,6 +8,7 @@
 #include <glm/vec4.hpp>
 
 // stdlib
+#include <memory>
 
 namespace Falltergeist
 {
@@ -36,7 +37,7 @@ namespace Falltergeist
 
                 GLint _attribTex;
 
-                Texture* _texture;
+                std::shared_ptr<Texture> _texture;
 
                 glm::vec4 _color;
 
@@ -3,6 +3,7 @@
 #include "../Game/Location.h"
 #include "../Game/Elevator.h"
 #include "../Helpers/StateElevatorHelper.h"
+#include "../Logger.h"
 #include "../ResourceManager.h"
 #include "../Settings.h"
 #include "../Ini/File.h"
@@ -81,7 +82,7 @@ namespace Falltergeist
 
                     for (size_t i = 0; i < floors.size(); i++) {
                         auto fl = floors.at(i);
-                        _logger->debug() << " loaded elevator: map=" << fl->mapId << " elevation=" << fl->elevation << " position=" << fl->position << std::endl;
+                        FALLTERGEIST_LOG_DEBUG(_logger) << " loaded elevator: map=" << fl->mapId << " elevation=" << fl->elevation << " position=" << fl->position << std::endl;
                     }
                 }
             }
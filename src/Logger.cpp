@@ -4,10 +4,144 @@
 // Third-party includes
 
 // stdlib
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 namespace Falltergeist
 {
+    namespace
+    {
+        // Writes finished log lines to std::cout from a background thread.
+        // Producers hand lines over through an intrusive lock-free MPSC queue (Vyukov's design),
+        // the writer is the only consumer.
+        class LogSink
+        {
+            public:
+                LogSink()
+                {
+                    _tail = new Node();
+                    _head.store(_tail);
+                    _writer = std::thread([this]() { _run(); });
+                }
+
+                ~LogSink()
+                {
+                    _stopping.store(true);
+                    _wakeUp.notify_one();
+                    _writer.join();
+                    delete _tail;
+                }
+
+                void push(std::string&& line)
+                {
+                    auto node = new Node();
+                    node->text = std::move(line);
+                    _pushed.fetch_add(1, std::memory_order_relaxed);
+                    auto previous = _head.exchange(node, std::memory_order_acq_rel);
+                    previous->next.store(node, std::memory_order_release);
+                    _wakeUp.notify_one();
+                }
+
+                void flush()
+                {
+                    auto pushed = _pushed.load();
+                    while (_written.load() < pushed) {
+                        _wakeUp.notify_one();
+                        std::this_thread::yield();
+                    }
+                }
+
+            private:
+                struct Node
+                {
+                    std::string text;
+                    std::atomic<Node*> next{nullptr};
+                };
+
+                std::atomic<Node*> _head;
+                Node* _tail;
+                std::atomic<uint64_t> _pushed{0};
+                std::atomic<uint64_t> _written{0};
+                std::atomic<bool> _stopping{false};
+                std::mutex _wakeUpMutex;
+                std::condition_variable _wakeUp;
+                std::thread _writer;
+
+                bool _writePending()
+                {
+                    bool written = false;
+                    while (auto next = _tail->next.load(std::memory_order_acquire)) {
+                        std::cout << next->text;
+                        delete _tail;
+                        _tail = next;
+                        _written.fetch_add(1);
+                        written = true;
+                    }
+                    if (written) {
+                        std::cout.flush();
+                    }
+                    return written;
+                }
+
+                void _run()
+                {
+                    while (true) {
+                        if (_writePending()) {
+                            continue;
+                        }
+                        if (_stopping.load()) {
+                            // producers may still have been linking their nodes in
+                            if (!_writePending()) {
+                                break;
+                            }
+                            continue;
+                        }
+                        // pushing does not take the mutex, so a wake-up may be missed; the timeout covers it
+                        std::unique_lock<std::mutex> lock(_wakeUpMutex);
+                        _wakeUp.wait_for(lock, std::chrono::milliseconds(10));
+                    }
+                }
+        };
+
+        LogSink& sink()
+        {
+            static LogSink instance;
+            return instance;
+        }
+
+        // Collects one log line per thread, the line is handed to the sink on std::endl / std::flush
+        class LineBuffer : public std::stringbuf
+        {
+            public:
+                void submit()
+                {
+                    if (pptr() != pbase()) {
+                        sink().push(str());
+                        str(std::string());
+                    }
+                }
+
+            protected:
+                int sync() override
+                {
+                    submit();
+                    return 0;
+                }
+        };
+
+        std::ostream& lineStream(LineBuffer*& buffer)
+        {
+            thread_local LineBuffer lineBuffer;
+            thread_local std::ostream stream(&lineBuffer);
+            buffer = &lineBuffer;
+            return stream;
+        }
+    }
+
     Logger::Logger(const std::string& channel) : _channel(channel) {
     }
 
@@ -25,15 +159,30 @@ namespace Falltergeist
     {
         // A /dev/null-like stream
         static std::ostream nullstream(nullptr);
-        if (level < _level) {
+        if (!enabled(level)) {
             return nullstream;
         }
-        std::string subsystemMsg = " ";
+
+        LineBuffer* buffer;
+        auto& stream = lineStream(buffer);
+        // previous message was not terminated with std::endl
+        buffer->submit();
+
+        stream << levelString(level);
         if (subsystem.size() > 0) {
-            subsystemMsg = " [" + subsystem + "] ";
+            stream << " [" << subsystem << "] ";
+        } else {
+            stream << " ";
         }
+        return stream << std::dec;
+    }
 
-        return std::cout << levelString(level) << subsystemMsg << std::dec;
+    void Logger::flush()
+    {
+        LineBuffer* buffer;
+        lineStream(buffer);
+        buffer->submit();
+        sink().flush();
     }
 
     // Initial level; overridden with config option with default level LOG_INFO
@@ -11,6 +11,11 @@
 #include <iosfwd>
 #include <iostream>
 
+// Log levels below this one are compiled out of FALLTERGEIST_LOG_* calls (0 - debug, ..., 5 - none)
+#ifndef FALLTERGEIST_LOG_MIN_LEVEL
+#define FALLTERGEIST_LOG_MIN_LEVEL 0
+#endif
+
 namespace Falltergeist
 {
     class Logger final : public ILogger
@@ -30,6 +35,16 @@ namespace Falltergeist
             Logger(const std::string& channel);
 
             static Level level();
+
+            // Costs a single comparison, use it to skip building expensive messages
+            static inline bool enabled(Level level)
+            {
+                return static_cast<int>(level) >= FALLTERGEIST_LOG_MIN_LEVEL && level >= _level;
+            }
+
+            // Waits until every message logged so far is written out
+            static void flush();
+
             static void setLevel(Level level);
             static void setLevel(const std::string &level);
             static const char *levelString(Level level);
@@ -56,6 +71,12 @@ namespace Falltergeist
             std::string _channel;
     };
 
+    // Swallows the stream expression, so the whole log statement is a single void expression
+    struct LogStatement
+    {
+        void operator&(std::ostream&) const {}
+    };
+
     // Support for custom types in output streams:
     std::ostream& operator<<(std::ostream& lhs, const Graphics::Point& rhs);
     std::ostream& operator<<(std::ostream& lhs, const Graphics::Size& rhs);
@@ -63,3 +84,19 @@ namespace Falltergeist
     std::string to_string(const Graphics::Point& point);
     std::string to_string(const Graphics::Size& size);
 }
+
+// Message arguments are not evaluated at all when the level is disabled:
+//     FALLTERGEIST_LOG_DEBUG(_logger) << "value = " << value << std::endl;
+#define FALLTERGEIST_LOG(logger, lvl, method) \
+    !::Falltergeist::Logger::enabled(::Falltergeist::Logger::Level::lvl) ? (void) 0 : ::Falltergeist::LogStatement() & (logger)->method()
+
+#define FALLTERGEIST_LOG_DEBUG(logger) FALLTERGEIST_LOG(logger, LOG_DEBUG, debug)
+#define FALLTERGEIST_LOG_INFO(logger) FALLTERGEIST_LOG(logger, LOG_INFO, info)
+#define FALLTERGEIST_LOG_WARNING(logger) FALLTERGEIST_LOG(logger, LOG_WARNING, warning)
+
+// Same for the static API, the subsystem name is only built when the level is enabled:
+//     FALLTERGEIST_LOG_DEBUG_STATIC("SCRIPT") << "value = " << value << std::endl;
+#define FALLTERGEIST_LOG_STATIC(subsystem, lvl, method) \
+    !::Falltergeist::Logger::enabled(::Falltergeist::Logger::Level::lvl) ? (void) 0 : ::Falltergeist::LogStatement() & ::Falltergeist::Logger::method(subsystem)
+
+#define FALLTERGEIST_LOG_DEBUG_STATIC(subsystem) FALLTERGEIST_LOG_STATIC(subsystem, LOG_DEBUG, debug)
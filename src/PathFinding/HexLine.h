@@ -0,0 +1,64 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <cmath>
+#include <cstdlib>
+
+namespace Falltergeist
+{
+    // Straight line between the centers of two hexes, given in cube coordinates (y = -x - z)
+    class HexLine final
+    {
+        public:
+            static unsigned int distance(int fromX, int fromZ, int toX, int toZ)
+            {
+                const int deltaX = toX - fromX;
+                const int deltaZ = toZ - fromZ;
+                return (std::abs(deltaX) + std::abs(deltaZ) + std::abs(deltaX + deltaZ)) / 2;
+            }
+
+            // Passes cube x and z of every hex strictly between the endpoints to the visitor, starting next to the
+            // first one. Stops and returns false as soon as the visitor returns false.
+            template<typename Visitor>
+            static bool walk(int fromX, int fromZ, int toX, int toZ, Visitor&& visitor)
+            {
+                // Endpoints are nudged a bit, so lines running exactly along hex edges always pick the same side
+                const double startX = fromX + 1e-6;
+                const double startY = -fromX - fromZ + 2e-6;
+                const double startZ = fromZ - 3e-6;
+                const double deltaX = toX + 1e-6 - startX;
+                const double deltaY = -toX - toZ + 2e-6 - startY;
+                const double deltaZ = toZ - 3e-6 - startZ;
+
+                const unsigned int steps = distance(fromX, fromZ, toX, toZ);
+                for (unsigned int i = 1; i < steps; ++i) {
+                    const double t = static_cast<double>(i) / steps;
+                    const double x = startX + deltaX * t;
+                    const double y = startY + deltaY * t;
+                    const double z = startZ + deltaZ * t;
+
+                    double roundX = std::round(x);
+                    double roundY = std::round(y);
+                    double roundZ = std::round(z);
+                    const double diffX = std::abs(roundX - x);
+                    const double diffY = std::abs(roundY - y);
+                    const double diffZ = std::abs(roundZ - z);
+                    // fix the coordinate with the largest rounding error, Y itself is never used
+                    if (diffX > diffY && diffX > diffZ) {
+                        roundX = -roundY - roundZ;
+                    } else if (diffY <= diffZ) {
+                        roundZ = -roundX - roundY;
+                    }
+
+                    if (!visitor(static_cast<int>(roundX), static_cast<int>(roundZ))) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+    };
+}
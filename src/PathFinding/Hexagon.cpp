@@ -1,6 +1,7 @@
 // Project includes
 #include "../Game/DoorSceneryObject.h"
 #include "../PathFinding/Hexagon.h"
+#include "../PathFinding/HexagonGrid.h"
 
 // Third-party includes
 
@@ -9,12 +10,17 @@
 
 namespace Falltergeist
 {
-    Hexagon::Hexagon(unsigned int number)
+    Hexagon::Hexagon(unsigned int number, HexagonGrid* grid) : _grid(grid)
     {
         // Init hex's grid position
         setNumber(number);
     }
 
+    HexagonGrid* Hexagon::grid() const
+    {
+        return _grid;
+    }
+
     std::array<Hexagon*, Hexagon::HEX_SIDES>& Hexagon::neighbors()
     {
         return _neighbors;
@@ -37,6 +43,9 @@ namespace Falltergeist
 
     bool Hexagon::canWalkThru()
     {
+        if (_grid) {
+            return _grid->canWalkThru(_number);
+        }
         // Search hex for any blocking objects...
         for (const auto object : _objects) {
             if (!object->canWalkThru()) {
@@ -46,6 +55,39 @@ namespace Falltergeist
         return true;
     }
 
+    bool Hexagon::canShootThru()
+    {
+        if (_grid) {
+            return _grid->canShootThru(_number);
+        }
+        for (const auto object : _objects) {
+            if (!object->canShootThru()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Hexagon::canLightThru()
+    {
+        if (_grid) {
+            return _grid->canLightThru(_number);
+        }
+        for (const auto object : _objects) {
+            if (!object->flat() && object->type() != Game::Object::Type::DUDE && !object->canLightThru()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Hexagon::updateBlockers()
+    {
+        if (_grid) {
+            _grid->updateBlockers(this);
+        }
+    }
+
     Game::Orientation Hexagon::orientationTo(Hexagon *hexagon)
     {
         Graphics::Point delta = hexagon->position() - _position;
@@ -17,6 +17,8 @@ namespace Falltergeist
         class Object;
     }
 
+    class HexagonGrid;
+
     class Hexagon
     {
         public:
@@ -26,7 +28,9 @@ namespace Falltergeist
 
             Hexagon() = default;
 
-            explicit Hexagon(unsigned int number);
+            explicit Hexagon(unsigned int number, HexagonGrid* grid = nullptr);
+
+            HexagonGrid* grid() const;
 
             const Graphics::Point& position() const;
 
@@ -88,6 +92,11 @@ namespace Falltergeist
             unsigned int light();
 
             bool canWalkThru();
+            bool canShootThru();
+            bool canLightThru();
+
+            // Must be called after the list of objects or their blocking flags were changed
+            void updateBlockers();
 
             std::array<Hexagon*, HEX_SIDES>& neighbors();
 
@@ -96,6 +105,7 @@ namespace Falltergeist
             Game::Orientation orientationTo(Hexagon *hexagon);
 
         protected:
+            HexagonGrid* _grid = nullptr;
             std::array<Hexagon*, HEX_SIDES> _neighbors = {};
             std::list<Game::Object*> _objects;
             unsigned int _number = 0; // position in hexagonal grid
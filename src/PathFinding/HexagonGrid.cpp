@@ -1,5 +1,6 @@
 // Project includes
 #include "../Game/WallObject.h"
+#include "../PathFinding/HexLine.h"
 #include "../PathFinding/Hexagon.h"
 #include "../PathFinding/HexagonGrid.h"
 
@@ -7,6 +8,7 @@
 
 // stdlib
 #include <array>
+#include <cmath>
 #include <cstdlib>
 #include <queue>
 #include <memory>
@@ -33,7 +35,7 @@ namespace Falltergeist
         {
             for (unsigned int hx = 0; hx != GRID_WIDTH; ++hx, ++index) // columns
             {
-                _hexagons.emplace_back(std::make_unique<Hexagon>(index));
+                _hexagons.emplace_back(std::make_unique<Hexagon>(index, this));
                 auto& hexagon = _hexagons.back();
                 // Calculate hex's actual position
                 const bool oddCol = hx & 1;
@@ -141,7 +143,7 @@ namespace Falltergeist
 
         // if we can't go to the location
         // @todo remove when path will have length restriction
-        if (!to->canWalkThru()) {
+        if (!canWalkThru(to->number())) {
             return result;
         }
 
@@ -171,7 +173,7 @@ namespace Falltergeist
                     continue;
                 }
                 // Is that hex blocked?
-                if (!neighbor[i]->canWalkThru()) {
+                if (!canWalkThru(neighbor[i]->number())) {
                     continue;
                 }
 
@@ -291,6 +293,65 @@ namespace Falltergeist
         return result;
     }
 
+    void HexagonGrid::updateBlockers(Hexagon* hexagon)
+    {
+        bool walkBlocked = false;
+        bool shootBlocked = false;
+        bool lightBlocked = false;
+        for (const auto object : *hexagon->objects()) {
+            walkBlocked = walkBlocked || !object->canWalkThru();
+            shootBlocked = shootBlocked || !object->canShootThru();
+            lightBlocked = lightBlocked || (!object->flat() && object->type() != Game::Object::Type::DUDE && !object->canLightThru());
+        }
+        _walkBlocked[hexagon->number()] = walkBlocked;
+        _lightBlocked[hexagon->number()] = lightBlocked;
+
+        if (_shootBlocked[hexagon->number()] != shootBlocked) {
+            _lineOfSight.clear();
+        }
+        _shootBlocked[hexagon->number()] = shootBlocked;
+    }
+
+    bool HexagonGrid::lineOfSight(Hexagon* from, Hexagon* to)
+    {
+        if (from == to) {
+            return true;
+        }
+
+        // Keep memory bounded on maps where things move a lot
+        if (_lineOfSight.size() >= 65536) {
+            _lineOfSight.clear();
+        }
+
+        const uint32_t key = from->number() * GRID_WIDTH * GRID_HEIGHT + to->number();
+        auto it = _lineOfSight.find(key);
+        if (it != _lineOfSight.end()) {
+            return it->second;
+        }
+        bool result = _traceLineOfSight(from, to);
+        _lineOfSight.emplace(key, result);
+        return result;
+    }
+
+    bool HexagonGrid::_traceLineOfSight(Hexagon* from, Hexagon* to) const
+    {
+        return HexLine::walk(from->cubeX(), from->cubeZ(), to->cubeX(), to->cubeZ(), [this](int cubeX, int cubeZ) {
+            const int index = _indexAtCube(cubeX, cubeZ);
+            return index >= 0 && !_shootBlocked[index];
+        });
+    }
+
+    int HexagonGrid::_indexAtCube(int cubeX, int cubeZ) const
+    {
+        // inverse of the cube coordinates set up in the constructor
+        const int hx = cubeZ;
+        const int hy = cubeX + (cubeZ + (cubeZ & 1)) / 2;
+        if (hx < 0 || hx >= (int) GRID_WIDTH || hy < 0 || hy >= (int) GRID_HEIGHT) {
+            return -1;
+        }
+        return hy * GRID_WIDTH + hx;
+    }
+
     void HexagonGrid::initLight(Hexagon *hex, bool add)
     {
         auto objectsAtHex = hex->objects();
@@ -595,63 +656,67 @@ namespace Falltergeist
                         {
                             // find objs/walls
                             bool lightHex = true;
-                            for (auto it2 = ringhex->objects()->begin(); it2 != ringhex->objects()->end(); ++it2)
+                            // walk the objects only if something in this hex blocks light at all
+                            if (!canLightThru(ringhex->number()))
                             {
-                                auto curObject = *it2;
-                                // dead objects block nothing
-                                //if (curObject->dead()) continue;
-                                // flat objects block nothing
-                                if (curObject->flat()) {
-                                    continue;
-                                }
-                                if (curObject->type()==Game::Object::Type::DUDE) {
-                                    continue;
-                                }
-
-                                if (!curObject->canLightThru())
+                                for (auto it2 = ringhex->objects()->begin(); it2 != ringhex->objects()->end(); ++it2)
                                 {
-                                    // if wall -> check light orientation
-                                    if (auto wall = dynamic_cast<Game::WallObject*>(curObject))
+                                    auto curObject = *it2;
+                                    // dead objects block nothing
+                                    //if (curObject->dead()) continue;
+                                    // flat objects block nothing
+                                    if (curObject->flat()) {
+                                        continue;
+                                    }
+                                    if (curObject->type()==Game::Object::Type::DUDE) {
+                                        continue;
+                                    }
+
+                                    if (!curObject->canLightThru())
                                     {
-                                        if (wall->lightOrientation() == Game::Orientation::EW || wall->lightOrientation() == Game::Orientation::EC)
+                                        // if wall -> check light orientation
+                                        if (auto wall = dynamic_cast<Game::WallObject*>(curObject))
                                         {
-                                            if ( (dir != 4) && (dir != 5) && (dir>0 || coneIdx > 0) && (dir != 3 || ((coneIdx>=0 && coneIdx<=1) || (radius==3 && coneIdx==2) )))
+                                            if (wall->lightOrientation() == Game::Orientation::EW || wall->lightOrientation() == Game::Orientation::EC)
                                             {
-                                                lightHex = false;
+                                                if ( (dir != 4) && (dir != 5) && (dir>0 || coneIdx > 0) && (dir != 3 || ((coneIdx>=0 && coneIdx<=1) || (radius==3 && coneIdx==2) )))
+                                                {
+                                                    lightHex = false;
+                                                }
                                             }
-                                        }
-                                        else if (wall->lightOrientation() == Game::Orientation::NC)
-                                        {
-                                            if( dir != 0 && dir != 5)
+                                            else if (wall->lightOrientation() == Game::Orientation::NC)
                                             {
-                                                lightHex = false;
+                                                if( dir != 0 && dir != 5)
+                                                {
+                                                    lightHex = false;
+                                                }
                                             }
-                                        }
-                                        else if (wall->lightOrientation() == Game::Orientation::SC)
-                                        {
-                                            if( (dir>0) && dir != 1 && dir != 4 && dir != 5 && (dir != 3 || ((coneIdx>=0 && coneIdx<=1) || (radius==3 && coneIdx==2) )))
+                                            else if (wall->lightOrientation() == Game::Orientation::SC)
+                                            {
+                                                if( (dir>0) && dir != 1 && dir != 4 && dir != 5 && (dir != 3 || ((coneIdx>=0 && coneIdx<=1) || (radius==3 && coneIdx==2) )))
+                                                {
+                                                    lightHex = false;
+                                                }
+                                            }
+                                            else if (dir != 0 && dir != 1 && ( dir != 5 || coneIdx==0 ))
                                             {
                                                 lightHex = false;
                                             }
                                         }
-                                        else if (dir != 0 && dir != 1 && ( dir != 5 || coneIdx==0 ))
+                                        else
                                         {
-                                            lightHex = false;
-                                        }
-                                    }
-                                    else
-                                    {
-                                        if (dir>=1 && dir <=3 )
-                                        {
-                                            lightHex=false;
+                                            if (dir>=1 && dir <=3 )
+                                            {
+                                                lightHex=false;
+                                            }
                                         }
-                                    }
 
-                                    block = true;
+                                        block = true;
 
-                                    break;
-                                }
+                                        break;
+                                    }
 
+                                }
                             }
                             if (lightHex)
                             {
@@ -8,6 +8,9 @@
 
 // stdlib
 #include <array>
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 namespace Falltergeist
@@ -40,7 +43,37 @@ namespace Falltergeist
 
             void initLight(Hexagon* hex, bool add = true);
 
+            // Blocking state of every hex, kept in sync by Hexagon::updateBlockers()
+            inline bool canWalkThru(unsigned int number) const
+            {
+                return !_walkBlocked[number];
+            }
+
+            inline bool canShootThru(unsigned int number) const
+            {
+                return !_shootBlocked[number];
+            }
+
+            // Light is blocked by solid objects only, flat ones and the player never cast shadows
+            inline bool canLightThru(unsigned int number) const
+            {
+                return !_lightBlocked[number];
+            }
+
+            void updateBlockers(Hexagon* hexagon);
+
+            // Checks if nothing that stops shots stands on the hexes between two hexes.
+            // Results are memoized until a hex changes its shoot blocking state.
+            bool lineOfSight(Hexagon* from, Hexagon* to);
+
         private:
             std::vector<std::unique_ptr<Hexagon>> _hexagons; // The 200x200 grid
+            std::bitset<GRID_WIDTH * GRID_HEIGHT> _walkBlocked;
+            std::bitset<GRID_WIDTH * GRID_HEIGHT> _shootBlocked;
+            std::bitset<GRID_WIDTH * GRID_HEIGHT> _lightBlocked;
+            std::unordered_map<uint32_t, bool> _lineOfSight;
+
+            bool _traceLineOfSight(Hexagon* from, Hexagon* to) const;
+            int _indexAtCube(int cubeX, int cubeZ) const;
     };
 }
@@ -0,0 +1,103 @@
+// Project includes
+#include "ResourceCache.h"
+
+// Third-party includes
+
+// stdlib
+#include <utility>
+
+namespace Falltergeist
+{
+    size_t ResourceCache::Stats::totalBytes() const
+    {
+        size_t total = 0;
+        for (auto size : bytes) {
+            total += size;
+        }
+        return total;
+    }
+
+    void ResourceCache::hit(Category category, const std::string& name)
+    {
+        _stats.hits++;
+        if (category == Category::OTHER) {
+            return;
+        }
+        auto it = _entries.find(_key(category, name));
+        if (it != _entries.end()) {
+            _lru.splice(_lru.begin(), _lru, it->second);
+        }
+    }
+
+    void ResourceCache::miss(Category category, const std::string& name, size_t size, SizeFunction currentSize)
+    {
+        _stats.misses++;
+        _stats.bytes[static_cast<size_t>(category)] += size;
+        if (category == Category::OTHER) {
+            return;
+        }
+        _lru.push_front(Entry{category, name, size, std::move(currentSize)});
+        _entries[_key(category, name)] = _lru.begin();
+    }
+
+    void ResourceCache::trim(size_t budget, const EvictFunction& evict)
+    {
+        if (budget == 0) {
+            return;
+        }
+
+        for (auto& entry : _lru) {
+            if (entry.currentSize) {
+                auto size = entry.currentSize();
+                auto& bytes = _stats.bytes[static_cast<size_t>(entry.category)];
+                bytes = bytes - entry.size + size;
+                entry.size = size;
+            }
+        }
+
+        size_t used = evictableBytes();
+        for (auto it = _lru.end(); it != _lru.begin() && used > budget;) {
+            --it;
+            if (!evict(it->category, it->name)) {
+                continue;
+            }
+            _stats.bytes[static_cast<size_t>(it->category)] -= it->size;
+            _stats.evictions++;
+            used -= it->size;
+            _entries.erase(_key(it->category, it->name));
+            it = _lru.erase(it);
+        }
+    }
+
+    void ResourceCache::clear(Category keep)
+    {
+        for (auto it = _lru.begin(); it != _lru.end();) {
+            if (it->category == keep) {
+                ++it;
+                continue;
+            }
+            _entries.erase(_key(it->category, it->name));
+            it = _lru.erase(it);
+        }
+        for (size_t i = 0; i != CATEGORIES; ++i) {
+            if (i != static_cast<size_t>(keep)) {
+                _stats.bytes[i] = 0;
+            }
+        }
+    }
+
+    size_t ResourceCache::evictableBytes() const
+    {
+        return _stats.totalBytes() - _stats.bytes[static_cast<size_t>(Category::OTHER)];
+    }
+
+    const ResourceCache::Stats& ResourceCache::stats() const
+    {
+        return _stats;
+    }
+
+    std::string ResourceCache::_key(Category category, const std::string& name)
+    {
+        return std::to_string(static_cast<int>(category)) + ":" + name;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace Falltergeist
+{
+    /**
+     * Bookkeeping of cached resources for ResourceManager: bytes held by every category and
+     * the least recently used order of evictable resources. The resources themselves stay with their owner,
+     * which is asked to drop them on eviction.
+     */
+    class ResourceCache final
+    {
+        public:
+            // All categories but OTHER are evicted when over the memory budget
+            enum class Category
+            {
+                FRM = 0,
+                TEXTURE,
+                ACM,
+                MVE,
+                INT,
+                PRO,
+                OTHER
+            };
+
+            static const size_t CATEGORIES = static_cast<size_t>(Category::OTHER) + 1;
+
+            struct Stats
+            {
+                size_t hits = 0;
+                size_t misses = 0;
+                size_t evictions = 0;
+                std::array<size_t, CATEGORIES> bytes = {};
+
+                size_t totalBytes() const;
+            };
+
+            // Current size of a resource which grows after loading, e.g. an FRM file converted for a palette
+            using SizeFunction = std::function<size_t()>;
+
+            // Asks the owner to drop a resource, returns false if it is still in use
+            using EvictFunction = std::function<bool(Category category, const std::string& name)>;
+
+            // A hit moves the resource to the front of LRU list, a miss adds it there
+            void hit(Category category, const std::string& name);
+            void miss(Category category, const std::string& name, size_t size, SizeFunction currentSize = nullptr);
+
+            // Updates sizes of growing resources, then evicts least recently used ones
+            // until evictable resources fit into budget bytes. 0 means no limit
+            void trim(size_t budget, const EvictFunction& evict);
+
+            // Forgets all resources but the ones of given category
+            void clear(Category keep);
+
+            // Bytes held by resources of all categories but OTHER
+            size_t evictableBytes() const;
+
+            const Stats& stats() const;
+
+        private:
+            struct Entry
+            {
+                Category category;
+                std::string name;
+                size_t size;
+                SizeFunction currentSize;
+            };
+
+            // Evictable resources, most recently used first
+            std::list<Entry> _lru;
+
+            // Keys are category and name, as textures of FRM files have the same names as FRM files themselves
+            std::unordered_map<std::string, std::list<Entry>::iterator> _entries;
+
+            Stats _stats;
+
+            static std::string _key(Category category, const std::string& name);
+    };
+}
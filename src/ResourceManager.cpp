@@ -6,6 +6,7 @@
 #include "Format/Dat/Stream.h"
 #include "Format/Dat/File.h"
 #include "Format/Dat/Item.h"
+#include "Format/Dat/Prefetcher.h"
 #include "Format/Fon/File.h"
 #include "Format/Frm/File.h"
 #include "Format/Gam/File.h"
@@ -13,6 +14,7 @@
 #include "Format/Int/File.h"
 #include "Format/Lip/File.h"
 #include "Format/Lst/File.h"
+#include "Format/Map/Cache.h"
 #include "Format/Map/File.h"
 #include "Format/Msg/File.h"
 #include "Format/Mve/File.h"
@@ -41,11 +43,15 @@
 #include <SDL_image.h>
 
 // stdlib
+#include <algorithm>
+#include <exception>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <locale>
 #include <memory>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
 namespace Falltergeist {
@@ -53,22 +59,21 @@ namespace Falltergeist {
 
     namespace {
         Format::Pro::File *fetchProFileType(unsigned int PID) {
-            return ResourceManager::getInstance()->proFileType(PID);
+            // only used while the map is parsed, before cache is trimmed again
+            return ResourceManager::getInstance()->proFileType(PID).get();
         }
     }
 
     ResourceManager::ResourceManager() {
         _vfs = std::make_unique<VFS::VFS>();
 
-        for (auto filename : CrossPlatform::findFalloutDataFiles()) {
-            std::string path = CrossPlatform::findFalloutDataPath() + "/" + filename;
-            _datFiles.push_back(std::make_unique<Format::Dat::File>(path));
-            _vfs->addMount("", std::make_unique<VFS::DatArchiveDriver>(path));
-        }
+        _loadDatFiles();
 
         std::string falltergeistDataPath = CrossPlatform::findFalltergeistDataPath() + "/data";
         _vfs->addMount("data", std::make_unique<VFS::NativeDriver>(falltergeistDataPath));
         _vfs->addMount("cache", std::make_unique<VFS::MemoryDriver>());
+
+        _prefetcher = std::make_unique<Format::Dat::Prefetcher>();
     }
 
 // static
@@ -76,7 +81,77 @@ namespace Falltergeist {
         return Base::Singleton<ResourceManager>::get();
     }
 
+    void ResourceManager::_loadDatFiles() {
+        std::vector<std::string> paths;
+        for (auto filename : CrossPlatform::findFalloutDataFiles()) {
+            paths.push_back(CrossPlatform::findFalloutDataPath() + "/" + filename);
+        }
+
+        // indexes are independent, so every archive is parsed by its own thread
+        _datFiles.resize(paths.size());
+        std::vector<std::unique_ptr<VFS::DatArchiveDriver>> drivers(paths.size());
+        std::vector<std::exception_ptr> errors(paths.size());
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i != paths.size(); ++i) {
+            threads.emplace_back([this, &paths, &drivers, &errors, i]() {
+                try {
+                    _datFiles[i] = std::make_unique<Format::Dat::File>(paths[i]);
+                    drivers[i] = std::make_unique<VFS::DatArchiveDriver>(paths[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        for (auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // mount order decides which archive wins, keep the order of discovery
+        for (auto &driver : drivers) {
+            _vfs->addMount("", std::move(driver));
+        }
+
+        for (auto &datFile : _datFiles) {
+            for (auto &entry : datFile->entries()) {
+                _datEntries.push_back(&entry);
+            }
+        }
+        std::stable_sort(_datEntries.begin(), _datEntries.end(), [](Format::Dat::Entry *a, Format::Dat::Entry *b) {
+            return a->filename() < b->filename();
+        });
+        _datEntries.erase(
+            std::unique(_datEntries.begin(), _datEntries.end(), [](Format::Dat::Entry *a, Format::Dat::Entry *b) {
+                return a->filename() == b->filename();
+            }),
+            _datEntries.end()
+        );
+    }
+
+    Format::Dat::Entry *ResourceManager::_datEntry(const std::string &filename) {
+        auto it = std::lower_bound(_datEntries.begin(), _datEntries.end(), filename, [](Format::Dat::Entry *entry, const std::string &name) {
+            return entry->filename() < name;
+        });
+        if (it != _datEntries.end() && (*it)->filename() == filename) {
+            return *it;
+        }
+        return nullptr;
+    }
+
     void ResourceManager::_loadStreamForFile(std::string filename, std::function<void(Format::Dat::Stream &&)> callback) {
+        // Already read in background
+        if (_prefetcher) {
+            if (auto stream = _prefetcher->take(filename)) {
+                FALLTERGEIST_LOG_DEBUG_STATIC("RESOURCE MANAGER") << "Loading file: " << filename << " [PREFETCHED]" << std::endl;
+                callback(std::move(*stream));
+                return;
+            }
+        }
+
         // Searching file in Fallout data directory
         {
             std::string path = CrossPlatform::findFalloutDataPath() + "/" + filename;
@@ -84,12 +159,12 @@ namespace Falltergeist {
             std::ifstream stream;
             stream.open(path, std::ios_base::binary);
             if (stream.is_open()) {
-                Logger::debug("RESOURCE MANAGER") << "Loading file: " << filename << " [FROM FALLOUT DATA DIR]" << std::endl;
+                FALLTERGEIST_LOG_DEBUG_STATIC("RESOURCE MANAGER") << "Loading file: " << filename << " [FROM FALLOUT DATA DIR]" << std::endl;
             } else {
                 path = CrossPlatform::findFalltergeistDataPath() + "/" + filename;
                 stream.open(path, std::ios_base::binary);
                 if (stream.is_open()) {
-                    Logger::debug("RESOURCE MANAGER") << "Loading file: " << filename << " [FROM FALLTERGEIST DATA DIR]"
+                    FALLTERGEIST_LOG_DEBUG_STATIC("RESOURCE MANAGER") << "Loading file: " << filename << " [FROM FALLTERGEIST DATA DIR]"
                                                       << std::endl;
                 }
             }
@@ -102,168 +177,274 @@ namespace Falltergeist {
         }
 
         // Search in DAT files
-        for (auto &datfile : _datFiles) {
-            auto entry = datfile->entry(filename);
-            if (entry != nullptr) {
-                Logger::debug("RESOURCE MANAGER") << "Loading file: " << filename << " [FROM " << datfile->filename()
-                                                  << "]" << std::endl;
-                callback(Format::Dat::Stream(*entry));
-                return;
-            }
+        if (auto entry = _datEntry(filename)) {
+            FALLTERGEIST_LOG_DEBUG_STATIC("RESOURCE MANAGER") << "Loading file: " << filename << " [FROM " << entry->datFile()->filename()
+                                              << "]" << std::endl;
+            callback(Format::Dat::Stream(*entry));
+            return;
         }
         Logger::error("RESOURCE MANAGER") << "Loading file: " << filename << " [ NOT FOUND]" << std::endl;
     }
 
     template<class T>
-    T *ResourceManager::_datFileItem(std::string filename) {
+    std::shared_ptr<T> ResourceManager::_datFileItem(std::string filename, Category category) {
         std::transform(filename.begin(), filename.end(), filename.begin(), ::tolower);
 
         // Return item from cache
         auto itemIt = _datItems.find(filename);
         if (itemIt != _datItems.end()) {
-            auto itemPtr = dynamic_cast<T *>(itemIt->second.get());
+            auto itemPtr = std::dynamic_pointer_cast<T>(itemIt->second);
             if (itemPtr == nullptr) {
                 Logger::error("RESOURCE MANAGER") << "Requested file type does not match type in the cache: "
                                                   << filename << std::endl;
             }
+            _cache.hit(category, filename);
             return itemPtr;
         }
 
-        T *itemPtr = nullptr;
-        _loadStreamForFile(filename, [this, &filename, &itemPtr](Format::Dat::Stream &&stream) {
-            auto item = std::make_unique<T>(std::move(stream));
-            itemPtr = item.get();
-            item->setFilename(filename);
-            _datItems.emplace(filename, std::move(item));
+        std::shared_ptr<T> itemPtr;
+        size_t size = 0;
+        _loadStreamForFile(filename, [this, &filename, &itemPtr, &size](Format::Dat::Stream &&stream) {
+            size = stream.size();
+            itemPtr = std::make_shared<T>(std::move(stream));
+            itemPtr->setFilename(filename);
+            _datItems.emplace(filename, itemPtr);
         });
+        if (itemPtr) {
+            ResourceCache::SizeFunction currentSize;
+            // FRM files keep the image and mask converted for a palette, they are counted once made
+            if constexpr (std::is_same<T, Format::Frm::File>::value) {
+                auto frm = itemPtr.get();
+                currentSize = [frm, size]() { return size + frm->decodedSize(); };
+            }
+            _cache.miss(category, filename, size, std::move(currentSize));
+        }
 
         return itemPtr;
     }
 
-    template<typename T>
-    std::unique_ptr<T> ResourceManager::_datFileItemUniquePtr(std::string filename) {
-        std::transform(filename.begin(), filename.end(), filename.begin(), ::tolower);
+    bool ResourceManager::_evict(Category category, const std::string &name) {
+        switch (category) {
+            case Category::TEXTURE: {
+                auto it = _textures.find(name);
+                if (it != _textures.end()) {
+                    if (it->second.use_count() > 1) {
+                        return false;
+                    }
+                    _textures.erase(it);
+                }
+                return true;
+            }
+            case Category::INT: {
+                auto it = _intFiles.find(name);
+                if (it != _intFiles.end()) {
+                    // the SID cache holds same files
+                    long references = 1;
+                    for (auto &bySID : _intFilesBySID) {
+                        references += bySID.second == it->second ? 1 : 0;
+                    }
+                    if (it->second.use_count() > references) {
+                        return false;
+                    }
+                    for (auto bySID = _intFilesBySID.begin(); bySID != _intFilesBySID.end();) {
+                        bySID = bySID->second == it->second ? _intFilesBySID.erase(bySID) : std::next(bySID);
+                    }
+                    _intFiles.erase(it);
+                }
+                return true;
+            }
+            default: {
+                auto it = _datItems.find(name);
+                if (it != _datItems.end()) {
+                    if (it->second.use_count() > 1) {
+                        return false;
+                    }
+                    _datItems.erase(it);
+                }
+                return true;
+            }
+        }
+    }
 
-        std::unique_ptr<T> itemPtr = nullptr;
-        _loadStreamForFile(filename, [&itemPtr](Format::Dat::Stream &&stream) {
-            itemPtr = std::make_unique<T>(std::move(stream));
+    void ResourceManager::setMemoryBudget(size_t value) {
+        _memoryBudget = value;
+    }
+
+    void ResourceManager::trim() {
+        _cache.trim(_memoryBudget, [this](Category category, const std::string &name) {
+            return _evict(category, name);
         });
+    }
 
-        return itemPtr;
+    const ResourceManager::CacheStats &ResourceManager::cacheStats() const {
+        return _cache.stats();
     }
 
-    Format::Frm::File *ResourceManager::frmFileType(const std::string &filename) {
+    std::shared_ptr<Format::Frm::File> ResourceManager::frmFileType(const std::string &filename) {
         // TODO: Maybe get rid of all wrappers like this and call template function directly from outside.
-        return _datFileItem<Format::Frm::File>(filename);
+        return _datFileItem<Format::Frm::File>(filename, Category::FRM);
     }
 
     Format::Pal::File *ResourceManager::palFileType(const std::string &filename) {
-        return _datFileItem<Format::Pal::File>(filename);
+        return _datFileItem<Format::Pal::File>(filename).get();
     }
 
     Format::Lip::File *ResourceManager::lipFileType(const std::string &filename) {
-        return _datFileItem<Format::Lip::File>(filename);
+        return _datFileItem<Format::Lip::File>(filename).get();
     }
 
     Format::Lst::File *ResourceManager::lstFileType(const std::string &filename) {
-        return _datFileItem<Format::Lst::File>(filename);
+        return _datFileItem<Format::Lst::File>(filename).get();
     }
 
     Format::Aaf::File *ResourceManager::aafFileType(const std::string &filename) {
-        return _datFileItem<Format::Aaf::File>(filename);
+        return _datFileItem<Format::Aaf::File>(filename).get();
     }
 
-    Format::Acm::File *ResourceManager::acmFileType(const std::string &filename) {
-        return _datFileItem<Format::Acm::File>(filename);
+    std::shared_ptr<Format::Acm::File> ResourceManager::acmFileType(const std::string &filename) {
+        return _datFileItem<Format::Acm::File>(filename, Category::ACM);
     }
 
     Format::Fon::File *ResourceManager::fonFileType(const std::string &filename) {
-        return _datFileItem<Format::Fon::File>(filename);
+        return _datFileItem<Format::Fon::File>(filename).get();
     }
 
     Format::Gam::File *ResourceManager::gamFileType(const std::string &filename) {
-        return _datFileItem<Format::Gam::File>(filename);
+        return _datFileItem<Format::Gam::File>(filename).get();
     }
 
     Format::Gcd::File *ResourceManager::gcdFileType(const std::string &filename) {
-        return _datFileItem<Format::Gcd::File>(filename);
+        return _datFileItem<Format::Gcd::File>(filename).get();
     }
 
-    std::unique_ptr<Format::Int::File> ResourceManager::intFileType(const std::string &filename) {
-        return _datFileItemUniquePtr<Format::Int::File>(filename);
+    std::shared_ptr<Format::Int::File> ResourceManager::intFileType(const std::string &filename) {
+        std::string name = filename;
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+        auto it = _intFiles.find(name);
+        if (it != _intFiles.end()) {
+            if (it->second) {
+                _cache.hit(Category::INT, name);
+            }
+            return it->second;
+        }
+
+        std::shared_ptr<Format::Int::File> intFile;
+        size_t size = 0;
+        _loadStreamForFile(name, [&intFile, &name, &size](Format::Dat::Stream &&stream) {
+            size = stream.size();
+            intFile = std::make_shared<Format::Int::File>(std::move(stream));
+            intFile->setFilename(name);
+        });
+        // missing scripts are remembered as well
+        _intFiles.emplace(name, intFile);
+        if (intFile) {
+            _cache.miss(Category::INT, name, size);
+        }
+        return intFile;
     }
 
     Format::Msg::File *ResourceManager::msgFileType(const std::string &filename) {
-        return _datFileItem<Format::Msg::File>(filename);
+        return _datFileItem<Format::Msg::File>(filename).get();
     }
 
-    Format::Mve::File *ResourceManager::mveFileType(const std::string &filename) {
-        return _datFileItem<Format::Mve::File>(filename);
+    Format::Msg::File *ResourceManager::dialogMsgFileType(unsigned int SID) {
+        auto it = _dialogMsgFilesBySID.find(SID);
+        if (it != _dialogMsgFilesBySID.end()) {
+            return it->second;
+        }
+
+        auto lst = lstFileType("scripts/scripts.lst");
+        if (SID >= lst->strings()->size()) {
+            throw Exception("ResourceManager::dialogMsgFileType() - wrong SID: " + std::to_string(SID));
+        }
+
+        const auto& scriptName = lst->strings()->at(SID);
+        auto msg = msgFileType("text/english/dialog/" + scriptName.substr(0, scriptName.find(".int")) + ".msg");
+        // missing files are remembered as well
+        _dialogMsgFilesBySID.emplace(SID, msg);
+        return msg;
+    }
+
+    std::shared_ptr<Format::Mve::File> ResourceManager::mveFileType(const std::string &filename) {
+        return _datFileItem<Format::Mve::File>(filename, Category::MVE);
     }
 
     Format::Bio::File *ResourceManager::bioFileType(const std::string &filename) {
-        return _datFileItem<Format::Bio::File>(filename);
+        return _datFileItem<Format::Bio::File>(filename).get();
     }
 
     Format::Map::File *ResourceManager::mapFileType(const std::string &filename) {
-        auto item = _datFileItem<Format::Map::File>(filename);
+        auto item = _datFileItem<Format::Map::File>(filename).get();
         if (item) {
-            item->init(&fetchProFileType);
+            // parsed maps are kept in the user config dir, so next visits skip parsing; prototypes are only checked for changes
+            static const std::string cacheDirectory = CrossPlatform::getConfigPath() + "/cache/maps";
+            std::string cacheName = filename;
+            std::replace(cacheName.begin(), cacheName.end(), '/', '_');
+            std::string cachePath = cacheDirectory + "/" + cacheName + ".cache";
+
+            if (!Format::Map::Cache::read(*item, cachePath, &fetchProFileType)) {
+                item->init(&fetchProFileType);
+                CrossPlatform::createDirectory(cacheDirectory);
+                Format::Map::Cache::write(*item, cachePath);
+            }
         }
         return item;
     }
 
-    Format::Pro::File *ResourceManager::proFileType(const std::string &filename) {
-        return _datFileItem<Format::Pro::File>(filename);
+    std::shared_ptr<Format::Pro::File> ResourceManager::proFileType(const std::string &filename) {
+        return _datFileItem<Format::Pro::File>(filename, Category::PRO);
     }
 
     Format::Rix::File *ResourceManager::rixFileType(const std::string &filename) {
-        return _datFileItem<Format::Rix::File>(filename);
+        return _datFileItem<Format::Rix::File>(filename).get();
     }
 
     Format::Sve::File *ResourceManager::sveFileType(const std::string &filename) {
-        return _datFileItem<Format::Sve::File>(filename);
+        return _datFileItem<Format::Sve::File>(filename).get();
     }
 
     Format::Txt::CityFile *ResourceManager::cityTxt() {
-        return _datFileItem<Format::Txt::CityFile>("data/city.txt");
+        return _datFileItem<Format::Txt::CityFile>("data/city.txt").get();
     }
 
     Format::Txt::MapsFile *ResourceManager::mapsTxt() {
-        return _datFileItem<Format::Txt::MapsFile>("data/maps.txt");
+        return _datFileItem<Format::Txt::MapsFile>("data/maps.txt").get();
     }
 
     Format::Txt::WorldmapFile *ResourceManager::worldmapTxt() {
-        return _datFileItem<Format::Txt::WorldmapFile>("data/worldmap.txt");
+        return _datFileItem<Format::Txt::WorldmapFile>("data/worldmap.txt").get();
     }
 
     Format::Txt::EndDeathFile *ResourceManager::endDeathTxt() {
-        return _datFileItem<Format::Txt::EndDeathFile>("data/enddeath.txt");
+        return _datFileItem<Format::Txt::EndDeathFile>("data/enddeath.txt").get();
     }
 
     Format::Txt::EndGameFile *ResourceManager::endGameTxt() {
-        return _datFileItem<Format::Txt::EndGameFile>("data/endgame.txt");
+        return _datFileItem<Format::Txt::EndGameFile>("data/endgame.txt").get();
     }
 
     Format::Txt::GenRepFile *ResourceManager::genRepTxt() {
-        return _datFileItem<Format::Txt::GenRepFile>("data/genrep.txt");
+        return _datFileItem<Format::Txt::GenRepFile>("data/genrep.txt").get();
     }
 
     Format::Txt::HolodiskFile *ResourceManager::holodiskTxt() {
-        return _datFileItem<Format::Txt::HolodiskFile>("data/holodisk.txt");
+        return _datFileItem<Format::Txt::HolodiskFile>("data/holodisk.txt").get();
     }
 
     Format::Txt::KarmaVarFile *ResourceManager::karmaVarTxt() {
-        return _datFileItem<Format::Txt::KarmaVarFile>("data/karmavar.txt");
+        return _datFileItem<Format::Txt::KarmaVarFile>("data/karmavar.txt").get();
     }
 
     Format::Txt::QuestsFile *ResourceManager::questsTxt() {
-        return _datFileItem<Format::Txt::QuestsFile>("data/quests.txt");
+        return _datFileItem<Format::Txt::QuestsFile>("data/quests.txt").get();
     }
 
-    Graphics::Texture *ResourceManager::texture(const std::string &filename) {
-        if (_textures.count(filename)) {
-            return _textures.at(filename).get();
+    std::shared_ptr<Graphics::Texture> ResourceManager::texture(const std::string &filename) {
+        auto it = _textures.find(filename);
+        if (it != _textures.end()) {
+            _cache.hit(Category::TEXTURE, filename);
+            return it->second;
         }
 
         std::string ext = filename.substr(filename.length() - 4);
@@ -329,8 +510,10 @@ namespace Falltergeist {
             throw Exception("ResourceManager::surface() - unknown image type:" + filename);
         }
 
-        _textures.insert(make_pair(filename, std::unique_ptr<Graphics::Texture>(texture)));
-        return texture;
+        std::shared_ptr<Graphics::Texture> shared(texture);
+        _textures.emplace(filename, shared);
+        _cache.miss(Category::TEXTURE, filename, static_cast<size_t>(texture->size().width()) * texture->size().height() * 4);
+        return shared;
     }
 
     Graphics::Font *ResourceManager::font(const std::string &filename) {
@@ -359,7 +542,7 @@ namespace Falltergeist {
         return _shaders.at(filename);
     }
 
-    Format::Pro::File *ResourceManager::proFileType(unsigned int PID) {
+    std::shared_ptr<Format::Pro::File> ResourceManager::proFileType(unsigned int PID) {
         unsigned int typeId = PID >> 24;
         std::string listFile;
         switch ((OBJECT_TYPE) typeId) {
@@ -416,9 +599,15 @@ namespace Falltergeist {
 
     void ResourceManager::unloadResources() {
         _datItems.clear();
+        _dialogMsgFilesBySID.clear();
+        _intFilesBySID.clear();
+        _intFiles.clear();
+
+        // textures stay
+        _cache.clear(Category::TEXTURE);
     }
 
-    Format::Frm::File *ResourceManager::frmFileType(unsigned int FID) {
+    std::shared_ptr<Format::Frm::File> ResourceManager::frmFileType(unsigned int FID) {
         const auto &frmName = FIDtoFrmName(FID);
 
         if (frmName.empty()) {
@@ -427,13 +616,23 @@ namespace Falltergeist {
         return frmFileType(frmName);
     }
 
-    std::unique_ptr<Format::Int::File> ResourceManager::intFileType(unsigned int SID) {
+    std::shared_ptr<Format::Int::File> ResourceManager::intFileType(unsigned int SID) {
+        auto it = _intFilesBySID.find(SID);
+        if (it != _intFilesBySID.end()) {
+            if (it->second) {
+                _cache.hit(Category::INT, it->second->filename());
+            }
+            return it->second;
+        }
+
         auto lst = lstFileType("scripts/scripts.lst");
         if (SID >= lst->strings()->size()) {
             throw Exception("ResourceManager::intFileType() - wrong SID: " + std::to_string(SID));
         }
 
-        return intFileType("scripts/" + lst->strings()->at(SID));
+        auto intFile = intFileType("scripts/" + lst->strings()->at(SID));
+        _intFilesBySID.emplace(SID, intFile);
+        return intFile;
     }
 
     std::string ResourceManager::FIDtoFrmName(unsigned int FID) {
@@ -481,7 +680,55 @@ namespace Falltergeist {
         return typeArtDescription.prefixPath + frmName;
     }
 
+    unsigned int ResourceManager::startPrefetch(size_t memoryBudget) {
+        return _prefetcher ? _prefetcher->startBatch(memoryBudget) : 0;
+    }
+
+    bool ResourceManager::prefetch(unsigned int batch, const std::string &filename) {
+        if (!_prefetcher) {
+            return false;
+        }
+
+        std::string name = filename;
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        if (_prefetcher->ready(name) || _prefetcher->pending(name)) {
+            return true;
+        }
+
+        // files in data directories take precedence over DAT files, see _loadStreamForFile()
+        if (CrossPlatform::fileExists(CrossPlatform::findFalloutDataPath() + "/" + name)
+            || CrossPlatform::fileExists(CrossPlatform::findFalltergeistDataPath() + "/" + name)) {
+            return false;
+        }
+
+        if (auto entry = _datEntry(name)) {
+            return _prefetcher->request(batch, name, entry, entry->datFile()->filename());
+        }
+        return false;
+    }
+
+    bool ResourceManager::prefetched(const std::string &filename) {
+        std::string name = filename;
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        return _prefetcher && _prefetcher->ready(name);
+    }
+
+    bool ResourceManager::prefetching(const std::string &filename) {
+        std::string name = filename;
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        return _prefetcher && _prefetcher->pending(name);
+    }
+
+    void ResourceManager::cancelPrefetch(unsigned int batch) {
+        if (_prefetcher) {
+            _prefetcher->cancel(batch);
+        }
+    }
+
     void ResourceManager::shutdown() {
+        _prefetcher.reset();
+        Logger::info("RESOURCE MANAGER") << "Cache hits: " << _cache.stats().hits << ", misses: " << _cache.stats().misses
+                                         << ", evictions: " << _cache.stats().evictions << std::endl;
         unloadResources();
     }
 
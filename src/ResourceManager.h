@@ -3,6 +3,7 @@
 // Project includes
 #include "Base/Singleton.h"
 #include "Format/Int/File.h"
+#include "ResourceCache.h"
 
 // Third-party includes
 #include "falltergeist/vfs/VFS.h"
@@ -26,8 +27,10 @@ namespace Falltergeist
         namespace Bio { class File; }
         namespace Dat
         {
+            class Entry;
             class File;
             class Item;
+            class Prefetcher;
             class Stream;
         }
         namespace Frm { class File; }
@@ -83,27 +86,36 @@ namespace Falltergeist
     class ResourceManager final
     {
         public:
+            // Cached resources are accounted by these categories, all but OTHER are evicted when over the memory budget
+            using Category = ResourceCache::Category;
+
+            using CacheStats = ResourceCache::Stats;
+
             static ResourceManager* getInstance();
 
             Format::Aaf::File* aafFileType(const std::string& filename);
-            Format::Acm::File* acmFileType(const std::string& filename);
+            // Evictable resources are shared; keep the pointer while using them across frames
+            std::shared_ptr<Format::Acm::File> acmFileType(const std::string& filename);
             Format::Bio::File* bioFileType(const std::string& filename);
             Format::Dat::Item* datFileItem(const std::string& filename);
-            Format::Frm::File* frmFileType(const std::string& filename);
-            Format::Frm::File* frmFileType(unsigned int FID);
+            std::shared_ptr<Format::Frm::File> frmFileType(const std::string& filename);
+            std::shared_ptr<Format::Frm::File> frmFileType(unsigned int FID);
             Format::Fon::File* fonFileType(const std::string& filename);
             Format::Gam::File* gamFileType(const std::string& filename);
             Format::Gcd::File* gcdFileType(const std::string& filename);
             Format::Pal::File* palFileType(const std::string& filename);
-            std::unique_ptr<Format::Int::File> intFileType(const std::string& filename);
-            std::unique_ptr<Format::Int::File> intFileType(unsigned int SID);
+            // Compiled scripts are shared by all their instances
+            std::shared_ptr<Format::Int::File> intFileType(const std::string& filename);
+            std::shared_ptr<Format::Int::File> intFileType(unsigned int SID);
             Format::Lip::File* lipFileType(const std::string& filename);
             Format::Lst::File* lstFileType(const std::string& filename);
             Format::Map::File* mapFileType(const std::string& filename);
             Format::Msg::File* msgFileType(const std::string& filename);
-            Format::Mve::File* mveFileType(const std::string& filename);
-            Format::Pro::File* proFileType(const std::string& filename);
-            Format::Pro::File* proFileType(unsigned int PID);
+            // Dialog messages of the script with given SID
+            Format::Msg::File* dialogMsgFileType(unsigned int SID);
+            std::shared_ptr<Format::Mve::File> mveFileType(const std::string& filename);
+            std::shared_ptr<Format::Pro::File> proFileType(const std::string& filename);
+            std::shared_ptr<Format::Pro::File> proFileType(unsigned int PID);
             Format::Rix::File* rixFileType(const std::string& filename);
             Format::Sve::File* sveFileType(const std::string& filename);
 
@@ -117,11 +129,31 @@ namespace Falltergeist
             Format::Txt::KarmaVarFile* karmaVarTxt();
             Format::Txt::QuestsFile* questsTxt();
 
-            Graphics::Texture* texture(const std::string& filename);
+            std::shared_ptr<Graphics::Texture> texture(const std::string& filename);
             Graphics::Font* font(const std::string& filename = "font1.aaf");
 
             std::shared_ptr<Graphics::Shader>& shader(const std::string& filename);
 
+            // Starts a group of background reads limited by memoryBudget bytes, returns its id
+            unsigned int startPrefetch(size_t memoryBudget);
+            // Queues reading of a DAT file on the background thread; next load of the file takes the read data.
+            // Returns false if the file is not in DAT files or doesn't fit into the budget
+            bool prefetch(unsigned int batch, const std::string& filename);
+            // True once the background read of the file is done
+            bool prefetched(const std::string& filename);
+            // True while the file waits for or is being read by the background thread
+            bool prefetching(const std::string& filename);
+            void cancelPrefetch(unsigned int batch);
+
+            // Memory for evictable resources, in bytes. 0 means no limit
+            void setMemoryBudget(size_t value);
+
+            // Evicts least recently used resources nobody else holds until the cache fits into the memory budget.
+            // Called between frames, as raw pointers to cached files are only valid until then
+            void trim();
+
+            const CacheStats& cacheStats() const;
+
             void unloadResources();
             std::string FIDtoFrmName(unsigned int FID);
             Game::Location* gameLocation(unsigned int number);
@@ -135,16 +167,32 @@ namespace Falltergeist
 
             std::vector<std::unique_ptr<Format::Dat::File>> _datFiles;
 
-            std::unordered_map<std::string, std::unique_ptr<Format::Dat::Item>> _datItems;
+            // entries of all DAT files sorted by filename, an entry of an earlier DAT file hides later ones
+            std::vector<Format::Dat::Entry*> _datEntries;
+
+            // declared after DAT files, so its thread is stopped before entries go away
+            std::unique_ptr<Format::Dat::Prefetcher> _prefetcher;
 
-            std::unordered_map<std::string, std::unique_ptr<Graphics::Texture>> _textures;
+            std::unordered_map<std::string, std::shared_ptr<Format::Dat::Item>> _datItems;
+
+            std::unordered_map<std::string, std::shared_ptr<Graphics::Texture>> _textures;
 
             std::unordered_map<std::string, std::unique_ptr<Graphics::Font>> _fonts;
 
             std::unordered_map<std::string, std::shared_ptr<Graphics::Shader>> _shaders;
 
+            std::unordered_map<std::string, std::shared_ptr<Format::Int::File>> _intFiles;
+
+            std::unordered_map<unsigned int, std::shared_ptr<Format::Int::File>> _intFilesBySID;
+
+            std::unordered_map<unsigned int, Format::Msg::File*> _dialogMsgFilesBySID;
+
             std::unique_ptr<VFS::VFS> _vfs;
 
+            ResourceCache _cache;
+
+            size_t _memoryBudget = 0;
+
             ResourceManager();
 
             ResourceManager(const ResourceManager&) = delete;
@@ -154,10 +202,13 @@ namespace Falltergeist
             // Retrieves given file item from "virtual file system".
             // All items are cached after being requested for the first time.
             template <class T>
-            T* _datFileItem(std::string filename);
+            std::shared_ptr<T> _datFileItem(std::string filename, Category category = Category::OTHER);
+
+            // Drops a resource evicted from the cache, returns false if it's still in use
+            bool _evict(Category category, const std::string& name);
 
-            template<typename T>
-            std::unique_ptr<T> _datFileItemUniquePtr(std::string filename);
+            void _loadDatFiles();
+            Format::Dat::Entry* _datEntry(const std::string& filename);
 
             // Searches for a given file within virtual "file system" and calls the given callback with Dat::Stream created from that file.
             void _loadStreamForFile(std::string filename, std::function<void(Format::Dat::Stream&&)> callback);
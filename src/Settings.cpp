@@ -67,6 +67,9 @@ namespace Falltergeist
         game->setPropertyBool("display_fps", _displayFps);
         game->setPropertyBool("worldmap_fullscreen", _worldMapFullscreen);
         game->setPropertyBool("display_mouse_position", _displayMousePosition);
+        game->setPropertyBool("profile_scripts", _profileScripts);
+        game->setPropertyInt("prefetch_memory", _prefetchMemory);
+        game->setPropertyInt("resource_memory", _resourceMemory);
 
         auto preferences = file.section("preferences");
         preferences->setPropertyDouble("brightness", _brightness);
@@ -183,6 +186,9 @@ namespace Falltergeist
             _displayFps = game->propertyBool("display_fps", _displayFps);
             _worldMapFullscreen = game->propertyBool("worldmap_fullscreen", _worldMapFullscreen);
             _displayMousePosition = game->propertyBool("display_mouse_position", _displayMousePosition);
+            _profileScripts = game->propertyBool("profile_scripts", _profileScripts);
+            _prefetchMemory = game->propertyInt("prefetch_memory", _prefetchMemory);
+            _resourceMemory = game->propertyInt("resource_memory", _resourceMemory);
         }
 
         auto preferences = file->section("preferences");
@@ -224,6 +230,21 @@ namespace Falltergeist
         return _displayMousePosition;
     }
 
+    bool Settings::profileScripts() const
+    {
+        return _profileScripts;
+    }
+
+    unsigned int Settings::prefetchMemory() const
+    {
+        return _prefetchMemory;
+    }
+
+    unsigned int Settings::resourceMemory() const
+    {
+        return _resourceMemory;
+    }
+
     void Settings::setVoiceVolume(double _voiceVolume)
     {
         this->_voiceVolume = _voiceVolume;
@@ -46,6 +46,14 @@ namespace Falltergeist
 
             bool displayMousePosition() const;
 
+            bool profileScripts() const;
+
+            // Memory for reading maps behind exit grids ahead of time, in megabytes. 0 turns it off
+            unsigned int prefetchMemory() const;
+
+            // Memory for cached art, sounds, movies, scripts and protos, in megabytes. 0 means no limit
+            unsigned int resourceMemory() const;
+
             bool audioEnabled() const;
             void setVoiceVolume(double _voiceVolume);
             double voiceVolume() const;
@@ -107,6 +115,9 @@ namespace Falltergeist
             bool _displayFps = true;
             bool _worldMapFullscreen = false;
             bool _displayMousePosition = true;
+            bool _profileScripts = false;
+            unsigned int _prefetchMemory = 64;
+            unsigned int _resourceMemory = 512;
             std::string _loggerLevel = "info";
             bool _loggerColors = true;
             unsigned int _scale = 0;
@@ -176,11 +176,11 @@ namespace Falltergeist::State {
             // TODO: probably need to make invisible panel to catch all mouse events..
 
             if (mouseEvent->originalType() == Event::Mouse::Type::BUTTON_DOWN) {
-                emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), _mouseDownHandler);
+                emitEvent(Event::Mouse(*mouseEvent), _mouseDownHandler);
             } else if (mouseEvent->originalType() == Event::Mouse::Type::BUTTON_UP) {
-                emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), _mouseUpHandler);
+                emitEvent(Event::Mouse(*mouseEvent), _mouseUpHandler);
             } else if (mouseEvent->originalType() == Event::Mouse::Type::MOVE) {
-                emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), _mouseMoveHandler);
+                emitEvent(Event::Mouse(*mouseEvent), _mouseMoveHandler);
                 event->stopPropagation();
             }
         }
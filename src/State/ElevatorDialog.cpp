@@ -4,6 +4,7 @@
 #include "../Game/Game.h"
 #include "../Graphics/Renderer.h"
 #include "../Input/Mouse.h"
+#include "../Logger.h"
 #include "../ResourceManager.h"
 #include "../State/Location.h"
 #include "../State/MainMenu.h"
@@ -86,13 +87,13 @@ namespace Falltergeist
                 labelsFrmLstId = this->_elevator->labelsFID();
             }
 
-            logger->debug() << "loaded elevator frm=" << panelFrmLstId  << std::endl;
-            logger->debug() << "loaded elevator labels frm=" << labelsFrmLstId << std::endl;
+            FALLTERGEIST_LOG_DEBUG(logger) << "loaded elevator frm=" << panelFrmLstId  << std::endl;
+            FALLTERGEIST_LOG_DEBUG(logger) << "loaded elevator labels frm=" << labelsFrmLstId << std::endl;
 
             int totalButtons = this->_elevator->size();
             auto bgfid = ((unsigned int)FRM_TYPE::INTERFACE << 24) | panelFrmLstId;
             auto bgfrmFilename = ResourceManager::getInstance()->FIDtoFrmName(bgfid);
-            logger->debug() << "bgfrmFilename = " << bgfrmFilename << std::endl;
+            FALLTERGEIST_LOG_DEBUG(logger) << "bgfrmFilename = " << bgfrmFilename << std::endl;
 
             auto background = resourceManager->getImage(bgfrmFilename);
             auto panelHeight = Game::Game::getInstance()->locationState()->playerPanel()->size().height();
@@ -112,7 +113,7 @@ namespace Falltergeist
             {
                 auto labelsfid = ((unsigned int)FRM_TYPE::INTERFACE << 24) | labelsFrmLstId;
                 auto labelsfrmFilename = ResourceManager::getInstance()->FIDtoFrmName(labelsfid);
-                logger->debug() << "labelsfrmFilename = " << labelsfrmFilename << std::endl;
+                FALLTERGEIST_LOG_DEBUG(logger) << "labelsfrmFilename = " << labelsfrmFilename << std::endl;
                 auto labels = resourceManager->getImage(labelsfrmFilename);
                 labels->setPosition(backgroundPos + Point(0, 36));
                 addUI(labels);
@@ -5,6 +5,7 @@
 #include "../Event/State.h"
 #include "../functions.h"
 #include "../Game/Game.h"
+#include "../Game/Snapshot.h"
 #include "../Graphics/Color.h"
 #include "../Graphics/Point.h"
 #include "../Graphics/Renderer.h"
@@ -96,6 +97,10 @@ namespace Falltergeist
 
         void LoadGame::onDoneButtonClick(Event::Mouse* event)
         {
+            // on success the loaded location replaces the whole state stack, this state included
+            if (Game::Snapshot::load(Game::Snapshot::slotFilename(1))) {
+                return;
+            }
             Game::Game::getInstance()->popState();
         }
 
@@ -41,7 +41,9 @@
 
 // stdlib
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <list>
 #include <memory>
 
@@ -55,6 +57,8 @@ namespace Falltergeist
 
         const int Location::DROPDOWN_DELAY = 350;
         const int Location::KEYBOARD_SCROLL_STEP = 35;
+        const double Location::MAP_UPDATE_BUDGET = 2.0;
+        const double Location::PREFETCH_BUDGET = 1.0;
 
         Location::Location(
             std::shared_ptr<Game::DudeObject> player,
@@ -98,6 +102,7 @@ namespace Falltergeist
             _objects.clear();
             _flatObjects.clear();
             _spatials.clear();
+            _objectsByPID.clear();
 
             _hexagonGrid = std::make_unique<HexagonGrid>();
 
@@ -111,6 +116,7 @@ namespace Falltergeist
             for (auto& object : *elevation->objects()) {
                 auto& hexagon = hexagonGrid()->at(object->position());
                 moveObjectToHexagon(object, hexagon.get(), false);
+                _objectsByPID.add(object);
 
                 if (object->ui()) {
                     object->ui()->mouseDownHandler().add(
@@ -170,7 +176,11 @@ namespace Falltergeist
                 _objects.emplace_back(object);
             }
 
-            initializePlayerTestAppareance(player);
+            if (!_playerRestored) {
+                initializePlayerTestAppareance(player);
+            }
+            player->setActionAnimation("aa")->stop();
+            player->setPID(0x01000001);
             player->setOrientation(_location->defaultOrientation());
 
             // Player script
@@ -182,6 +192,8 @@ namespace Falltergeist
             auto& hexagon = hexagonGrid()->at(_location->defaultPosition());
             _objects.emplace_back(player);
             moveObjectToHexagon(player.get(), hexagon.get());
+            // the player keeps its position from the previous map, so it is indexed here like map objects
+            _objectsByPID.add(player.get());
 
             elevation->floor()->init();
             elevation->roof()->init();
@@ -236,14 +248,12 @@ namespace Falltergeist
 
             _locationScriptTimer.start(10000.0f, true);
             _locationScriptTimer.tickHandler().add([this](Event::Event*) {
-                if (_location->script()) {
-                    _location->script()->call("map_update_p_proc");
-                }
-                for (auto &object : _objects) {
-                    object->map_update_p_proc();
-                }
-                player->map_update_p_proc();
+                startMapUpdate();
             });
+
+            if (settings->prefetchMemory() > 0) {
+                _prefetcher = std::make_unique<Game::LocationPrefetcher>(*_location, settings->prefetchMemory() * 1024u * 1024u);
+            }
         }
 
         void Location::onStateActivate(Event::State *event)
@@ -266,6 +276,11 @@ namespace Falltergeist
             _location = std::move(location);
         }
 
+        void Location::setPlayerRestored(bool value)
+        {
+            _playerRestored = value;
+        }
+
         void Location::loadAmbient(const std::string &name)
         {
             auto maps = ResourceManager::getInstance()->mapsTxt()->maps();
@@ -375,8 +390,6 @@ namespace Falltergeist
             player->inventory()->push_back(purpleRobe);
             player->setLeftHandSlot(miniGun);
             player->setRightHandSlot(spear);
-            player->setActionAnimation("aa")->stop();
-            player->setPID(0x01000001);
         }
 
         std::vector<Input::Mouse::Icon> Location::getCursorIconsForObject(Game::Object *object)
@@ -538,15 +551,62 @@ namespace Falltergeist
             _locationScriptTimer.think(deltaTime);
             _actionCursorTimer.think(deltaTime);
             _ambientSfxTimer.think(deltaTime);
+            processMapUpdate(MAP_UPDATE_BUDGET);
+            if (_prefetcher) {
+                _prefetcher->think(PREFETCH_BUDGET);
+            }
 
-            for (auto it = _timerEvents.begin(); it != _timerEvents.end();) {
-                it->timer.think(deltaTime);
-                if (!it->timer.enabled()) {
-                    it = _timerEvents.erase(it);
-                } else {
-                    ++it;
+            _timerEvents.think(deltaTime, [](Game::Object* object, int fixedParam) {
+                if (object) {
+                    if (auto& vm = object->script()) {
+                        vm->setFixedParam(fixedParam);
+                        vm->call("timed_event_p_proc");
+                    }
+                }
+            });
+        }
+
+        void Location::startMapUpdate()
+        {
+            // previous update must not lose anybody
+            processMapUpdate(-1);
+
+            if (_location->script()) {
+                _location->script()->call("map_update_p_proc");
+            }
+
+            _mapUpdateQueue.clear();
+            _mapUpdateNext = 0;
+            for (auto &object : _objects) {
+                _mapUpdateQueue.push_back(object);
+            }
+            _mapUpdateQueue.push_back(player);
+        }
+
+        void Location::processMapUpdate(double budget)
+        {
+            if (_mapUpdateNext == _mapUpdateQueue.size()) {
+                return;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            while (_mapUpdateNext != _mapUpdateQueue.size()) {
+                // objects destroyed in the meantime are skipped
+                if (auto object = _mapUpdateQueue[_mapUpdateNext++].lock()) {
+                    object->map_update_p_proc();
+                }
+                if (budget >= 0) {
+                    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+                    if (elapsed.count() >= budget) {
+                        break;
+                    }
                 }
             }
+
+            if (_mapUpdateNext == _mapUpdateQueue.size()) {
+                _mapUpdateQueue.clear();
+                _mapUpdateNext = 0;
+            }
         }
 
         void Location::firstLocationEnter(const float &deltaTime) const
@@ -630,15 +690,15 @@ namespace Falltergeist
                 using Mouse = Event::Mouse;
 
                 if (mouseEvent->originalType() == Mouse::Type::BUTTON_DOWN) {
-                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), _mouseDownHandler);
+                    emitEvent(Event::Mouse(*mouseEvent), _mouseDownHandler);
                 }
 
                 if (mouseEvent->originalType() == Mouse::Type::BUTTON_UP) {
-                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), _mouseUpHandler);
+                    emitEvent(Event::Mouse(*mouseEvent), _mouseUpHandler);
                 }
 
                 if (mouseEvent->originalType() == Mouse::Type::MOVE) {
-                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), _mouseMoveHandler);
+                    emitEvent(Event::Mouse(*mouseEvent), _mouseMoveHandler);
                 }
 
                 // let event fall down to all objects when using action cursor and within active view
@@ -654,44 +714,74 @@ namespace Falltergeist
 
         void Location::handleByGameObjects(Event::Mouse *event)
         {
-            for (auto it = _objects.rbegin(); it != _objects.rend(); ++it) {
-                auto object = (*it).get();
+            // handling order is the reverse of rendering order: objects first, then flat objects
+            for (auto id : hitTestCandidates(event->position(), true)) {
                 if (event->isHandled()) {
                     return;
                 }
-                if (!object->inRender()) {
-                    continue;
-                }
+                auto object = _hitTestObjects.at(id);
                 object->handle(event);
+
+                if (object->ui() && object->ui()->hasMouseInteraction()
+                    && std::find(_hitTestEngaged.begin(), _hitTestEngaged.end(), id) == _hitTestEngaged.end()
+                ) {
+                    _hitTestEngaged.push_back(id);
+                }
             }
+        }
 
-            // sadly, flat objects do handle events.
-            for (auto it = _flatObjects.rbegin(); it != _flatObjects.rend(); ++it) {
-                auto object = (*it).get();
-                if (event->isHandled()) {
+        void Location::invalidateHitTest()
+        {
+            _hitTestDirty = true;
+        }
+
+        void Location::rebuildHitTestGrid()
+        {
+            _hitTestObjects.clear();
+            _hitTestEngaged.clear();
+            _hitTestGrid.reset(Point(0, 0), _camera->size());
+
+            auto add = [this](Game::Object* object) {
+                if (!object->inRender() || !object->ui()) {
                     return;
                 }
-                if (!object->inRender()) {
-                    continue;
+                auto ui = object->ui();
+                auto id = static_cast<unsigned int>(_hitTestObjects.size());
+                _hitTestObjects.push_back(object);
+                // depending on UI type the offset is either added or subtracted while hit testing, so cover both
+                Point margin(std::abs(ui->offset().x()), std::abs(ui->offset().y()));
+                _hitTestGrid.insert(id, ui->position() - margin, ui->size() + Graphics::Size(margin + margin));
+                if (ui->hasMouseInteraction()) {
+                    _hitTestEngaged.push_back(id);
                 }
-                object->handle(event);
+            };
+
+            for (auto& object : _flatObjects) {
+                add(object.get());
             }
-            /*
-                auto hexagons = _hexagonGrid->hexagons();
-                for (auto it = hexagons.rbegin(); it != hexagons.rend(); ++it)
-                {
-                    Hexagon* hexagon = *it;
-                    if (!hexagon->inRender()) continue;
-                    auto objects = hexagon->objects();
-                    for (auto itt = objects->rbegin(); itt != objects->rend(); ++itt)
-                    {
-                        if (event->isHandled()) return;
-                        auto object = *itt;
-                        if (!object->inRender()) continue;
-                        object->handle(event);
-                    }
-                }
-            */
+            _hitTestFlatObjects = _hitTestObjects.size();
+            for (auto& object : _objects) {
+                add(object.get());
+            }
+            _hitTestDirty = false;
+        }
+
+        const std::vector<unsigned int>& Location::hitTestCandidates(const Point& point, bool withEngaged)
+        {
+            if (_hitTestDirty) {
+                rebuildHitTestGrid();
+            }
+
+            auto& candidates = _hitTestCandidates;
+            auto& cell = _hitTestGrid.itemsAt(point);
+            candidates.assign(cell.begin(), cell.end());
+            if (withEngaged) {
+                candidates.insert(candidates.end(), _hitTestEngaged.begin(), _hitTestEngaged.end());
+            }
+            // ids follow draw order, so the topmost object goes first
+            std::sort(candidates.begin(), candidates.end(), std::greater<unsigned int>());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+            return candidates;
         }
 
         void Location::onMouseDown(Event::Mouse *event)
@@ -862,7 +952,7 @@ namespace Falltergeist
             if (number >= _location->MVARS()->size()) {
                 throw Exception("Location::setMVAR(num, value) - num out of range: " + std::to_string((int) number));
             }
-            _location->MVARS()->at(number) = value;
+            (*_location->MVARS())[number] = value;
         }
 
         int Location::MVAR(unsigned int number)
@@ -870,7 +960,7 @@ namespace Falltergeist
             if (number >= _location->MVARS()->size()) {
                 throw Exception("Location::MVAR(num) - num out of range: " + std::to_string((int) number));
             }
-            return _location->MVARS()->at(number);
+            return (*_location->MVARS())[number];
         }
 
         std::map<std::string, VM::StackValue> *Location::EVARS()
@@ -880,6 +970,8 @@ namespace Falltergeist
 
         void Location::moveObjectToHexagon(Game::Object *object, Hexagon *hexagon, bool update)
         {
+            _hitTestDirty = true;
+
             auto elevation = _location->elevations()->at(_elevation);
 
             auto oldHexagon = object->hexagon();
@@ -894,6 +986,7 @@ namespace Falltergeist
                         break;
                     }
                 }
+                oldHexagon->updateBlockers();
 
                 /* JUST FOR EXIT GRIDS TESTING*/
                 if (object->type() == Game::Object::Type::DUDE) {
@@ -938,6 +1031,7 @@ namespace Falltergeist
             object->setHexagon(hexagon);
             if (hexagon) {
                 hexagon->objects()->push_back(object);
+                hexagon->updateBlockers();
             }
 
             if (object->type() == Game::Object::Type::CRITTER || object->type() == Game::Object::Type::DUDE) {
@@ -1000,6 +1094,8 @@ namespace Falltergeist
 
         void Location::removeObjectFromMap(Game::Object *object)
         {
+            _hitTestDirty = true;
+
             auto objectsAtHex = object->hexagon()->objects();
 
             for (auto it = objectsAtHex->begin(); it != objectsAtHex->end(); ++it) {
@@ -1008,6 +1104,8 @@ namespace Falltergeist
                     break;
                 }
             }
+            object->hexagon()->updateBlockers();
+            _objectsByPID.remove(object);
             if (_objectUnderCursor == object) {
                 _objectUnderCursor = nullptr;
             }
@@ -1114,31 +1212,17 @@ namespace Falltergeist
 
         void Location::addTimerEvent(Game::Object *obj, int ticks, int fixedParam)
         {
-            Game::Timer timer(static_cast<float>(ticks) * 100.0f);
-            timer.start();
-            timer.tickHandler().add([obj, fixedParam](Event::Event *) {
-                if (obj) {
-                    if (auto& vm = obj->script()) {
-                        vm->setFixedParam(fixedParam);
-                        vm->call("timed_event_p_proc");
-                    }
-                }
-            });
-            _timerEvents.emplace_back(TimerEvent {obj, std::move(timer), fixedParam});
+            _timerEvents.add(obj, static_cast<float>(ticks) * 100.0f, fixedParam);
         }
 
         void Location::removeTimerEvent(Game::Object *obj)
         {
-            _timerEvents.remove_if([=](Location::TimerEvent &item) { return item.object == obj; });
+            _timerEvents.cancel(obj);
         }
 
         void Location::removeTimerEvent(Game::Object *obj, int fixedParam)
         {
-            _timerEvents.remove_if(
-                [=](Location::TimerEvent &item) {
-                    return item.object == obj && item.fixedParam == fixedParam;
-                }
-            );
+            _timerEvents.cancel(obj, fixedParam);
         }
 
         unsigned int Location::lightLevel()
@@ -1194,10 +1278,39 @@ namespace Falltergeist
             auto object = objectFactory.createObjectByPID(PID);
             _objects.emplace_back(object);
             moveObjectToHexagon(object, hexagonGrid()->at(position).get());
+            _objectsByPID.add(object);
             object->setElevation(elevation);
             return object;
         }
 
+        const std::list<std::shared_ptr<Game::Object>>& Location::objects() const
+        {
+            return _objects;
+        }
+
+        const std::list<std::shared_ptr<Game::Object>>& Location::flatObjects() const
+        {
+            return _flatObjects;
+        }
+
+        const Game::TimedEventQueue& Location::timerEvents() const
+        {
+            return _timerEvents;
+        }
+
+        const std::vector<Game::Object*>& Location::objectsWithPID(int PID) const
+        {
+            return _objectsByPID.objects(PID);
+        }
+
+        Game::Object* Location::objectWithPID(int PID, unsigned int position, int elevation) const
+        {
+            // scripts may change elevation after moving an object, so it is checked on lookup
+            return _objectsByPID.find(PID, *_hexagonGrid->at(position)->objects(), [position, elevation](Game::Object* object) {
+                return object->hexagon() && object->hexagon()->number() == position && object->elevation() == elevation;
+            });
+        }
+
         unsigned int Location::currentMapIndex()
         {
             return _currentMap;
@@ -1220,11 +1333,12 @@ namespace Falltergeist
 
         Game::Object* Location::getGameObjectUnderCursor()
         {
-            for (auto it = _objects.rbegin(); it != _objects.rend(); ++it) {
-                auto object = (*it).get();
-                if (!object->inRender()) {
-                    continue;
+            for (auto id : hitTestCandidates(mouse->position(), false)) {
+                // flat objects are never picked
+                if (id < _hitTestFlatObjects) {
+                    break;
                 }
+                auto object = _hitTestObjects.at(id);
 
                 Point position = mouse->position() - object->ui()->position() + object->ui()->offset();
                 if (object->ui()->opaque(position)) {
@@ -3,10 +3,14 @@
 // Project includes
 #include "../Format/Map/File.h"
 #include "../Game/DudeObject.h"
+#include "../Game/LocationPrefetcher.h"
 #include "../Game/Object.h"
+#include "../Game/PidIndex.h"
+#include "../Game/TimedEventQueue.h"
 #include "../Game/Timer.h"
 #include "../Game/LocationState/ScrollHandler.h"
 #include "../Graphics/Lightmap.h"
+#include "../Graphics/SpatialGrid.h"
 #include "../Input/Mouse.h"
 #include "../State/State.h"
 #include "../UI/ImageButton.h"
@@ -18,6 +22,7 @@
 // stdlib
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace Falltergeist
 {
@@ -92,9 +97,15 @@ namespace Falltergeist
                 HexagonGrid* hexagonGrid();
                 LocationCamera* camera();
 
+                // Marks the mouse hit test grid for rebuilding before the next lookup
+                void invalidateHitTest();
+
                 std::shared_ptr<Game::Location> location();
                 void setLocation(std::shared_ptr<Game::Location> location);
 
+                // The player is restored from a save game, so init() keeps its inventory and equipment
+                void setPlayerRestored(bool value);
+
                 unsigned int elevation() const;
                 void setElevation(unsigned int elevation);
 
@@ -139,6 +150,17 @@ namespace Falltergeist
 
                 Game::Object* addObject(unsigned int PID, unsigned int position, unsigned int elevation);
 
+                // objects of current elevation, except flat and spatial ones
+                const std::list<std::shared_ptr<Game::Object>>& objects() const;
+                const std::list<std::shared_ptr<Game::Object>>& flatObjects() const;
+
+                const Game::TimedEventQueue& timerEvents() const;
+
+                // all objects placed on the map with given PID
+                const std::vector<Game::Object*>& objectsWithPID(int PID) const;
+                // first object with given PID at given hexagon and elevation
+                Game::Object* objectWithPID(int PID, unsigned int position, int elevation) const;
+
                 SKILL skillInUse() const;
                 void setSkillInUse(SKILL skill);
 
@@ -153,17 +175,16 @@ namespace Falltergeist
                 std::shared_ptr<ILogger> logger;
 
             protected:
-                struct TimerEvent
-                {
-                    Game::Object* object;
-                    Game::Timer timer;
-                    int fixedParam;
-                };
-
                 static const int KEYBOARD_SCROLL_STEP;
 
                 static const int DROPDOWN_DELAY;
 
+                // Wall time per frame spent on map_update_p_proc of objects, in milliseconds
+                static const double MAP_UPDATE_BUDGET;
+
+                // Wall time per frame spent on warming up maps behind exit grids, in milliseconds
+                static const double PREFETCH_BUDGET;
+
                 // Timers
                 Game::Timer _locationScriptTimer;
 
@@ -171,8 +192,14 @@ namespace Falltergeist
 
                 Game::Timer _ambientSfxTimer;
 
+                // Objects waiting for their map_update_p_proc, spread over several frames
+                std::vector<std::weak_ptr<Game::Object>> _mapUpdateQueue;
+                size_t _mapUpdateNext = 0;
+
+                std::unique_ptr<Game::LocationPrefetcher> _prefetcher;
+
                 // for VM opcode add_timer_event
-                std::list<TimerEvent> _timerEvents;
+                Game::TimedEventQueue _timerEvents;
 
                 // TODO: move to Game::Location class?
                 std::map<std::string, unsigned char> _ambientSfx;
@@ -189,6 +216,8 @@ namespace Falltergeist
 
                 bool _locationEnter = true;
 
+                bool _playerRestored = false;
+
                 unsigned int _currentMap = 0;
 
                 unsigned int _lastClickedTile = 0;
@@ -227,6 +256,29 @@ namespace Falltergeist
 
                 std::vector<Game::SpatialObject*> _spatials;
 
+                // objects on the map grouped by PID, filled by init() and addObject(), trimmed by removeObjectFromMap()
+                Game::PidIndex<Game::Object> _objectsByPID;
+
+                // screen space index of rendered objects for mouse handling, rebuilt after objects were rendered
+                Graphics::SpatialGrid _hitTestGrid{Graphics::Size(64, 64)};
+
+                // flat objects first, in draw order
+                std::vector<Game::Object*> _hitTestObjects;
+
+                size_t _hitTestFlatObjects = 0;
+
+                // objects which are hovered or pressed and must get mouse events even outside of their bounds
+                std::vector<unsigned int> _hitTestEngaged;
+
+                std::vector<unsigned int> _hitTestCandidates;
+
+                bool _hitTestDirty = true;
+
+                void rebuildHitTestGrid();
+
+                // objects which may be under given screen point, from the topmost one
+                const std::vector<unsigned int>& hitTestCandidates(const Graphics::Point& point, bool withEngaged);
+
                 void initializePlayerTestAppareance(std::shared_ptr<Game::DudeObject> player) const;
 
                 void initializeLightmap();
@@ -249,6 +301,11 @@ namespace Falltergeist
 
                 void processTimers(const float &deltaTime);
 
+                void startMapUpdate();
+
+                // Runs queued map_update_p_proc calls until the budget is spent, or all of them if budget is negative
+                void processMapUpdate(double budget);
+
                 bool movePlayerToObject(Game::Object *object);
 
                 Game::Object* getGameObjectUnderCursor();
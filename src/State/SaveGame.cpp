@@ -2,6 +2,7 @@
 #include "../State/SaveGame.h"
 #include "../functions.h"
 #include "../Game/Game.h"
+#include "../Game/Snapshot.h"
 #include "../Graphics/Color.h"
 #include "../Graphics/Renderer.h"
 #include "../Input/Mouse.h"
@@ -91,6 +92,11 @@ namespace Falltergeist
 
         void SaveGame::onDoneButtonClick(Event::Mouse* event)
         {
+            // TODO slot selection, for now everything goes to the first slot
+            auto filename = Game::Snapshot::slotFilename(1);
+            if (!Game::Snapshot::save(filename)) {
+                Game::Game::getInstance()->logger()->error() << "[GAME] Can't save game to " << filename << std::endl;
+            }
             Game::Game::getInstance()->popState();
         }
 
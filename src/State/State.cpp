@@ -115,10 +115,10 @@ namespace Falltergeist
             // TODO: maybe make handle() a template function to get rid of dynamic_casts?
             if (auto keyboardEvent = dynamic_cast<Event::Keyboard*>(event)) {
                 if (keyboardEvent->originalType() == Event::Keyboard::Type::KEY_UP) {
-                    emitEvent(std::make_unique<Event::Keyboard>(*keyboardEvent), keyUpHandler());
+                    emitEvent(Event::Keyboard(*keyboardEvent), keyUpHandler());
                 }
                 if (keyboardEvent->originalType() == Event::Keyboard::Type::KEY_DOWN) {
-                    emitEvent(std::make_unique<Event::Keyboard>(*keyboardEvent), keyDownHandler());
+                    emitEvent(Event::Keyboard(*keyboardEvent), keyDownHandler());
                 }
             }
 
@@ -1,8 +1,11 @@
 // Project includes
 #include "../State/WorldMap.h"
+#include "../Format/Frm/File.h"
 #include "../Game/Game.h"
 #include "../Game/WorldMapCity.h"
+#include "../Graphics/Rect.h"
 #include "../Graphics/Renderer.h"
+#include "../Graphics/Tilemap.h"
 #include "../Input/Mouse.h"
 #include "../ResourceManager.h"
 #include "../Settings.h"
@@ -10,11 +13,13 @@
 #include "../UI/Factory/ImageButtonFactory.h"
 #include "../UI/Image.h"
 #include "../UI/ImageButton.h"
-#include "../UI/ImageList.h"
 
 // Third-party includes
+#include <SDL.h>
 
 // stdlib
+#include <algorithm>
+#include <string>
 
 namespace Falltergeist
 {
@@ -41,6 +46,10 @@ namespace Falltergeist
             }
         }
 
+        WorldMap::~WorldMap()
+        {
+        }
+
         void WorldMap::init()
         {
             if (_initialized) {
@@ -54,29 +63,7 @@ namespace Falltergeist
             unsigned int renderWidth = Game::Game::getInstance()->renderer()->size().width();
             unsigned int renderHeight = Game::Game::getInstance()->renderer()->size().height();
 
-            // loading map tiles
-            _tiles = std::make_shared<UI::ImageList>(Graphics::Point(0, 0), std::vector<std::shared_ptr<UI::Image>>({
-                _resourceManager->getImage("art/intrface/wrldmp00.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp01.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp02.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp03.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp04.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp05.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp06.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp07.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp08.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp09.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp10.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp11.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp12.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp13.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp14.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp15.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp16.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp17.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp18.frm"),
-                _resourceManager->getImage("art/intrface/wrldmp19.frm")
-            }));
+            _initTiles();
 
             //auto cross = new Image("art/intrface/wmaploc.frm");
             _hotspot = _imageButtonFactory->getByType(ImageButtonType::MAP_HOTSPOT, {0, 0});
@@ -133,32 +120,28 @@ namespace Falltergeist
                 _deltaY = worldMapSizeY - _mapHeight;
             }
 
-            signed int worldTileMinX = 0; // start X coordinate of current tile on world map
-            signed int worldTileMinY = 0; // start Y coordinate of current tile on world map
-            // NB: can be unsigned, but it compared with signed _deltaX and _deltaY, so...
-
-            // copy tiles to screen if needed
-            for (unsigned int y=0; y< _tilesNumberY; y++)
+            // tiles on the map screen, one draw call per atlas
+            auto columns = Graphics::Rect::visibleTiles(_deltaX, _mapWidth, _tileWidth, _tilesNumberX);
+            auto rows = Graphics::Rect::visibleTiles(_deltaY, _mapHeight, _tileHeight, _tilesNumberY);
+            std::vector<std::vector<GLuint>> indexes(_atlases);
+            for (int y = rows.first; y <= rows.second; y++)
             {
-                for (unsigned int x=0; x< _tilesNumberX; x++)
+                for (int x = columns.first; x <= columns.second; x++)
                 {
-                    _tiles->setCurrentImage(y* _tilesNumberX +x);
-                    worldTileMinX = x* _tileWidth;
-                    worldTileMinY = y* _tileHeight;
-                    // checking if tile is visible on screenMap
-                    // checking current tile borders
-                    // either xmin or xmax SHOULD belongs to map area AND
-                    // either ymin or ymax SHOULD belongs to map area
-                    if((((_deltaX <=worldTileMinX) && (worldTileMinX<= _deltaX +(signed int)_mapWidth)) ||
-                        ((_deltaX <=worldTileMinX+(signed int)_tileWidth) && (worldTileMinX+(signed int)_tileWidth <= _deltaX +(signed int)_mapWidth))) &&
-                        (((_deltaY <=worldTileMinY) && (worldTileMinY<= _deltaY +(signed int)_mapHeight)) ||
-                        ((_deltaY <=worldTileMinY+(signed int)_tileHeight) && (worldTileMinY+(signed int)_tileHeight <= _deltaY +(signed int)_mapHeight))) )
+                    GLuint tile = y * _tilesNumberX + x;
+                    auto& atlasIndexes = indexes.at(tile / _tilesPerAtlas);
+                    for (GLuint vertex : {0, 1, 2, 3, 2, 1})
                     {
-                        _tiles->images().at(y* _tilesNumberX +x)->setPosition(Point(x* _tileWidth - _deltaX, y* _tileHeight - _deltaY));
-                        _tiles->images().at(y* _tilesNumberX +x)->render();
+                        atlasIndexes.push_back(tile * 4 + vertex);
                     }
                 }
             }
+            for (unsigned int i = 0; i < _atlases; i++)
+            {
+                if (!indexes.at(i).empty()) {
+                    _tilemap->render(Point(_deltaX, _deltaY), indexes.at(i), i);
+                }
+            }
 
             // cities
             auto shift = Graphics::Point(_deltaX + 22, _deltaY + 21);
@@ -190,6 +173,71 @@ namespace Falltergeist
             _panel->render();
         }
 
+        void WorldMap::_initTiles()
+        {
+            unsigned int maxTextureSize = Game::Game::getInstance()->renderer()->maxTextureSize();
+            unsigned int atlasColumns = std::min(_tilesNumberX, maxTextureSize / _tileWidth);
+            unsigned int tilesNumber = _tilesNumberX * _tilesNumberY;
+            unsigned int atlasRows = std::min((tilesNumber + atlasColumns - 1) / atlasColumns, maxTextureSize / _tileHeight);
+            _tilesPerAtlas = atlasColumns * atlasRows;
+            _atlases = (tilesNumber + _tilesPerAtlas - 1) / _tilesPerAtlas;
+
+            float atlasWidth = static_cast<float>(atlasColumns * _tileWidth);
+            float atlasHeight = static_cast<float>(atlasRows * _tileHeight);
+
+            std::vector<glm::vec2> vertices;
+            std::vector<glm::vec2> UV;
+            for (unsigned int i = 0; i < tilesNumber; i++)
+            {
+                // world map coordinates, the map screen shift is applied when rendering
+                float vx = static_cast<float>((i % _tilesNumberX) * _tileWidth);
+                float vy = static_cast<float>((i / _tilesNumberX) * _tileHeight);
+                vertices.push_back(glm::vec2(vx, vy));
+                vertices.push_back(glm::vec2(vx + _tileWidth, vy));
+                vertices.push_back(glm::vec2(vx, vy + _tileHeight));
+                vertices.push_back(glm::vec2(vx + _tileWidth, vy + _tileHeight));
+
+                unsigned int slot = i % _tilesPerAtlas;
+                float x = static_cast<float>((slot % atlasColumns) * _tileWidth);
+                float y = static_cast<float>((slot / atlasColumns) * _tileHeight);
+                UV.push_back(glm::vec2(x / atlasWidth, y / atlasHeight));
+                UV.push_back(glm::vec2((x + _tileWidth) / atlasWidth, y / atlasHeight));
+                UV.push_back(glm::vec2(x / atlasWidth, (y + _tileHeight) / atlasHeight));
+                UV.push_back(glm::vec2((x + _tileWidth) / atlasWidth, (y + _tileHeight) / atlasHeight));
+            }
+
+            _tilemap = std::make_unique<Graphics::Tilemap>(vertices, UV);
+            _tilemap->setLightEnabled(false);
+
+            auto pal = ResourceManager::getInstance()->palFileType("color.pal");
+            for (unsigned int atlas = 0; atlas < _atlases; atlas++)
+            {
+                SDL_Surface* atlasSurface = SDL_CreateRGBSurface(0, static_cast<int>(atlasWidth), static_cast<int>(atlasHeight), 32, 0xff000000, 0x00ff0000, 0x0000ff00, 0x000000ff);
+                SDL_SetSurfaceBlendMode(atlasSurface, SDL_BLENDMODE_NONE);
+                for (unsigned int i = atlas * _tilesPerAtlas; i < std::min(tilesNumber, (atlas + 1) * _tilesPerAtlas); i++)
+                {
+                    std::string number = std::to_string(i);
+                    if (number.size() < 2) {
+                        number.insert(0, 1, '0');
+                    }
+                    auto frm = ResourceManager::getInstance()->frmFileType("art/intrface/wrldmp" + number + ".frm");
+                    if (!frm) {
+                        continue;
+                    }
+
+                    SDL_Surface* tileSurface = SDL_CreateRGBSurfaceFrom(frm->rgba(pal), frm->width(), frm->height(), 32, frm->width() * 4, 0xff000000, 0x00ff0000, 0x0000ff00, 0x000000ff);
+                    SDL_SetSurfaceBlendMode(tileSurface, SDL_BLENDMODE_NONE);
+                    unsigned int slot = i % _tilesPerAtlas;
+                    SDL_Rect srcRect = {0, 0, static_cast<int>(_tileWidth), static_cast<int>(_tileHeight)};
+                    SDL_Rect dstRect = {static_cast<int>((slot % atlasColumns) * _tileWidth), static_cast<int>((slot / atlasColumns) * _tileHeight), static_cast<int>(_tileWidth), static_cast<int>(_tileHeight)};
+                    SDL_BlitSurface(tileSurface, &srcRect, atlasSurface, &dstRect);
+                    SDL_FreeSurface(tileSurface);
+                }
+                _tilemap->addTexture(atlasSurface);
+                SDL_FreeSurface(atlasSurface);
+            }
+        }
+
         void WorldMap::handle(Event::Event* event)
         {
             auto game = Game::Game::getInstance();
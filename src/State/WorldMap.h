@@ -8,10 +8,15 @@
 // Third-party includes
 
 // stdlib
+#include <memory>
 #include <vector>
 
 namespace Falltergeist
 {
+    namespace Graphics
+    {
+        class Tilemap;
+    }
     namespace UI
     {
         namespace Factory
@@ -20,7 +25,6 @@ namespace Falltergeist
         }
         class Image;
         class ImageButton;
-        class ImageList;
     }
     namespace Game
     {
@@ -33,7 +37,7 @@ namespace Falltergeist
             public:
                 WorldMap(std::shared_ptr<UI::IResourceManager> resourceManager);
 
-                virtual ~WorldMap() = default;
+                virtual ~WorldMap();
 
                 void init() override;
 
@@ -54,7 +58,12 @@ namespace Falltergeist
 
                 std::shared_ptr<UI::Image> _panel = nullptr;
 
-                std::shared_ptr<UI::ImageList> _tiles = nullptr;
+                // all world map tiles in one vertex buffer, tiles are packed into as few atlases as the texture size allows
+                std::unique_ptr<Graphics::Tilemap> _tilemap;
+
+                unsigned int _tilesPerAtlas = 0;
+
+                unsigned int _atlases = 0;
 
                 std::shared_ptr<UI::ImageButton> _hotspot = nullptr;
 
@@ -91,6 +100,8 @@ namespace Falltergeist
                 unsigned int _mapMinX = 0;      // start X point of map screen
 
                 unsigned int _mapMinY = 0;      // start Y point of map screen
+
+                void _initTiles();
         };
     }
 }
@@ -110,17 +110,17 @@ namespace Falltergeist
                 if (_progress < _animationFrames.size())
                 {
                     _currentFrame = _reverse ? static_cast<unsigned>(_animationFrames.size()) - _progress - 1 : _progress;
-                    emitEvent(std::make_unique<Event::Event>("frame"), frameHandler());
+                    emitEvent(Event::Event("frame"), frameHandler());
                     if (_actionFrame == _currentFrame)
                     {
-                        emitEvent(std::make_unique<Event::Event>("actionFrame"), actionFrameHandler());
+                        emitEvent(Event::Event("actionFrame"), actionFrameHandler());
                     }
                 }
                 else
                 {
                     _ended = true;
                     _playing = false;
-                    emitEvent(std::make_unique<Event::Event>("animationEnded"), animationEndedHandler());
+                    emitEvent(Event::Event("animationEnded"), animationEndedHandler());
                 }
             }
         }
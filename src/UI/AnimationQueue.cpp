@@ -58,7 +58,7 @@ namespace Falltergeist {
                         currentAnimation()->play();
                     } else {
                         if (!_repeat) {
-                            emitEvent(std::make_unique<Event::Event>("animationEnded"), animationEndedHandler());
+                            emitEvent(Event::Event("animationEnded"), animationEndedHandler());
                             currentAnimation()->stop();
                             _playing = false;
                             return;
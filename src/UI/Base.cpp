@@ -88,11 +88,11 @@ namespace Falltergeist {
             if (auto keyboardEvent = dynamic_cast<Event::Keyboard*>(event)) {
                 switch (keyboardEvent->originalType()) {
                     case Event::Keyboard::Type::KEY_UP: {
-                        emitEvent(std::make_unique<Event::Keyboard>(*keyboardEvent), keyUpHandler());
+                        emitEvent(Event::Keyboard(*keyboardEvent), keyUpHandler());
                         break;
                     }
                     case Event::Keyboard::Type::KEY_DOWN: {
-                        emitEvent(std::make_unique<Event::Keyboard>(*keyboardEvent), keyDownHandler());
+                        emitEvent(Event::Keyboard(*keyboardEvent), keyDownHandler());
                         break;
                     }
                 }
@@ -112,20 +112,20 @@ namespace Falltergeist {
                     case Mouse::Type::MOVE: {
 
                         if (_leftButtonPressed) {
-                            emitEvent(std::make_unique<Mouse>(*mouseEvent, _drag ? "mousedrag" : "mousedragstart"),
+                            emitEvent(Mouse(*mouseEvent, _drag ? "mousedrag" : "mousedragstart"),
                                       _drag ? mouseDragHandler() : mouseDragStartHandler());
                             _drag = true;
                         }
                         if (!_hovered) {
                             _hovered = true;
-                            emitEvent(std::make_unique<Mouse>(*mouseEvent, "mousein"), mouseInHandler());
+                            emitEvent(Mouse(*mouseEvent, "mousein"), mouseInHandler());
                         } else {
-                            emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mousemove"), mouseMoveHandler());
+                            emitEvent(Event::Mouse(*mouseEvent, "mousemove"), mouseMoveHandler());
                         }
                         break;
                     }
                     case Mouse::Type::BUTTON_DOWN: {
-                        emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), mouseDownHandler());
+                        emitEvent(Event::Mouse(*mouseEvent), mouseDownHandler());
                         switch (mouseEvent->button()) {
                             case Mouse::Button::LEFT: {
                                 if (_leftButtonPressed == false) {
@@ -144,22 +144,22 @@ namespace Falltergeist {
                         break;
                     }
                     case Mouse::Type::BUTTON_UP: {
-                        emitEvent(std::make_unique<Event::Mouse>(*mouseEvent), mouseUpHandler());
+                        emitEvent(Event::Mouse(*mouseEvent), mouseUpHandler());
                         switch (mouseEvent->button()) {
                             case Mouse::Button::LEFT: {
                                 if (_leftButtonPressed) {
                                     if (_drag) {
                                         _drag = false;
-                                        emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mousedragstop"), mouseDragStopHandler());
+                                        emitEvent(Event::Mouse(*mouseEvent, "mousedragstop"), mouseDragStopHandler());
                                     }
-                                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mouseclick"), mouseClickHandler());
+                                    emitEvent(Event::Mouse(*mouseEvent, "mouseclick"), mouseClickHandler());
                                 }
                                 _leftButtonPressed = false;
                                 break;
                             }
                             case Mouse::Button::RIGHT: {
                                 if (_rightButtonPressed) {
-                                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mouseclick"), mouseClickHandler());
+                                    emitEvent(Event::Mouse(*mouseEvent, "mouseclick"), mouseClickHandler());
                                 }
                                 _rightButtonPressed = false;
                                 break;
@@ -179,11 +179,11 @@ namespace Falltergeist {
                 switch (mouseEvent->originalType()) {
                     case Mouse::Type::MOVE: {
                         if (_drag) {
-                            emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mousedrag"), mouseDragHandler());
+                            emitEvent(Event::Mouse(*mouseEvent, "mousedrag"), mouseDragHandler());
                         }
                         if (_hovered) {
                             _hovered = false;
-                            emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mouseout"), mouseOutHandler());
+                            emitEvent(Event::Mouse(*mouseEvent, "mouseout"), mouseOutHandler());
                         }
                         break;
                     }
@@ -193,17 +193,17 @@ namespace Falltergeist {
                                 if (_leftButtonPressed) {
                                     if (_drag) {
                                         _drag = false;
-                                        emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mousedragstop"), mouseDragStopHandler());
+                                        emitEvent(Event::Mouse(*mouseEvent, "mousedragstop"), mouseDragStopHandler());
                                     }
 
-                                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mouseup"), mouseUpHandler());
+                                    emitEvent(Event::Mouse(*mouseEvent, "mouseup"), mouseUpHandler());
                                     _leftButtonPressed = false;
                                 }
                                 break;
                             }
                             case Mouse::Button::RIGHT: {
                                 if (_rightButtonPressed) {
-                                    emitEvent(std::make_unique<Event::Mouse>(*mouseEvent, "mouseup"), mouseUpHandler());
+                                    emitEvent(Event::Mouse(*mouseEvent, "mouseup"), mouseUpHandler());
                                     _rightButtonPressed = false;
                                 }
                                 break;
@@ -220,6 +220,10 @@ namespace Falltergeist {
             return;
         }
 
+        bool Base::hasMouseInteraction() const {
+            return _hovered || _leftButtonPressed || _rightButtonPressed || _drag;
+        }
+
         Event::KeyboardHandler& Base::keyDownHandler() {
             return _keyDownHandler;
         }
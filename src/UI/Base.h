@@ -62,6 +62,12 @@ namespace Falltergeist
                  */
                 virtual void handle(Event::Mouse* mouseEvent);
 
+                /**
+                 * @brief Whether element is hovered, pressed or dragged.
+                 * Such element still has to handle mouse events outside of its bounds to finish the interaction.
+                 */
+                bool hasMouseInteraction() const;
+
                 /**
                  * @brief Process any real-time actions at each frame.
                  * This method is called after handle() but before render() in the main loop.
@@ -144,9 +144,9 @@ namespace Falltergeist
             setOffset({0, 0});
             setType(_oldType);
 
-            auto itemevent = std::make_unique<Event::Mouse>(*event, "itemdragstop");
-            itemevent->setPosition(event->position());
-            emitEvent(std::move(itemevent), itemDragStopHandler());
+            Event::Mouse itemevent(*event, "itemdragstop");
+            itemevent.setPosition(event->position());
+            emitEvent(itemevent, itemDragStopHandler());
         }
 
         void InventoryItem::onArmorDragStop(Event::Mouse* event, std::shared_ptr<ItemsList> target, std::shared_ptr<InventoryItem> inventoryItem)
@@ -112,8 +112,7 @@ namespace Falltergeist
                 Game::Game::getInstance()->mixer()->playACMSound("sound/sfx/iputdown.acm");
                 _draggedItem->setType(_type);
                 _draggedItem->setPosition(_draggedItemInitialPosition);
-                auto itemevent = std::make_unique<Event::Mouse>(*event, "itemdragstop");
-                emitEvent(std::move(itemevent), itemDragStopHandler());
+                emitEvent(Event::Mouse(*event, "itemdragstop"), itemDragStopHandler());
             }
         }
 
@@ -168,7 +167,7 @@ namespace Falltergeist
         {
             _items->push_back(item->item());
             this->update();
-            emitEvent(std::make_unique<Event::Event>("itemsListModified"), itemsListModifiedHandler());
+            emitEvent(Event::Event("itemsListModified"), itemsListModifiedHandler());
         }
 
         void ItemsList::removeItem(std::shared_ptr<InventoryItem> item, unsigned int amount)
@@ -181,7 +180,7 @@ namespace Falltergeist
                 }
             }
             this->update();
-            emitEvent(std::make_unique<Event::Event>("itemsListModified"), itemsListModifiedHandler());
+            emitEvent(Event::Event("itemsListModified"), itemsListModifiedHandler());
         }
 
         bool ItemsList::canScrollUp()
@@ -8,7 +8,8 @@
 // Third-party includes
 
 // stdlib
-#include <bitset>
+#include <algorithm>
+#include <cstring>
 
 namespace Falltergeist
 {
@@ -55,9 +56,9 @@ namespace Falltergeist
             return data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
         }
 
-        MvePlayer::MvePlayer(Format::Mve::File* mve) : Base(Point(0, 0)) {
+        MvePlayer::MvePlayer(std::shared_ptr<Format::Mve::File> mve) : Base(Point(0, 0)) {
             _movie = new Graphics::Movie();
-            _mve = mve;
+            _mve = std::move(mve);
             _mve->setPosition(26);
             _chunk = _mve->getNextChunk();
             while(!_finished && !_timerStarted ) {
@@ -70,9 +71,6 @@ namespace Falltergeist
             delete [] _decodingMap;
             delete [] _audioBuf;
             delete _movie;
-
-            SDL_FreeSurface(_currentBuf);
-            SDL_FreeSurface(_backBuf);
         }
 
         void MvePlayer::render(bool eggTransparency)
@@ -84,222 +82,201 @@ namespace Falltergeist
             _movie->render(_position);
         }
 
-        SDL_Rect relClose(uint32_t b, int8_t sign, uint32_t _x, uint32_t _y)
+        // Block helpers work on 8 pixels at once, packed into a 64-bit row (byte N is pixel N in memory order)
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        static const uint64_t ROW_BIT_SELECT = 0x0102040810204080ULL;
+        static const uint64_t ROW_LEFT_HALF  = 0xFFFFFFFF00000000ULL;
+        static const uint64_t ROW_ODD_PIXELS = 0x00FF00FF00FF00FFULL;
+#else
+        static const uint64_t ROW_BIT_SELECT = 0x8040201008040201ULL;
+        static const uint64_t ROW_LEFT_HALF  = 0x00000000FFFFFFFFULL;
+        static const uint64_t ROW_ODD_PIXELS = 0xFF00FF00FF00FF00ULL;
+#endif
+
+        // Color repeated for all 8 pixels of the row
+        static inline uint64_t splat(uint8_t color)
         {
-            SDL_Rect rect;
-            rect.w=8;
-            rect.h=8;
-            if (b < 56) {
-                rect.x = _x+sign*(8 + (b % 7));
-                rect.y = _y+sign*(b / 7);
-            } else {
-                rect.x = _x+sign*(-14 + ((b - 56) % 29));
-                rect.y = _y+sign*( 8 + ((b - 56) / 29));
-            }
-            return rect;
+            return color * 0x0101010101010101ULL;
         }
 
-        SDL_Rect relFar(uint8_t b, uint32_t _x, uint32_t _y)
+        // Left 4 pixels of one color, right 4 pixels of another
+        static inline uint64_t splatHalves(uint8_t left, uint8_t right)
         {
-            SDL_Rect rect;
-            rect.w = 8;
-            rect.h = 8;
-
-            int32_t ma = b >> 4;
-            int32_t mi = b & 0xf;
+            return (splat(left) & ROW_LEFT_HALF) | (splat(right) & ~ROW_LEFT_HALF);
+        }
 
-            rect.x = _x + mi - 8;
-            rect.y = _y + ma - 8;
+        // Turns bit N of the mask into 0xFF (bit set) or 0x00 (bit clear) in pixel N, without branches
+        static inline uint64_t expandMask(uint8_t mask)
+        {
+            uint64_t bits = splat(mask) & ROW_BIT_SELECT;
+            uint64_t high = (bits | ((bits & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL)) & 0x8080808080808080ULL;
+            return (high >> 7) * 0xFF;
+        }
 
-            return rect;
+        // Picks b where selector pixels are 0xFF, a otherwise
+        static inline uint64_t blend(uint64_t selector, uint64_t a, uint64_t b)
+        {
+            return a ^ ((a ^ b) & selector);
         }
 
+        // Gathers bits 0, 2, 4 ... 14 into the low byte
+        static inline uint8_t evenBits(uint16_t value)
+        {
+            uint32_t x = value & 0x5555;
+            x = (x | (x >> 1)) & 0x3333;
+            x = (x | (x >> 2)) & 0x0F0F;
+            x = (x | (x >> 4)) & 0x00FF;
+            return static_cast<uint8_t>(x);
+        }
 
-        void MvePlayer::_drawRow(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t mask)
+        // Doubles every bit of the low nibble: used for patterns with 2 pixel wide cells
+        static inline uint8_t widenNibble(uint8_t nibble)
         {
-            std::bitset<8> bitmask(mask);
-            SDL_Rect dstrect;
-            for (uint32_t dx = 0; dx < 8; dx++) {
-                dstrect.w = 1;
-                dstrect.h = 1;
-                dstrect.x = x + dx;
-                dstrect.y = y;
-                SDL_FillRect(_currentBuf, &dstrect, (bitmask.test(dx) ? c2 : c1));
-            }
+            uint32_t x = nibble & 0x0F;
+            x = (x | (x << 2)) & 0x33;
+            x = (x | (x << 1)) & 0x55;
+            return static_cast<uint8_t>(x | (x << 1));
         }
 
-        void MvePlayer::_drawRow2x2(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t mask)
+        // 2 colors row, 1 bit per pixel
+        static inline uint64_t pattern2(uint8_t mask, uint64_t c1, uint64_t c2)
         {
-            std::bitset<8> bitmask(mask);
-            SDL_Rect dstrect;
-            for (uint32_t di = 0; di < 8; di++) {
-                dstrect.w = 2;
-                dstrect.h = 2;
-                dstrect.x = x + (di % 4) * 2;
-                dstrect.y = y + (di / 4) * 2;
-                SDL_FillRect(_currentBuf, &dstrect, (bitmask.test(di) ? c2 : c1));
-            }
+            return blend(expandMask(mask), c1, c2);
         }
 
-        void MvePlayer::_drawRow4colors(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask1,uint8_t mask2)
+        // 4 colors row, low and high bits of 2-bit color indexes are passed separately
+        static inline uint64_t pattern4(uint8_t lowBits, uint8_t highBits, uint64_t c1, uint64_t c2, uint64_t c3, uint64_t c4)
         {
-            std::bitset<8> bitmasks[2] = {mask1, mask2};
-            SDL_Rect dstrect;
-            for (uint32_t dx = 0;dx < 8; dx++) {
-                dstrect.w = 1;
-                dstrect.h = 1;
-                dstrect.x = x + dx;
-                dstrect.y = y;
-                SDL_FillRect(_currentBuf,&dstrect, (bitmasks[dx/4].test((dx%4)*2+1) ? (bitmasks[dx/4].test((dx%4)*2) ? c4 : c3) : (bitmasks[dx/4].test((dx%4)*2) ? c2 : c1) ));
-            }
+            uint64_t low = expandMask(lowBits);
+            return blend(expandMask(highBits), blend(low, c1, c2), blend(low, c3, c4));
         }
 
-        void MvePlayer::_drawRow4colors2x2(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask)
+        // 4 colors row, 2 bits per pixel: pixels 0-3 from first mask, 4-7 from second one
+        static inline uint64_t pattern4(uint8_t mask1, uint8_t mask2, const uint64_t* colors)
         {
-            std::bitset<8> bitmask(mask);
-            SDL_Rect dstrect;
-            for (uint32_t dx = 0; dx < 4; dx++) {
-                dstrect.w = 2;
-                dstrect.h = 2;
-                dstrect.x = x + dx*2;
-                dstrect.y = y;
-                SDL_FillRect(_currentBuf,&dstrect, (bitmask.test(dx*2+1) ? (bitmask.test(dx*2) ? c4 : c3) : (bitmask.test(dx*2) ? c2 : c1) ));
-            }
+            uint16_t mask = mask1 | (mask2 << 8);
+            return pattern4(evenBits(mask), evenBits(mask >> 1), colors[0], colors[1], colors[2], colors[3]);
         }
 
-        void MvePlayer::_drawRow4colors2x1(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask)
+        // 4 colors row of 2 pixel wide cells, 2 bits per cell
+        static inline uint64_t pattern4Wide(uint8_t mask, const uint64_t* colors)
         {
-            std::bitset<8> bitmask(mask);
-            SDL_Rect dstrect;
-            for (uint32_t dx = 0; dx < 4; dx++) {
-                dstrect.w = 2;
-                dstrect.h = 1;
-                dstrect.x = x + dx*2;
-                dstrect.y = y;
-                SDL_FillRect(_currentBuf,&dstrect, (bitmask.test(dx*2+1) ? (bitmask.test(dx*2) ? c4 : c3) : (bitmask.test(dx*2) ? c2 : c1) ));
-            }
+            return pattern4(widenNibble(evenBits(mask)), widenNibble(evenBits(mask >> 1)), colors[0], colors[1], colors[2], colors[3]);
         }
 
-        void MvePlayer::_drawRow4colors1x2(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask1, uint8_t mask2)
+        // Row of two 4x4 quadrants, 1 bit per pixel, 2 rows per mask byte
+        static inline uint8_t quadrantRow(const uint8_t* leftMasks, const uint8_t* rightMasks, uint32_t row)
         {
-            std::bitset<8> bitmasks[2]={mask1,mask2};
-            SDL_Rect dstrect;
-            for (uint32_t dx = 0; dx < 8; dx++) {
-                dstrect.w = 1;
-                dstrect.h = 2;
-                dstrect.x = x + dx;
-                dstrect.y = y;
-                SDL_FillRect(_currentBuf,&dstrect, (bitmasks[dx/4].test((dx%4)*2+1) ? (bitmasks[dx/4].test((dx%4)*2) ? c4 : c3) : (bitmasks[dx/4].test((dx%4)*2) ? c2 : c1) ));
-            }
+            uint32_t shift = (row % 2) * 4;
+            return ((leftMasks[row / 2] >> shift) & 0x0F) | (((rightMasks[row / 2] >> shift) & 0x0F) << 4);
+        }
 
+        static inline void storeRow(uint8_t* dst, uint64_t row)
+        {
+            memcpy(dst, &row, sizeof(row));
         }
 
+        static inline void loadColors(const uint8_t* data, uint64_t* colors)
+        {
+            for (uint32_t i = 0; i < 4; i++) {
+                colors[i] = splat(data[i]);
+            }
+        }
 
-        void MvePlayer::_drawQuadrant(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t mask1, uint8_t mask2)
+        static inline void loadColorHalves(const uint8_t* left, const uint8_t* right, uint64_t* colors)
         {
-            std::bitset<8> bitmask1(mask1);
-            std::bitset<8> bitmask2(mask2);
-            SDL_Rect dstrect;
-            for (uint32_t dy = 0; dy < 4; dy++) {
-                for (uint32_t dx = 0; dx < 4; dx++) {
-                    dstrect.w = 1;
-                    dstrect.h = 1;
-                    dstrect.x = x + dx;
-                    dstrect.y = y + dy;
-                    if (dy < 2) {
-                        SDL_FillRect(_currentBuf,&dstrect, (bitmask1.test(4*(dy%2)+dx) ? c2 : c1));
-                    } else {
-                        SDL_FillRect(_currentBuf,&dstrect, (bitmask2.test(4*(dy%2)+dx) ? c2 : c1));
-                    }
-                }
+            for (uint32_t i = 0; i < 4; i++) {
+                colors[i] = splatHalves(left[i], right[i]);
             }
+        }
 
+        void relClose(uint32_t b, int8_t sign, uint32_t _x, uint32_t _y, int32_t& srcX, int32_t& srcY)
+        {
+            if (b < 56) {
+                srcX = _x+sign*(8 + (b % 7));
+                srcY = _y+sign*(b / 7);
+            } else {
+                srcX = _x+sign*(-14 + ((b - 56) % 29));
+                srcY = _y+sign*( 8 + ((b - 56) / 29));
+            }
         }
 
+        void relFar(uint8_t b, uint32_t _x, uint32_t _y, int32_t& srcX, int32_t& srcY)
+        {
+            int32_t ma = b >> 4;
+            int32_t mi = b & 0xf;
+
+            srcX = _x + mi - 8;
+            srcY = _y + ma - 8;
+        }
 
-        void MvePlayer::_drawQuadrant4colors(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask1, uint8_t mask2, uint8_t mask3, uint8_t mask4)
+        void MvePlayer::_copyBlock(const std::vector<uint8_t>& src, int32_t srcX, int32_t srcY, uint32_t x, uint32_t y)
         {
-            std::bitset<8> bitmasks[4];
-            bitmasks[0] = mask1;
-            bitmasks[1] = mask2;
-            bitmasks[2] = mask3;
-            bitmasks[3] = mask4;
-            SDL_Rect dstrect;
-            for (uint32_t dy = 0; dy < 4; dy++) {
-                for (uint32_t dx = 0; dx < 4; dx++) {
-                    dstrect.w = 1;
-                    dstrect.h = 1;
-                    dstrect.x = x + dx;
-                    dstrect.y = y + dy;
-                    SDL_FillRect(_currentBuf,&dstrect, (bitmasks[dy].test(dx*2+1) ? (bitmasks[dy].test(dx*2) ? c4 : c3) : (bitmasks[dy].test(dx*2) ? c2 : c1) ));
+            uint8_t* dst = &_currentBuf[y * _width + x];
+            if (srcX >= 0 && srcY >= 0 && srcX + 8 <= (int32_t)_width && srcY + 8 <= (int32_t)_height) {
+                const uint8_t* from = &src[srcY * _width + srcX];
+                for (uint32_t row = 0; row < 8; row++) {
+                    // source may be the current frame, rows never overlap but pixels might
+                    memmove(dst + row * _width, from + row * _width, 8);
+                }
+                return;
+            }
+
+            // clip source block to the frame, shifting the destination the same way
+            int32_t left = std::max(srcX, 0);
+            int32_t top = std::max(srcY, 0);
+            int32_t right = std::min(srcX + 8, (int32_t)_width);
+            int32_t bottom = std::min(srcY + 8, (int32_t)_height);
+            for (int32_t row = top; row < bottom; row++) {
+                if (right > left) {
+                    memmove(dst + (row - srcY) * _width + (left - srcX), &src[row * _width + left], right - left);
                 }
             }
         }
 
         void MvePlayer::_decodeFrame(uint8_t* data, uint32_t len)
         {
-            uint32_t h = (_currentBuf->h / 8);
-            uint32_t w = (_currentBuf->w / 8);
+            uint32_t h = (_height / 8);
+            uint32_t w = (_width / 8);
+            uint32_t stride = _width;
             uint32_t curMap = 0;
-            SDL_Rect srcrect;
-            SDL_Rect dstrect;
-            uint8_t color = 0;
+            int32_t srcX = 0;
+            int32_t srcY = 0;
+            uint64_t colors[4];
+            uint64_t moreColors[4];
             for (uint32_t y = 0; y < h;y++) {
                 for (uint32_t x = 0; x < w;x++) {
                     curMap = (y*w + x);
+                    uint8_t* block = &_currentBuf[y*8*stride + x*8];
                     switch (_decodingMap[curMap])
                     {
                         case 0x0:
                             //copy from backbuf
-                            srcrect.w = 8;
-                            srcrect.h = 8;
-                            srcrect.x = x*8;
-                            srcrect.y = y*8;
-                            SDL_BlitSurface(_backBuf, &srcrect, _currentBuf, &srcrect);
+                            _copyBlock(_backBuf, x*8, y*8, x*8, y*8);
                             break;
                         case 0x1:
                             //copy from back-back buff -> copy from current frame -> do nothing
                             break;
                         case 0x2:
-                            srcrect = relClose(data[0], 1, x*8, y*8);
-                            dstrect.w = 8;
-                            dstrect.h = 8;
-                            dstrect.x = x*8;
-                            dstrect.y = y*8;
-                            SDL_BlitSurface(_currentBuf, &srcrect, _currentBuf, &dstrect);
+                            relClose(data[0], 1, x*8, y*8, srcX, srcY);
+                            _copyBlock(_currentBuf, srcX, srcY, x*8, y*8);
                             data++;
                             len--;
                             break;
                         case 0x3:
-                            srcrect = relClose(data[0], -1, x*8, y*8);
-                            dstrect.w = 8;
-                            dstrect.h = 8;
-                            dstrect.x = x*8;
-                            dstrect.y = y*8;
-                            SDL_BlitSurface(_currentBuf, &srcrect, _currentBuf, &dstrect);
+                            relClose(data[0], -1, x*8, y*8, srcX, srcY);
+                            _copyBlock(_currentBuf, srcX, srcY, x*8, y*8);
                             data++;
                             len--;
                             break;
                         case 0x4:
-                            srcrect = relFar(data[0], x*8, y*8);
-                            dstrect.w = 8;
-                            dstrect.h = 8;
-                            dstrect.x = x*8;
-                            dstrect.y = y*8;
-                            SDL_BlitSurface(_backBuf, &srcrect, _currentBuf, &dstrect);
+                            relFar(data[0], x*8, y*8, srcX, srcY);
+                            _copyBlock(_backBuf, srcX, srcY, x*8, y*8);
                             data++;
                             len--;
                             break;
                         case 0x5:
-                            srcrect.w = 8;
-                            srcrect.h = 8;
-                            dstrect.w = 8;
-                            dstrect.h = 8;
-                            dstrect.x = x*8;
-                            dstrect.y = y*8;
-                            srcrect.x = x*8 + (int8_t)data[0];
-                            srcrect.y = y*8 + (int8_t)data[1];
-                            SDL_BlitSurface(_backBuf, &srcrect, _currentBuf, &dstrect);
+                            _copyBlock(_backBuf, x*8 + (int8_t)data[0], y*8 + (int8_t)data[1], x*8, y*8);
                             data += 2;
                             len -= 2;
                             break;
@@ -318,20 +295,20 @@ namespace Falltergeist
                             break;
                         //hell
                         case 0x7:
+                            colors[0] = splat(data[0]);
+                            colors[1] = splat(data[1]);
                             if (data[0]<=data[1]) {
-                                _drawRow(x*8, y*8,     data[0], data[1], data[2] );
-                                _drawRow(x*8, y*8 + 1, data[0], data[1], data[3] );
-                                _drawRow(x*8, y*8 + 2, data[0], data[1], data[4] );
-                                _drawRow(x*8, y*8 + 3, data[0], data[1], data[5] );
-                                _drawRow(x*8, y*8 + 4, data[0], data[1], data[6] );
-                                _drawRow(x*8, y*8 + 5, data[0], data[1], data[7] );
-                                _drawRow(x*8, y*8 + 6, data[0], data[1], data[8]);
-                                _drawRow(x*8, y*8 + 7, data[0], data[1], data[9]);
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    storeRow(block + row*stride, pattern2(data[2 + row], colors[0], colors[1]));
+                                }
                                 data += 10;
                                 len -= 10;
                             } else {
-                                _drawRow2x2(x*8, y*8,     data[0], data[1], data[2]);
-                                _drawRow2x2(x*8, y*8 + 4, data[0], data[1], data[3]);
+                                // 2x2 cells, 4 cells per nibble
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    uint8_t nibble = data[2 + row/4] >> ((row/2 % 2) * 4);
+                                    storeRow(block + row*stride, pattern2(widenNibble(nibble), colors[0], colors[1]));
+                                }
                                 data += 4;
                                 len -= 4;
                             }
@@ -342,10 +319,18 @@ namespace Falltergeist
                                 // 0 | 2
                                 // -----
                                 // 1 | 3
-                                _drawQuadrant(x*8,     y*8,     data[0],  data[1],  data[2],  data[3] );
-                                _drawQuadrant(x*8,     y*8 + 4, data[4],  data[5],  data[6],  data[7] );
-                                _drawQuadrant(x*8 + 4, y*8,     data[8],  data[9],  data[10], data[11]);
-                                _drawQuadrant(x*8 + 4, y*8 + 4, data[12], data[13], data[14], data[15]);
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    const uint8_t* left = data + (row < 4 ? 0 : 4);
+                                    const uint8_t* right = data + (row < 4 ? 8 : 12);
+                                    storeRow(
+                                        block + row*stride,
+                                        pattern2(
+                                            quadrantRow(left + 2, right + 2, row % 4),
+                                            splatHalves(left[0], right[0]),
+                                            splatHalves(left[1], right[1])
+                                        )
+                                    );
+                                }
                                 data+=16;
                                 len-=16;
                             } else {
@@ -353,63 +338,52 @@ namespace Falltergeist
                                     //left|right split. same as above, except uses 1 byte per 2 4x4 blocks
                                     // 0 | 2
                                     // 1 | 3
-                                    _drawQuadrant(x*8,     y*8,     data[0], data[1], data[2],  data[3] );
-                                    _drawQuadrant(x*8,     y*8 + 4, data[0], data[1], data[4],  data[5] );
-                                    _drawQuadrant(x*8 + 4, y*8,     data[6], data[7], data[8],  data[9] );
-                                    _drawQuadrant(x*8 + 4, y*8 + 4, data[6], data[7], data[10], data[11]);
+                                    uint64_t c1 = splatHalves(data[0], data[6]);
+                                    uint64_t c2 = splatHalves(data[1], data[7]);
+                                    for (uint32_t row = 0; row < 8; row++) {
+                                        storeRow(block + row*stride, pattern2(quadrantRow(data + 2, data + 8, row), c1, c2));
+                                    }
                                 } else {
                                     //top|bottom split
                                     // 0 1
                                     //-----
                                     // 2 3
-                                    _drawRow(x*8, y*8,     data[0], data[1], data[2] );
-                                    _drawRow(x*8, y*8 + 1, data[0], data[1], data[3] );
-                                    _drawRow(x*8, y*8 + 2, data[0], data[1], data[4] );
-                                    _drawRow(x*8, y*8 + 3, data[0], data[1], data[5] );
-                                    _drawRow(x*8, y*8 + 4, data[6], data[7], data[8] );
-                                    _drawRow(x*8, y*8 + 5, data[6], data[7], data[9] );
-                                    _drawRow(x*8, y*8 + 6, data[6], data[7], data[10]);
-                                    _drawRow(x*8, y*8 + 7, data[6], data[7], data[11]);
+                                    for (uint32_t row = 0; row < 8; row++) {
+                                        const uint8_t* half = data + (row < 4 ? 0 : 6);
+                                        storeRow(block + row*stride, pattern2(half[2 + row % 4], splat(half[0]), splat(half[1])));
+                                    }
                                 }
                                 data += 12;
                                 len -= 12;
                             }
                             break;
                         case 0x9:
+                            loadColors(data, colors);
                             if (data[0] <= data[1] && data[2] <= data[3]) {
-                                _drawRow4colors(x*8, y*8,     data[0], data[1], data[2], data[3], data[4],   data[5] );
-                                _drawRow4colors(x*8, y*8 + 1, data[0], data[1], data[2], data[3], data[6],   data[7] );
-                                _drawRow4colors(x*8, y*8 + 2, data[0], data[1], data[2], data[3], data[8],   data[9] );
-                                _drawRow4colors(x*8, y*8 + 3, data[0], data[1], data[2], data[3], data[10],  data[11]);
-                                _drawRow4colors(x*8, y*8 + 4, data[0], data[1], data[2], data[3], data[12],  data[13]);
-                                _drawRow4colors(x*8, y*8 + 5, data[0], data[1], data[2], data[3], data[14],  data[15]);
-                                _drawRow4colors(x*8, y*8 + 6, data[0], data[1], data[2], data[3], data[16],  data[17]);
-                                _drawRow4colors(x*8, y*8 + 7, data[0], data[1], data[2], data[3], data[18],  data[19]);
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    storeRow(block + row*stride, pattern4(data[4 + row*2], data[5 + row*2], colors));
+                                }
                                 data += 20;
                                 len -= 20;
                             } else if (data[0] <= data[1] && data[2] > data[3]) {
-                                _drawRow4colors2x2(x*8, y*8,     data[0], data[1], data[2], data[3], data[4]);
-                                _drawRow4colors2x2(x*8, y*8 + 2, data[0], data[1], data[2], data[3], data[5]);
-                                _drawRow4colors2x2(x*8, y*8 + 4, data[0], data[1], data[2], data[3], data[6]);
-                                _drawRow4colors2x2(x*8, y*8 + 6, data[0], data[1], data[2], data[3], data[7]);
+                                // 2x2 cells
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    storeRow(block + row*stride, pattern4Wide(data[4 + row/2], colors));
+                                }
                                 data += 8;
                                 len -= 8;
                             } else if (data[0] > data[1] && data[2] <= data[3]) {
-                                _drawRow4colors2x1(x*8, y*8,     data[0], data[1], data[2], data[3], data[4] );
-                                _drawRow4colors2x1(x*8, y*8 + 1, data[0], data[1], data[2], data[3], data[5] );
-                                _drawRow4colors2x1(x*8, y*8 + 2, data[0], data[1], data[2], data[3], data[6] );
-                                _drawRow4colors2x1(x*8, y*8 + 3, data[0], data[1], data[2], data[3], data[7] );
-                                _drawRow4colors2x1(x*8, y*8 + 4, data[0], data[1], data[2], data[3], data[8] );
-                                _drawRow4colors2x1(x*8, y*8 + 5, data[0], data[1], data[2], data[3], data[9] );
-                                _drawRow4colors2x1(x*8, y*8 + 6, data[0], data[1], data[2], data[3], data[10]);
-                                _drawRow4colors2x1(x*8, y*8 + 7, data[0], data[1], data[2], data[3], data[11]);
+                                // 2x1 cells
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    storeRow(block + row*stride, pattern4Wide(data[4 + row], colors));
+                                }
                                 data += 12;
                                 len -= 12;
                             } else if (data[0] > data[1] && data[2] > data[3]) {
-                                _drawRow4colors1x2(x*8, y*8,     data[0], data[1], data[2], data[3], data[4],  data[5]);
-                                _drawRow4colors1x2(x*8, y*8 + 2, data[0], data[1], data[2], data[3], data[6],  data[7]);
-                                _drawRow4colors1x2(x*8, y*8 + 4, data[0], data[1], data[2], data[3], data[8],  data[9]);
-                                _drawRow4colors1x2(x*8, y*8 + 6, data[0], data[1], data[2], data[3], data[10], data[11]);
+                                // 1x2 cells
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    storeRow(block + row*stride, pattern4(data[4 + (row/2)*2], data[5 + (row/2)*2], colors));
+                                }
                                 data += 12;
                                 len -= 12;
                             }
@@ -420,10 +394,14 @@ namespace Falltergeist
                                 // 0 | 2
                                 // -----
                                 // 1 | 3
-                                _drawQuadrant4colors(x*8,     y*8,     data[0],  data[1],  data[2],  data[3],  data[4],  data[5],  data[6],  data[7] );
-                                _drawQuadrant4colors(x*8,     y*8 + 4, data[8],  data[9],  data[10], data[11], data[12], data[13], data[14], data[15]);
-                                _drawQuadrant4colors(x*8 + 4, y*8,     data[16], data[17], data[18], data[19], data[20], data[21], data[22], data[23]);
-                                _drawQuadrant4colors(x*8 + 4, y*8 + 4, data[24], data[25], data[26], data[27], data[28], data[29], data[30], data[31]);
+                                for (uint32_t row = 0; row < 8; row++) {
+                                    const uint8_t* left = data + (row < 4 ? 0 : 8);
+                                    const uint8_t* right = data + (row < 4 ? 16 : 24);
+                                    if (row % 4 == 0) {
+                                        loadColorHalves(left, right, colors);
+                                    }
+                                    storeRow(block + row*stride, pattern4(left[4 + row % 4], right[4 + row % 4], colors));
+                                }
 
                                 data += 32;
                                 len -= 32;
@@ -432,23 +410,21 @@ namespace Falltergeist
                                     //vertical split, 4 colors per half
                                     // 0 | 2
                                     // 1 | 3
-                                    _drawQuadrant4colors(x*8,     y*8,     data[0],  data[1],  data[2],  data[3],  data[4],  data[5],  data[6],  data[7] );
-                                    _drawQuadrant4colors(x*8,     y*8 + 4, data[0],  data[1],  data[2],  data[3],  data[8],  data[9],  data[10], data[11]);
-                                    _drawQuadrant4colors(x*8 + 4, y*8,     data[12], data[13], data[14], data[15], data[16], data[17], data[18], data[19]);
-                                    _drawQuadrant4colors(x*8 + 4, y*8 + 4, data[12], data[13], data[14], data[15], data[20], data[21], data[22], data[23]);
+                                    loadColorHalves(data, data + 12, colors);
+                                    for (uint32_t row = 0; row < 8; row++) {
+                                        storeRow(block + row*stride, pattern4(data[4 + row], data[16 + row], colors));
+                                    }
                                 } else {
                                     //horizontal split, 4 colors per half
                                     // 0  1
                                     //-----
                                     // 2  3
-                                    _drawRow4colors(x*8, y*8,     data[0],  data[1],  data[2],  data[3],  data[4],   data[5] );
-                                    _drawRow4colors(x*8, y*8 + 1, data[0],  data[1],  data[2],  data[3],  data[6],   data[7] );
-                                    _drawRow4colors(x*8, y*8 + 2, data[0],  data[1],  data[2],  data[3],  data[8],   data[9] );
-                                    _drawRow4colors(x*8, y*8 + 3, data[0],  data[1],  data[2],  data[3],  data[10],  data[11]);
-                                    _drawRow4colors(x*8, y*8 + 4, data[12], data[13], data[14], data[15], data[16],  data[17]);
-                                    _drawRow4colors(x*8, y*8 + 5, data[12], data[13], data[14], data[15], data[18],  data[19]);
-                                    _drawRow4colors(x*8, y*8 + 6, data[12], data[13], data[14], data[15], data[20],  data[21]);
-                                    _drawRow4colors(x*8, y*8 + 7, data[12], data[13], data[14], data[15], data[22],  data[23]);
+                                    loadColors(data, colors);
+                                    loadColors(data + 12, moreColors);
+                                    for (uint32_t row = 0; row < 4; row++) {
+                                        storeRow(block + row*stride, pattern4(data[4 + row*2], data[5 + row*2], colors));
+                                        storeRow(block + (row + 4)*stride, pattern4(data[16 + row*2], data[17 + row*2], moreColors));
+                                    }
                                 }
                                 data += 24;
                                 len -= 24;
@@ -456,73 +432,47 @@ namespace Falltergeist
                             break;
                         //raw data
                         case 0xB:
-                            dstrect.w = 1;
-                            dstrect.h = 1;
                             for (uint32_t fy = 0; fy < 8; fy++) {
-                                for (uint32_t fx = 0; fx < 8; fx++) {
-                                    color=data[fy*8 + fx];
-                                    dstrect.x = x*8 + fx;
-                                    dstrect.y = y*8 + fy;
-                                    SDL_FillRect(_currentBuf, &dstrect, color);
-                                }
+                                memcpy(block + fy*stride, data + fy*8, 8);
                             }
                             data += 64;
                             len -= 64;
                             break;
                         case 0xC:
-                            dstrect.w = 2;
-                            dstrect.h = 2;
+                            // 2x2 pixels
                             for (uint32_t fy = 0; fy < 4; fy++) {
+                                uint8_t row[8];
                                 for (uint32_t fx = 0; fx < 4; fx++) {
-                                    color = data[fy*4 + fx];
-                                    dstrect.x = x*8 + fx*2;
-                                    dstrect.y = y*8 + fy*2;
-                                    SDL_FillRect(_currentBuf, &dstrect, color);
+                                    row[fx*2] = data[fy*4 + fx];
+                                    row[fx*2 + 1] = data[fy*4 + fx];
                                 }
+                                memcpy(block + fy*2*stride, row, 8);
+                                memcpy(block + (fy*2 + 1)*stride, row, 8);
                             }
                             data += 16;
                             len -= 16;
                             break;
                         case 0xD:
-                            dstrect.w = 4;
-                            dstrect.h = 4;
-                            for (uint32_t fy = 0; fy < 2; fy++) {
-                                for (uint32_t fx = 0; fx < 2; fx++) {
-                                    color = data[fy*2 + fx];
-                                    dstrect.x = x*8 + fx*4;
-                                    dstrect.y = y*8 + fy*4;
-                                    SDL_FillRect(_currentBuf, &dstrect, color);
-                                }
+                            // 4x4 pixels
+                            for (uint32_t fy = 0; fy < 8; fy++) {
+                                storeRow(block + fy*stride, splatHalves(data[(fy/4)*2], data[(fy/4)*2 + 1]));
                             }
                             data += 4;
                             len -= 4;
                             break;
                         case 0xE:
-                            dstrect.w = 8;
-                            dstrect.h = 8;
-                            color = data[0];
-                            dstrect.x = x*8;
-                            dstrect.y = y*8;
-                            SDL_FillRect(_currentBuf, &dstrect, color);
+                            for (uint32_t fy = 0; fy < 8; fy++) {
+                                storeRow(block + fy*stride, splat(data[0]));
+                            }
                             data++;
                             len--;
                             break;
                         //check-board
                         case 0xF:
-                            dstrect.w = 1;
-                            dstrect.h = 1;
-                            uint32_t even = 0;
-                            for (uint32_t fy = 0; fy < 8; fy++)
-                            {
-                                for (uint32_t fx = 0; fx < 8; fx++)
-                                {
-                                    color = data[even%2];
-                                    dstrect.x = x*8 + fx;
-                                    dstrect.y = y*8 + fy;
-                                    SDL_FillRect(_currentBuf, &dstrect, color);
-                                    even++;
-                                }
-                                even++;
+                            colors[0] = blend(ROW_ODD_PIXELS, splat(data[0]), splat(data[1]));
+                            colors[1] = blend(ROW_ODD_PIXELS, splat(data[1]), splat(data[0]));
+                            for (uint32_t fy = 0; fy < 8; fy++) {
+                                storeRow(block + fy*stride, colors[fy % 2]);
                             }
                             data += 2;
                             len -= 2;
@@ -532,6 +482,27 @@ namespace Falltergeist
             }
         }
 
+        void MvePlayer::_expandPalette(uint32_t* dst)
+        {
+            const uint8_t* src = _currentBuf.data();
+            uint32_t count = _width * _height;
+            uint32_t i = 0;
+            // frame size is a multiple of 8x8 blocks, so 8 pixels per step covers it completely
+            for (; i + 8 <= count; i += 8) {
+                dst[i]     = _palette[src[i]];
+                dst[i + 1] = _palette[src[i + 1]];
+                dst[i + 2] = _palette[src[i + 2]];
+                dst[i + 3] = _palette[src[i + 3]];
+                dst[i + 4] = _palette[src[i + 4]];
+                dst[i + 5] = _palette[src[i + 5]];
+                dst[i + 6] = _palette[src[i + 6]];
+                dst[i + 7] = _palette[src[i + 7]];
+            }
+            for (; i < count; i++) {
+                dst[i] = _palette[src[i]];
+            }
+        }
+
         void MvePlayer::_decodeVideo( uint8_t* data, uint32_t len )
         {
         /*
@@ -553,25 +524,21 @@ namespace Falltergeist
 
             if (nFlags & 1)
             {
-                SDL_Surface* temp = _currentBuf;
-                _currentBuf = _backBuf;
-                _backBuf = temp;
+                _currentBuf.swap(_backBuf);
             }
             _decodeFrame(data + 14, len - 14);
 
-            SDL_Surface* temp = SDL_ConvertSurfaceFormat(_currentBuf, SDL_PIXELFORMAT_RGBA8888, 0);
-            // Fill alpha channel with 0xFF since it is 0x00 at this point
-            for (auto i = 0; i < temp->w * temp->h; i++) {
-                ((int32_t*)temp->pixels)[i] = ((int32_t*)temp->pixels)[i] | 0xFF;
+            uint32_t* pixels = _movie->lockPixels(Graphics::Size(_width, _height));
+            if (pixels) {
+                _expandPalette(pixels);
             }
-            _movie->loadFromSurface(temp);
-            SDL_FreeSurface(temp);
+            _movie->unlockPixels();
         }
 
         void MvePlayer::_setDecodingMap(uint8_t* data)
         {
-            uint32_t w = _currentBuf->w / 8;
-            uint32_t h = _currentBuf->h / 8;
+            uint32_t w = _width / 8;
+            uint32_t h = _height / 8;
 
             for (uint32_t i = 0; i < w*h/2; i++)
             {
@@ -584,33 +551,17 @@ namespace Falltergeist
         {
             uint16_t start = get_short(data);
             uint16_t count = get_short(data+2);
-            SDL_Color palette[256];
-            palette[0].r = 0;
-            palette[0].g = 0;
-            palette[0].b = 0;
-            palette[0].a = 0;
+            _palette[0] = 0x000000FF;
             uint8_t* pal = data;
             pal+=4;
 
-            for (uint16_t i = start; i <= count; i++)
-            {
-                palette[i].r = *(pal++) << 2;
-                palette[i].g = *(pal++) << 2;
-                palette[i].b = *(pal++) << 2;
-                palette[i].a = 0;
-            }
-            int ret = 1;
-            if (_currentBuf)
+            for (uint16_t i = start; i <= count && i < 256; i++)
             {
-                ret = SDL_SetPaletteColors(_currentBuf->format->palette, palette, 0, 256);
-            }
-            if (_backBuf)
-            {
-                ret = SDL_SetPaletteColors(_backBuf->format->palette, palette, 0, 256);
-            }
-            if (ret != 0)
-            {
-                throw new Exception(SDL_GetError());
+                uint32_t r = *(pal++) << 2;
+                uint32_t g = *(pal++) << 2;
+                uint32_t b = *(pal++) << 2;
+                // texture alpha is always opaque
+                _palette[i] = (r << 24) | (g << 16) | (b << 8) | 0xFF;
             }
         }
 
@@ -627,24 +578,17 @@ namespace Falltergeist
             width = get_short(data) * 8;
             height = get_short(data+2) * 8;
 
-            if (_currentBuf != nullptr) {
+            if (!_currentBuf.empty()) {
                 return;
             }
-            if (_backBuf != nullptr) {
+            if (!_backBuf.empty()) {
                 return;
             }
 
-            _currentBuf = SDL_CreateRGBSurface(0, width, height, 8, 0, 0, 0, 0);
-            if (!_currentBuf)
-            {
-                throw new Exception(SDL_GetError());
-            }
-
-            _backBuf = SDL_CreateRGBSurface(0, width, height, 8, 0, 0, 0, 0);
-            if (!_backBuf)
-            {
-                throw new Exception(SDL_GetError());
-            }
+            _width = width;
+            _height = height;
+            _currentBuf.assign(width * height, 0);
+            _backBuf.assign(width * height, 0);
 
             if (_decodingMap != nullptr) {
                 return;
@@ -9,6 +9,8 @@
 
 // stdlib
 #include <ctime>
+#include <memory>
+#include <vector>
 
 namespace Falltergeist
 {
@@ -25,7 +27,7 @@ namespace Falltergeist
         class MvePlayer : public Falltergeist::UI::Base
         {
             public:
-                MvePlayer(Format::Mve::File* mve);
+                MvePlayer(std::shared_ptr<Format::Mve::File> mve);
 
                 ~MvePlayer() override;
 
@@ -43,7 +45,7 @@ namespace Falltergeist
                 uint32_t frame();
 
             private:
-                Format::Mve::File* _mve = nullptr;
+                std::shared_ptr<Format::Mve::File> _mve;
 
                 std::unique_ptr<Format::Mve::Chunk> _chunk;
 
@@ -71,9 +73,17 @@ namespace Falltergeist
 
                 float _millisecondsTracked = 0;
 
-                SDL_Surface* _currentBuf = nullptr;
+                uint32_t _width = 0;
 
-                SDL_Surface* _backBuf = nullptr;
+                uint32_t _height = 0;
+
+                // 8-bit palette indexed frame buffers
+                std::vector<uint8_t> _currentBuf;
+
+                std::vector<uint8_t> _backBuf;
+
+                // Palette packed as RGBA8888, ready for texture upload
+                uint32_t _palette[256] = {0};
 
                 void _processChunk();
 
@@ -132,21 +142,9 @@ namespace Falltergeist
                 };
 
                 //drawing helpers
-                void _drawRow(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t mask);
-
-                void _drawRow2x2(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t mask);
-
-                void _drawRow4colors(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask1, uint8_t mask2);
-
-                void _drawRow4colors2x2(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask);
-
-                void _drawRow4colors2x1(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask);
-
-                void _drawRow4colors1x2(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask1, uint8_t mask2);
-
-                void _drawQuadrant(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t mask1, uint8_t mask2);
+                void _copyBlock(const std::vector<uint8_t>& src, int32_t srcX, int32_t srcY, uint32_t x, uint32_t y);
 
-                void _drawQuadrant4colors(uint32_t x, uint32_t y, uint8_t c1, uint8_t c2, uint8_t c3, uint8_t c4, uint8_t mask1, uint8_t mask2, uint8_t mask3, uint8_t mask4);
+                void _expandPalette(uint32_t* dst);
         };
     }
 }
@@ -38,7 +38,7 @@ namespace Falltergeist {
 
             _sliderOffset.setX(newOffset);
             _value = ((maxValue() - minValue()) / static_cast<float>(_sliderSize.width())) * (float)_sliderOffset.x();
-            emitEvent(std::make_unique<Event::Event>("change"), changeHandler());
+            emitEvent(Event::Event("change"), changeHandler());
         }
 
         void Slider::_onMouseDown(Event::Mouse* event) {
@@ -90,7 +90,7 @@ namespace Falltergeist {
         void Slider::setValue(double value) {
             _value = value;
             _sliderOffset = _valueToOffset(value);
-            emitEvent(std::make_unique<Event::Event>("change"), changeHandler());
+            emitEvent(Event::Event("change"), changeHandler());
         }
 
         Event::Handler& Slider::changeHandler() {
@@ -30,11 +30,10 @@ namespace Falltergeist
 
                 void setIndex(unsigned int value);
 
-                void enable();
+                // roof region the tile belongs to, see TileMap::disable()
+                unsigned int region() const;
 
-                void disable();
-
-                bool enabled();
+                void setRegion(unsigned int value);
 
             private:
                 unsigned int _index = 0;
@@ -43,7 +42,7 @@ namespace Falltergeist
 
                 Graphics::Point _position;
 
-                bool _enabled = true;
+                unsigned int _region = 0;
         };
     }
 }
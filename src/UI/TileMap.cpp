@@ -10,6 +10,7 @@
 #include "../State/Location.h"
 #include "../UI/Tile.h"
 #include "../UI/TileMap.h"
+#include "../UI/TileRegions.h"
 
 // Third-party includes
 #include <SDL_image.h>
@@ -17,6 +18,7 @@
 // stdlib
 #include <algorithm>
 #include <cmath>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -28,7 +30,7 @@ namespace  Falltergeist
         using Rect = Graphics::Rect;
         using Size = Graphics::Size;
 
-        TileMap::TileMap(std::shared_ptr<ILogger> logger)
+        TileMap::TileMap(std::shared_ptr<ILogger> logger) : _tilesGrid(Size(80, 36))
         {
             this->logger = std::move(logger);
         }
@@ -121,6 +123,9 @@ namespace  Falltergeist
 
             auto tilesLst = ResourceManager::getInstance()->lstFileType("art/tiles/tiles.lst");
 
+            _initHitTesting(numbers);
+            _initRegions();
+
             for (uint8_t i = 0; i < _atlases; i++)
             {
                 SDL_Surface* tmp = SDL_CreateRGBSurface(0, Game::Game::getInstance()->renderer()->maxTextureSize(), Game::Game::getInstance()->renderer()->maxTextureSize(), 32, 0xff000000, 0x00ff0000, 0x0000ff00, 0x000000ff);
@@ -147,6 +152,41 @@ namespace  Falltergeist
             }
         }
 
+        void TileMap::_initHitTesting(const std::vector<unsigned int>& numbers)
+        {
+            auto tilesLst = ResourceManager::getInstance()->lstFileType("art/tiles/tiles.lst");
+            auto pal = ResourceManager::getInstance()->palFileType("color.pal");
+
+            _tileMasks.clear();
+            _tileFrms.clear();
+            for (auto number : numbers) {
+                auto frm = ResourceManager::getInstance()->frmFileType("art/tiles/" + tilesLst->strings()->at(number));
+                _tileMasks.push_back(&frm->mask(pal));
+                _tileFrms.push_back(frm);
+            }
+
+            _gridTiles.clear();
+            if (_tiles.empty()) {
+                _tilesGrid.reset(Point(0, 0), Size(0, 0));
+                return;
+            }
+
+            Point topLeft = _tiles.begin()->second->position();
+            Point bottomRight = topLeft;
+            for (auto& it : _tiles) {
+                auto& position = it.second->position();
+                topLeft = Point(std::min(topLeft.x(), position.x()), std::min(topLeft.y(), position.y()));
+                bottomRight = Point(std::max(bottomRight.x(), position.x()), std::max(bottomRight.y(), position.y()));
+            }
+
+            const Size tileSize = Size(80, 36);
+            _tilesGrid.reset(topLeft, Size(bottomRight - topLeft) + tileSize);
+            for (auto& it : _tiles) {
+                _tilesGrid.insert(static_cast<unsigned int>(_gridTiles.size()), it.second->position(), tileSize);
+                _gridTiles.push_back(it.second.get());
+            }
+        }
+
         void TileMap::render()
         {
             if (_tilemap == nullptr) {
@@ -167,7 +207,7 @@ namespace  Falltergeist
             {
                 auto& tile = it.second;
                 const Size tileSize = Size(80, 36);
-                if (tile->enabled() && Rect::intersects(tile->position(), tileSize, topLeft, size))
+                if (!_regionHidden[tile->region()] && Rect::intersects(tile->position(), tileSize, topLeft, size))
                 {
                     uint32_t aIndex = tile->index() / _tilesPerAtlas;
                     indexes.at(aIndex).push_back(cnt * 4);
@@ -202,11 +242,7 @@ namespace  Falltergeist
 
         void TileMap::enableAll()
         {
-            for (auto& tile : _tiles)
-            {
-                tile.second->enable();
-            }
-
+            _regionHidden.assign(_regionHidden.size(), false);
         }
 
         std::map<unsigned int, std::unique_ptr<Tile>> &TileMap::tiles()
@@ -216,23 +252,28 @@ namespace  Falltergeist
 
         void TileMap::disable(unsigned int num)
         {
-            int x = num % 100;
-            int y = num / 100;
-            _floodDisable(x, y);
+            auto it = _tiles.find(num);
+            if (it != _tiles.end())
+            {
+                _regionHidden.at(it->second->region()) = true;
+            }
         }
 
-        void TileMap::_floodDisable(int x, int y)
+        void TileMap::_initRegions()
         {
-            // TODO: this is basic 4-way floodfill
-            // maybe better replace it with scanlines or QuickFill
-            int num = y * 100 + x;
-            if (_tiles.count(num) && _tiles.at(num)->enabled())
+            std::vector<unsigned int> numbers;
+            numbers.reserve(_tiles.size());
+            for (auto& it : _tiles)
             {
-                _tiles.at(num)->disable();
-                _floodDisable(x + 1, y);
-                _floodDisable(x - 1, y);
-                _floodDisable(x, y + 1);
-                _floodDisable(x, y - 1);
+                numbers.push_back(it.first);
+            }
+
+            std::vector<unsigned int> regions;
+            _regionHidden.assign(TileRegions::label(numbers, regions), false);
+            size_t i = 0;
+            for (auto& it : _tiles)
+            {
+                it.second->setRegion(regions[i++]);
             }
         }
 
@@ -240,16 +281,15 @@ namespace  Falltergeist
         {
             auto camera = Game::Game::getInstance()->locationState()->camera();
 
-            auto tilesLst = ResourceManager::getInstance()->lstFileType("art/tiles/tiles.lst");
-            for (auto& it : _tiles)
+            Point worldPosition = pos + camera->topLeft();
+            for (auto id : _tilesGrid.itemsAt(worldPosition))
             {
-                auto& tile = it.second;
+                auto tile = _gridTiles.at(id);
                 const Size tileSize = Size(80, 36);
-                if (tile->enabled() && Rect::inRect(pos + camera->topLeft(), tile->position(), tileSize))
+                if (!_regionHidden[tile->region()] && Rect::inRect(worldPosition, tile->position(), tileSize))
                 {
-                    auto frm = ResourceManager::getInstance()->frmFileType("art/tiles/" + tilesLst->strings()->at(tile->number()));
-                    auto& mask = frm->mask(ResourceManager::getInstance()->palFileType("color.pal"));
-                    auto position = pos - tile->position() + camera->topLeft() + Point(1, 1);
+                    auto& mask = *_tileMasks.at(tile->index());
+                    auto position = worldPosition - tile->position() + Point(1, 1);
 
                     if ((position.y() * 80 + position.x()) > 0 && ((unsigned)(position.y() * 80 + position.x()) < mask.size()))
                     {
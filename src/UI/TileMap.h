@@ -4,6 +4,7 @@
 #include "../Graphics/Point.h"
 #include "../Graphics/Rect.h"
 #include "../Graphics/Renderer.h"
+#include "../Graphics/SpatialGrid.h"
 #include "../ILogger.h"
 
 // Third-party includes
@@ -11,9 +12,17 @@
 // stdlib
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace Falltergeist
 {
+    namespace Format
+    {
+        namespace Frm
+        {
+            class File;
+        }
+    }
     namespace Graphics
     {
         class Texture;
@@ -42,6 +51,7 @@ namespace Falltergeist
 
                 void enableAll();
 
+                // Hides the whole roof connected to the tile at the given map position
                 void disable(unsigned int num);
 
                 // Tests if there is a non-transparent pixel at the given point.
@@ -60,7 +70,22 @@ namespace Falltergeist
 
                 bool _inside = false;
 
-                void _floodDisable(int x, int y);
+                // world space lookup of tiles for opaque() tests, filled once in init()
+                Graphics::SpatialGrid _tilesGrid;
+
+                std::vector<Tile*> _gridTiles;
+
+                // transparency masks by tile index
+                std::vector<const std::vector<bool>*> _tileMasks;
+                // keeps FRMs of the masks above in the resource cache
+                std::vector<std::shared_ptr<Format::Frm::File>> _tileFrms;
+
+                // hidden flags by region, regions are labeled once in init()
+                std::vector<bool> _regionHidden;
+
+                void _initRegions();
+
+                void _initHitTesting(const std::vector<unsigned int>& numbers);
         };
     }
 }
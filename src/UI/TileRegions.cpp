@@ -0,0 +1,66 @@
+// Project includes
+#include "../UI/TileRegions.h"
+
+// Third-party includes
+
+// stdlib
+#include <limits>
+#include <unordered_map>
+
+namespace Falltergeist
+{
+    namespace UI
+    {
+        unsigned int TileRegions::label(const std::vector<unsigned int>& numbers, std::vector<unsigned int>& regions)
+        {
+            // Union-find over 4-connected tiles. Neighbours are num +/- 1 and num +/- 100, so like the old
+            // flood fill a roof touching the right map edge continues at the left edge of the next row.
+            // Tiles are visited in ascending order, which makes checking the left and upper neighbours enough.
+            std::unordered_map<unsigned int, unsigned int> slots;
+            std::vector<unsigned int> parents;
+            parents.reserve(numbers.size());
+            auto root = [&parents](unsigned int slot) {
+                while (parents[slot] != slot)
+                {
+                    parents[slot] = parents[parents[slot]];
+                    slot = parents[slot];
+                }
+                return slot;
+            };
+
+            for (auto number : numbers)
+            {
+                unsigned int slot = static_cast<unsigned int>(parents.size());
+                parents.push_back(slot);
+                slots.emplace(number, slot);
+
+                for (unsigned int offset : {1u, 100u})
+                {
+                    if (number < offset)
+                    {
+                        continue;
+                    }
+                    auto neighbour = slots.find(number - offset);
+                    if (neighbour != slots.end())
+                    {
+                        parents[root(neighbour->second)] = root(slot);
+                    }
+                }
+            }
+
+            std::vector<unsigned int> labels(parents.size(), std::numeric_limits<unsigned int>::max());
+            unsigned int count = 0;
+            regions.resize(numbers.size());
+            for (unsigned int slot = 0; slot != parents.size(); ++slot)
+            {
+                auto& label = labels[root(slot)];
+                if (label == std::numeric_limits<unsigned int>::max())
+                {
+                    label = count++;
+                }
+                regions[slot] = label;
+            }
+            return count;
+        }
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace UI
+    {
+        // Labels tiles of a 100 tiles wide map into 4-connected regions, used to hide whole roofs at once
+        class TileRegions final
+        {
+            public:
+                // Takes tile numbers in ascending order and fills the region of every tile in the same order.
+                // Regions are numbered from 0 in order of their first tile, returns the number of regions.
+                static unsigned int label(const std::vector<unsigned int>& numbers, std::vector<unsigned int>& regions);
+        };
+    }
+}
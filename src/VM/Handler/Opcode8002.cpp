@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8002.h"
+#include "../../Logger.h"
 
 // Third-party includes
 
@@ -18,7 +19,7 @@ namespace Falltergeist
 
             void Opcode8002::_run(VM::Script& script)
             {
-                _logger->debug() << "[8002] op_critical_start" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8002] op_critical_start" << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8003.h"
+#include "../../Logger.h"
 
 // Third-party includes
 
@@ -18,7 +19,7 @@ namespace Falltergeist
 
             void Opcode8003::_run(VM::Script& script)
             {
-                _logger->debug() << "[8003] op_critical_done" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8003] op_critical_done" << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8004.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
             void Opcode8004::_run(VM::Script& script)
             {
                 auto address = script.dataStack()->popInteger();
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8004] [*] op_jmp(address)" << std::endl
                     << "    address: " << std::hex << address << std::endl
                 ;
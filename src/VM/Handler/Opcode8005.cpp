@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8005.h"
 #include "../../Format/Int/File.h"
 #include "../../Format/Int/Procedure.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -30,7 +31,7 @@ namespace Falltergeist
                     args.push_back(script.dataStack()->popInteger());
                 }*/
                 script.setProgramCounter(script.intFile()->procedures().at(functionIndex).bodyOffset());
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8005] [*] op_call(0x" << std::hex << functionIndex << ") = 0x"
                     << script.programCounter() << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode800CHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode800C::_run(VM::Script& script)
             {
-                _logger->debug() << "[800C] [*] op_a_to_d" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[800C] [*] op_a_to_d" << std::endl;
                 script.dataStack()->push(script.returnStack()->pop());
             }
         }
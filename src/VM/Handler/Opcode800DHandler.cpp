@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode800DHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode800D::_run(VM::Script& script)
             {
-                _logger->debug() << "[800D] [*] op_d_to_a" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[800D] [*] op_d_to_a" << std::endl;
                 script.returnStack()->push(script.dataStack()->pop());
             }
         }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8010Handler.h"
+#include "../../Logger.h"
 #include "../../VM/HaltException.h"
 #include "../../VM/Script.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8010::_run(VM::Script& script)
             {
-                _logger->debug() << "[8010] [*] op_exit_prog" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8010] [*] op_exit_prog" << std::endl;
                 script.setInitialized(true);
                 throw VM::HaltException();
             }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8012Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -24,7 +25,7 @@ namespace Falltergeist
                 auto value = script.dataStack()->values()->at(script.SVARbase() + number);
                 script.dataStack()->push(value);
 
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8012] [*] value = op_fetch_global[num]" << std::endl
                     << "      num: " << number << std::endl
                     << "     type: " << value.typeName() << std::endl
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8013Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -22,14 +23,10 @@ namespace Falltergeist
                 auto value = script.dataStack()->pop();
                 script.dataStack()->values()->at(script.SVARbase() + number) = value;
 
-                auto &debug = _logger->debug();
-
-                debug << "[8013] [*] op_store_global" << std::endl
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8013] [*] op_store_global" << std::endl
                       << "      num: " << number << std::endl
                       << "     type: " << value.typeName() << std::endl
-                      << "    value: " << value.toString();
-
-                debug << std::endl;
+                      << "    value: " << value.toString() << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 ﻿// Project includes
 #include "../../VM/Handler/Opcode8014Handler.h"
+#include "../../Logger.h"
 #include "../../Format/Int/File.h"
 #include "../../Game/Game.h"
 #include "../../State/Location.h"
@@ -23,8 +24,7 @@ namespace Falltergeist
 
             void Opcode8014::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[8014] [+] value = op_fetch_external(name)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8014] [+] value = op_fetch_external(name)" << std::endl;
                 auto game = Game::Game::getInstance();
                 auto EVARS = game->locationState()->EVARS();
                 std::string name;
@@ -40,12 +40,11 @@ namespace Falltergeist
                     default:
                         _error(std::string("op_fetch_external - invalid argument type: ") + nameValue.typeName());
                 }
-                debug << " name = " << name;
                 if (EVARS->find(name) == EVARS->end()) {
                     _error(std::string() + "op_fetch_external: exported variable \"" + name + "\" not found.");
                 }
                 auto value = EVARS->at(name);
-                debug << ", type = " << value.typeName() << ", value = " << value.toString() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << " name = " << name << ", type = " << value.typeName() << ", value = " << value.toString() << std::endl;
                 script.dataStack()->push(value);
             }
 
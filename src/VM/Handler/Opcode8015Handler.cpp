@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8015Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode8015::_run(VM::Script& script)
             {
-                _logger->debug() << "[8015] [*] op_store_external(name, value)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8015] [*] op_store_external(name, value)" << std::endl;
                 std::string name = script.dataStack()->popString();
                 auto value = script.dataStack()->pop();
                 auto game = Game::Game::getInstance();
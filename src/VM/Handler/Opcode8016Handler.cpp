@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8016Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -26,7 +27,7 @@ namespace Falltergeist
                 if (EVARS->find(name) == EVARS->end()) {
                     EVARS->insert(std::make_pair(name, StackValue(0)));
                 }
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8016] [*] op_export_var(name)" << std::endl
                     << "    name: " << name << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8018Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8018::_run(VM::Script& script)
             {
-                _logger->debug() << "[8018] [*] op_swap" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8018] [*] op_swap" << std::endl;
                 script.dataStack()->swap();
             }
         }
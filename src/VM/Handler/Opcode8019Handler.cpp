@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8019Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8019::_run(VM::Script& script)
             {
-                _logger->debug() << "[8019] [*] op_swapa" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8019] [*] op_swapa" << std::endl;
                 script.returnStack()->swap();
             }
         }
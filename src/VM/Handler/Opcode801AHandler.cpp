@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode801AHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode801A::_run(VM::Script& script)
             {
-                _logger->debug() << "[801A] [*] op_pop" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[801A] [*] op_pop" << std::endl;
                 script.dataStack()->pop();
             }
         }
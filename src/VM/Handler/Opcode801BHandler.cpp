@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode801BHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode801B::_run(VM::Script& script)
             {
-                _logger->debug() << "[801B] op_dup" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[801B] op_dup" << std::endl;
                 script.dataStack()->push(script.dataStack()->top());
             }
         }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode801CHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
             void Opcode801C::_run(VM::Script& script)
             {
                 script.setProgramCounter(script.returnStack()->popInteger());
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[801C] [*] op_pop_return 0x" << std::hex << script.programCounter()
                     << std::endl
                 ;
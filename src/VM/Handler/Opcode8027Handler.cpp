@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8027Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8027::_run(VM::Script& script)
             {
-                _logger->debug() << "[8027] [?] op_check_arg_count" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8027] [?] op_check_arg_count" << std::endl;
                 script.dataStack()->pop(); // number of actual arguments
                 script.dataStack()->pop(); // procedure index
                 // @TODO: compare number of arguments with procedure info and throw script exception if they are not equal
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8028Handler.h"
 #include "../../Format/Int/File.h"
 #include "../../Format/Int/Procedure.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8028::_run(VM::Script& script)
             {
-                _logger->debug() << "[8028] [?] int lookup_string_proc(string)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8028] [?] int lookup_string_proc(string)" << std::endl;
                 std::string name = script.dataStack()->popString();
                 script.dataStack()->push((int) script.intFile()->procedure(name)->bodyOffset());
             }
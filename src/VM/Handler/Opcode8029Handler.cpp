@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8029Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
             void Opcode8029::_run(VM::Script& script)
             {
                 script.setDVARBase(static_cast<size_t>(script.returnStack()->popInteger()));
-                _logger->debug() << "[8029] [*] op_pop_base " << script.DVARbase() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8029] [*] op_pop_base " << script.DVARbase() << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode802AHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode802A::_run(VM::Script& script)
             {
-                _logger->debug() << "[802A] [*] op_pop_to_base" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[802A] [*] op_pop_to_base" << std::endl;
                 while (script.dataStack()->size() > script.DVARbase()) {
                     script.dataStack()->pop();
                 }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode802BHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -22,7 +23,7 @@ namespace Falltergeist
                 auto argumentsCounter = script.dataStack()->popInteger();
                 script.returnStack()->push(static_cast<unsigned>(script.DVARbase()));
                 script.setDVARBase(script.dataStack()->size() - argumentsCounter);
-                _logger->debug() << "[802B] [*] op_push_base = " << script.DVARbase() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[802B] [*] op_push_base = " << script.DVARbase() << std::endl;
             }
 
         }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode802CHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
             void Opcode802C::_run(VM::Script& script)
             {
                 script.setSVARbase(static_cast<int>(script.dataStack()->size()));
-                _logger->debug() << "[802C] [*] op_set_global = " << script.SVARbase() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[802C] [*] op_set_global = " << script.SVARbase() << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode802FHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
             {
                 auto condition = script.dataStack()->popLogical();
                 auto address = script.dataStack()->popInteger();
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[802F] [*] op_if(address, condition) " << std::hex
                     << script.programCounter() << std::endl
                     << "    address = " << std::hex << address << std::endl
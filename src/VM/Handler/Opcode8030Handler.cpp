@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8030Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8030::_run(VM::Script& script)
             {
-                _logger->debug() << "[8030] [*] op_while(address, condition)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8030] [*] op_while(address, condition)" << std::endl;
                 auto condition = script.dataStack()->popLogical();
                 if (!condition) {
                     script.setProgramCounter(script.dataStack()->popInteger());
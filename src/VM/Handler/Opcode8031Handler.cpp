@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8031Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
             {
                 auto num = script.dataStack()->popInteger();
                 auto value = script.dataStack()->pop();
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8031] [*] op_store " << "var" << std::hex << num << " type = "
                     << value.typeName() << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8032Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -22,7 +23,7 @@ namespace Falltergeist
                 auto num = script.dataStack()->popInteger();
                 auto value = script.dataStack()->values()->at(script.DVARbase() + num);
                 script.dataStack()->push(value);
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8032] [*] op_fetch " << "var" << std::hex << num << " type = "
                     << value.typeName() << std::endl
                 ;
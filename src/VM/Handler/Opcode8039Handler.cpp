@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8039Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -19,11 +20,10 @@ namespace Falltergeist
             }
 
             void Opcode8039::_run(VM::Script& script) {
-                auto &debug = _logger->debug();
-                debug << "[8039] [*] op_add(aValue, bValue)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8039] [*] op_add(aValue, bValue)" << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
-                debug << "    types: " << aValue.typeName() << " + " << bValue.typeName() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    types: " << aValue.typeName() << " + " << bValue.typeName() << std::endl;
                 switch (bValue.type()) {
                     case StackValue::Type::INTEGER: // INTEGER
                     {
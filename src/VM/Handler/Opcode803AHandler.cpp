@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode803AHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode803A::_run(VM::Script& script)
             {
-                _logger->debug() << "[803A] [*] op_sub(a, b) -" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[803A] [*] op_sub(a, b) -" << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
                 if (!bValue.isNumber() || !aValue.isNumber()) {
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode803BHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode803B::_run(VM::Script& script)
             {
-                _logger->debug() << "[803B] [*] op_mul(a, b) *" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[803B] [*] op_mul(a, b) *" << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
                 if (!bValue.isNumber() || !aValue.isNumber()) {
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode803CHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode803C::_run(VM::Script& script)
             {
-                _logger->debug() << "[803C] [*] op_div /" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[803C] [*] op_div /" << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
                 if (!bValue.isNumber() || !aValue.isNumber()) {
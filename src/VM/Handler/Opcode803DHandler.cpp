@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode803DHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode803D::_run(VM::Script& script)
             {
-                _logger->debug() << "[803D] [*] op_mod %" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[803D] [*] op_mod %" << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
                 if (!aValue.isNumber() || !bValue.isNumber()) {
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode803FHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode803F::_run(VM::Script& script)
             {
-                _logger->debug() << "[803F] [+] op_or" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[803F] [+] op_or" << std::endl;
                 auto b = script.dataStack()->popLogical();
                 auto a = script.dataStack()->popLogical();
                 script.dataStack()->push(a || b); // integer 1 or 0
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8040Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8040::_run(VM::Script& script)
             {
-                _logger->debug() << "[8040] [*] op_bwand" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8040] [*] op_bwand" << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
                 if (!aValue.isNumber() || !bValue.isNumber()) {
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8043Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8043::_run(VM::Script& script)
             {
-                _logger->debug() << "[8043] [*] op_bwnot" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8043] [*] op_bwnot" << std::endl;
                 auto arg = script.dataStack()->pop();
                 if (!arg.isNumber()) {
                     _error(std::string("op_bwnot: invalid argument type: ") + arg.typeName());
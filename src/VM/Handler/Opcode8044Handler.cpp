@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8044Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8044::_run(VM::Script& script)
             {
-                _logger->debug() << "[8044] [*] op_floor" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8044] [*] op_floor" << std::endl;
                 auto value = script.dataStack()->pop();
                 int result = 0;
                 if (value.type() == StackValue::Type::FLOAT) {
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8045Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8045::_run(VM::Script& script)
             {
-                _logger->debug() << "[8045] [*] op_not" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8045] [*] op_not" << std::endl;
                 auto a = script.dataStack()->popLogical();
                 script.dataStack()->push((int) (!a));
             }
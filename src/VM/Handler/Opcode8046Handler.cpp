@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8046Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8046::_run(VM::Script& script)
             {
-                _logger->debug() << "[8046] [*] op_negate" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8046] [*] op_negate" << std::endl;
                 auto value = script.dataStack()->pop();
                 if (value.type() == StackValue::Type::INTEGER) {
                     script.dataStack()->push(-value.integerValue());
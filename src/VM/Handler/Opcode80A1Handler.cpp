@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80A1Handler.h"
 #include "../../Game/DudeObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80A1::_run(VM::Script& script)
             {
-                _logger->debug() << "[80A1] [+] void give_exp_points(int points)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80A1] [+] void give_exp_points(int points)" << std::endl;
                 auto points = script.dataStack()->popInteger();
                 auto game = Game::Game::getInstance();
                 game->player()->setExperience(game->player()->experience() + points);
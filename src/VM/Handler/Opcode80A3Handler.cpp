@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80A3Handler.h"
 #include "../../Audio/Mixer.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80A3::_run(VM::Script& script)
             {
-                _logger->debug() << "[80A3] [=] void play_sfx(string* p1)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80A3] [=] void play_sfx(string* p1)" << std::endl;
                 auto name = script.dataStack()->popString();
                 Game::Game::getInstance()->mixer()->playACMSound("sound/sfx/" + name + ".acm");
             }
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80A4Handler.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode80A4::_run(VM::Script& script)
             {
-                _logger->debug() << "[80A4] [+] std::string* obj_name(GameCritterObject* who)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80A4] [+] std::string* obj_name(GameCritterObject* who)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 script.dataStack()->push(object->name());
             }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80A6Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -17,7 +18,7 @@ namespace Falltergeist
 
             void Opcode80A6::_run(VM::Script& script)
             {
-                _logger->debug() << "[80A6] [=] int SkillPoints(int PCStatNum)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80A6] [=] int SkillPoints(int PCStatNum)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->push(0);
             }
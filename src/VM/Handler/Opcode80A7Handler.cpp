@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80A7Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
@@ -22,21 +23,14 @@ namespace Falltergeist
 
             void Opcode80A7::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                         << "[80A7] [+] GameObject* tile_contains_pid_obj(int position, int elevation, int PID)"
                         << std::endl;
                 auto PID = script.dataStack()->popInteger();
                 auto elevation = script.dataStack()->popInteger();
                 auto position = script.dataStack()->popInteger();
                 auto game = Game::Game::getInstance();
-                Game::Object *found = nullptr;
-                for (auto object : *game->locationState()->hexagonGrid()->at(position)->objects()) {
-                    if (object->PID() == PID && object->elevation() == elevation) {
-                        found = object;
-                        break;
-                    }
-                }
-                script.dataStack()->push(found);
+                script.dataStack()->push(game->locationState()->objectWithPID(PID, position, elevation));
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80A8Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -17,7 +18,7 @@ namespace Falltergeist
 
             void Opcode80A8::_run(VM::Script& script)
             {
-                _logger->debug() << "[80A8] [=] void set_map_start(int x, int y, int elev, int rot)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80A8] [=] void set_map_start(int x, int y, int elev, int rot)" << std::endl;
                 auto dataStack = script.dataStack();
                 dataStack->popInteger();
                 dataStack->popInteger();
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80A9Handler.h"
 #include "../../Game/DudeObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode80A9::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                         << "[80A9] [+] void override_map_start(int x, int y, int elevation, int orientation)"
                         << std::endl;
                 auto dataStack = script.dataStack();
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80AAHandler.h"
+#include "../../Logger.h"
 #include "../../Game/CritterObject.h"
 #include "../../VM/Script.h"
 
@@ -18,10 +19,9 @@ namespace Falltergeist
 
             void Opcode80AA::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[80AA] [+] int get_skill_value(GameCritterObject* who, int skill) " << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80AA] [+] int get_skill_value(GameCritterObject* who, int skill) " << std::endl;
                 int skill = script.dataStack()->popInteger();
-                debug << "    skill = " << skill << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    skill = " << skill << std::endl;
                 if (skill > 17 || skill < 0) {
                     _error("get_skill_value - skill out of range: " + std::to_string(skill));
                 }
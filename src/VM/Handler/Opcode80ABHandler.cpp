@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80ABHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -17,7 +18,7 @@ namespace Falltergeist
 
             void Opcode80AB::_run(VM::Script& script) {
                 // @TODO: implement
-                _logger->debug() << "[80AB] [=] int using_skill(GameCritterObject* who, int skill)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80AB] [=] int using_skill(GameCritterObject* who, int skill)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->popObject();
                 script.dataStack()->push(0);
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80ACHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -17,7 +18,7 @@ namespace Falltergeist
 
             void Opcode80AC::_run(VM::Script& script)
             {
-                _logger->debug() << "[80AC] [=] int roll_vs_skill(ObjectPtr who, int skill, int modifier)"
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80AC] [=] int roll_vs_skill(ObjectPtr who, int skill, int modifier)"
                                         << std::endl;
                 auto dataStack = script.dataStack();
                 dataStack->popInteger();
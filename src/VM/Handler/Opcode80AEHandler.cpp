@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80AEHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80AE::_run(VM::Script& script)
             {
-                _logger->debug() << "[80AE] [=] int do_check(ObjectPtr who, int check, int modifier)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80AE] [=] int do_check(ObjectPtr who, int check, int modifier)" << std::endl;
                 auto dataStack = script.dataStack();
                 dataStack->popInteger();
                 dataStack->popInteger();
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80AFHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80AF::_run(VM::Script& script)
             {
-                _logger->debug() << "[80AF] [*] int is_success(int val)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80AF] [*] int is_success(int val)" << std::endl;
                 auto value = script.dataStack()->popInteger();
                 switch (value) {
                     case 0:
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80B0Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80B0::_run(VM::Script& script)
             {
-                _logger->debug() << "[80B0] [*] int is_critical(int val)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80B0] [*] int is_critical(int val)" << std::endl;
                 auto value = script.dataStack()->popInteger();
                 if (value == 0 || value == 3) {
                     script.dataStack()->push(1);
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80B2Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80B2::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                         << "[80B2] [=] void mark_area_known(int AREA_MARK_TYPE, int AreaNum, int MARK_STATE);"
                         << std::endl;
                 script.dataStack()->popInteger();
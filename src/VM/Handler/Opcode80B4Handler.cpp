@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80B4Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80B4::_run(VM::Script& script)
             {
-                _logger->debug() << "[80B4] [+] int rand(int min, int max)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80B4] [+] int rand(int min, int max)" << std::endl;
                 auto max = script.dataStack()->popInteger();
                 auto min = script.dataStack()->popInteger();
                 script.dataStack()->push(rand() % (max - min + 1) + min);
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80B6Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/DudeObject.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
@@ -24,7 +25,7 @@ namespace Falltergeist
 
             void Opcode80B6::_run(VM::Script& script)
             {
-                _logger->debug() << "[80B6] [+] int move_to(GameObject* object, int position, int elevation)"
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80B6] [+] int move_to(GameObject* object, int position, int elevation)"
                                         << std::endl;
                 auto elevation = script.dataStack()->popInteger();
                 auto position = script.dataStack()->popInteger();
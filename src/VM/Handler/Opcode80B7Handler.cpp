@@ -3,6 +3,7 @@
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
 #include "../../Game/ObjectFactory.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../ResourceManager.h"
@@ -25,7 +26,7 @@ namespace Falltergeist
             }
 
             void Opcode80B7::_run(VM::Script& script) {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                         << "[80B7] [+] GameObject* create_object_sid(int PID, int position, int elevation, int SID)"
                         << std::endl;
                 auto dataStack = script.dataStack();
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80B8Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode80B8::_run(VM::Script& script)
             {
-                _logger->debug() << "[80B8] [*] void display_msg(string)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80B8] [*] void display_msg(string)" << std::endl;
                 auto value = script.dataStack()->pop();
                 auto game = Game::Game::getInstance();
                 game->locationState()->displayMessage(value.toString());
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80B9Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80B9::_run(VM::Script& script)
             {
-                _logger->debug() << "[80B9] script_overrides" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80B9] script_overrides" << std::endl;
                 script.setOverrides(true);
             }
         }
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80BAHandler.h"
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/CritterObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80BA::_run(VM::Script& script)
             {
-                _logger->debug() << "[80BA] [+] int obj_is_carrying_obj_pid(GameObject* object, int PID)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80BA] [+] int obj_is_carrying_obj_pid(GameObject* object, int PID)" << std::endl;
                 auto PID = script.dataStack()->popInteger();
                 auto object = script.dataStack()->popObject();
 
@@ -3,6 +3,7 @@
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
 #include "../../Game/ObjectFactory.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../ResourceManager.h"
@@ -26,7 +27,7 @@ namespace Falltergeist
 
             void Opcode80BB::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80BB] [+] int tile_contains_obj_pid(int position, int elevation, int PID)"
                     << std::endl
                 ;
@@ -34,12 +35,7 @@ namespace Falltergeist
                 auto elevation = script.dataStack()->popInteger();
                 auto position = script.dataStack()->popInteger();
                 auto game = Game::Game::getInstance();
-                int found = 0;
-                for (auto object : *game->locationState()->hexagonGrid()->at(position)->objects()) {
-                    if (object->PID() == PID && object->elevation() == elevation) {
-                        found = 1;
-                    }
-                }
+                int found = game->locationState()->objectWithPID(PID, position, elevation) ? 1 : 0;
                 script.dataStack()->push(found);
             }
         }
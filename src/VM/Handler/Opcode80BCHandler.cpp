@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80BCHandler.h"
 #include "../../Game/CritterObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode80BC::_run(VM::Script& script)
             {
-                _logger->debug() << "[80BC] [+] GameObject* self_obj()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80BC] [+] GameObject* self_obj()" << std::endl;
                 script.dataStack()->push(script.owner());
             }
         }
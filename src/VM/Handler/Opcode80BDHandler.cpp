@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80BDHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80BD::_run(VM::Script& script)
             {
-                _logger->debug() << "[80BD] [=] void* source_obj()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80BD] [=] void* source_obj()" << std::endl;
                 script.dataStack()->push(script.sourceObject());
             }
         }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80BEHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80BE::_run(VM::Script& script)
             {
-                _logger->debug() << "[80BE/80C0] [=] object target_obj/obj_being_used_with()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80BE/80C0] [=] object target_obj/obj_being_used_with()" << std::endl;
                 script.dataStack()->push(script.targetObject());
             }
         }
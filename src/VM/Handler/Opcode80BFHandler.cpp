@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80BFHandler.h"
 #include "../../Game/DudeObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80BF::_run(VM::Script& script)
             {
-                _logger->debug() << "[80BF] [+] GameDudeObject* dude_obj()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80BF] [+] GameDudeObject* dude_obj()" << std::endl;
                 auto game = Game::Game::getInstance();
                 script.dataStack()->push(game->player().get());
             }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C1Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode80C1::_run(VM::Script& script)
             {
-                _logger->debug() << "[80C1] [*] LVAR[num]" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C1] [*] LVAR[num]" << std::endl;
                 unsigned int num = script.dataStack()->popInteger();
                 while (num >= script.LVARS()->size()) {
                     script.LVARS()->push_back(StackValue(0));
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C2Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode80C2::_run(VM::Script& script)
             {
-                _logger->debug() << "[80C2] [*] LVAR[num] = value" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C2] [*] LVAR[num] = value" << std::endl;
                 auto value = script.dataStack()->pop();
                 unsigned int num = script.dataStack()->popInteger();
                 while (num >= script.LVARS()->size()) {
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C3Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80C3::_run(VM::Script& script)
             {
-                _logger->debug() << "[80C3] [?] MVAR[num]" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C3] [?] MVAR[num]" << std::endl;
                 auto num = script.dataStack()->popInteger();
                 if (num < 0) {
                     script.dataStack()->push(0);
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80C4Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode80C4::_run(VM::Script& script)
             {
-                _logger->debug() << "[80C4] [+] MVAR[num] = value" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C4] [+] MVAR[num] = value" << std::endl;
                 auto value = script.dataStack()->popInteger();
                 auto num = script.dataStack()->popInteger();
                 auto game = Game::Game::getInstance();
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C5Handler.h"
+#include "../../Logger.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
 #include "../../VM/Script.h"
@@ -19,8 +20,7 @@ namespace Falltergeist
 
             void Opcode80C5::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[80C5] [?] GVAR[num]" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C5] [?] GVAR[num]" << std::endl;
                 int num = script.dataStack()->popInteger();
                 int value = 0;
                 if (num < 0) {
@@ -31,8 +31,8 @@ namespace Falltergeist
                 }
                 script.dataStack()->push(value);
 
-                debug << "    num = 0x" << std::hex << num << std::endl;
-                debug << "    value = 0x" << std::hex << value << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    num = 0x" << std::hex << num << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    value = 0x" << std::hex << value << std::endl;
             }
         }
     }
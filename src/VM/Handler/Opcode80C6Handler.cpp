@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C6Handler.h"
+#include "../../Logger.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
 #include "../../VM/Script.h"
@@ -19,13 +20,12 @@ namespace Falltergeist
 
             void Opcode80C6::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[80C6] [+] GVAR[num] = value" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C6] [+] GVAR[num] = value" << std::endl;
                 auto value = script.dataStack()->popInteger();
                 auto num = script.dataStack()->popInteger();
                 auto game = Game::Game::getInstance();
                 game->setGVAR(num, value);
-                debug << "    num = " << num << ", value = " << value << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    num = " << num << ", value = " << value << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C7Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80C7::_run(VM::Script& script)
             {
-                _logger->debug() << "[80C7] [*] int script_action()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C7] [*] int script_action()" << std::endl;
                 script.dataStack()->push(21);
             }
         }
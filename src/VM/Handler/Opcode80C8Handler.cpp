@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80C8Handler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
             void Opcode80C8::_run(VM::Script& script)
             {
                 // @TODO: implement
-                _logger->debug() << "[80C8] [=] int obj_type(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C8] [=] int obj_type(void* obj)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 Game::Object::Type type = object->type();
                 switch (type) {
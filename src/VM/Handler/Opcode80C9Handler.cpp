@@ -9,6 +9,7 @@
 #include "../../Game/MiscItemObject.h"
 #include "../../Game/Object.h"
 #include "../../Game/WeaponItemObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -28,7 +29,7 @@ namespace Falltergeist
 
             void Opcode80C9::_run(VM::Script& script)
             {
-                _logger->debug() << "[80C9] [+] int obj_item_subtype(GameItemObject* object)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80C9] [+] int obj_item_subtype(GameItemObject* object)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (dynamic_cast<Game::ArmorItemObject *>(object)) {
                     script.dataStack()->push(0);
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80CAHandler.h"
+#include "../../Logger.h"
 #include "../../Game/CritterObject.h"
 #include "../../VM/Script.h"
 
@@ -20,10 +21,9 @@ namespace Falltergeist
 
             void Opcode80CA::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[80CA] [+] int value = get_critter_stat(GameCritterObject* who, int number)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80CA] [+] int value = get_critter_stat(GameCritterObject* who, int number)" << std::endl;
                 int number = script.dataStack()->popInteger();
-                debug << "    number = " << number << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    number = " << number << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("get_critter_stat(who, stat) - who is NULL");
@@ -198,7 +198,7 @@ namespace Falltergeist
                     }
                 }
                 script.dataStack()->push(result);
-                debug << "    value  = " << result << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    value  = " << result << std::endl;
             }
         }
     }
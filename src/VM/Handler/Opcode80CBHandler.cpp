@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80CBHandler.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/DudeObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80CB::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80CB] [+] int set_critter_stat(GameCritterObject* who, int number, int value)"
                     << std::endl
                 ;
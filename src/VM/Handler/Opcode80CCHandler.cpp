@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80CCHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80CC::_run(VM::Script& script)
             {
-                _logger->debug() << "[80CC] [=] void animate_stand_obj(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80CC] [=] void animate_stand_obj(void* obj)" << std::endl;
                 script.dataStack()->popObject();
             }
         }
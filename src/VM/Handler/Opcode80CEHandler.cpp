@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80CEHandler.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
@@ -24,7 +25,7 @@ namespace Falltergeist
             // TODO: handle ANIMATE_INTERRUPT
             void Opcode80CE::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80CE] [=] void animate_move_obj_to_tile(void* who, int tile, int speed)"
                     << std::endl
                 ;
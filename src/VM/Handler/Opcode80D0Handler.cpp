@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80D0Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80D0::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80D0] [=] void attack_complex(ObjectPtr who, int called_shot, int num_attacks, int bonus"
                     << ", int min_damage, int max_damage, int attacker_results, int target_results)"
                     << std::endl
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80D2Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode80D2::_run(VM::Script& script)
             {
-                _logger->debug() << "[80D2] [=] int tile_distance(int tile1, int tile2)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80D2] [=] int tile_distance(int tile1, int tile2)" << std::endl;
                 auto tile1 = script.dataStack()->popInteger();
                 auto tile2 = script.dataStack()->popInteger();
                 if (tile1 < 0 || tile1 >= 200 * 200 || tile2 < 0 || tile2 >= 200 * 200) {
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80D3Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode80D3::_run(VM::Script& script)
             {
-                _logger->debug() << "[80D3] int tile_distance_objs(void* p2, void* p1)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80D3] int tile_distance_objs(void* p2, void* p1)" << std::endl;
                 auto obj1 = script.dataStack()->popObject();
                 auto obj2 = script.dataStack()->popObject();
                 int distance = Game::Game::getInstance()->locationState()->hexagonGrid()->distance(obj1->hexagon(),
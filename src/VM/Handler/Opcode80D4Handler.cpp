@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80D4Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../ResourceManager.h"
@@ -25,7 +26,7 @@ namespace Falltergeist
 
             void Opcode80D4::_run(VM::Script& script)
             {
-                _logger->debug() << "[80D4] [+] int tile_num(GameObject* object)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80D4] [+] int tile_num(GameObject* object)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("tile_num - object is NULL");
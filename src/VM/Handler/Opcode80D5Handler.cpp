@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80D5Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode80D5::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80D5] [*] int tile_num_in_direction(int start_tile, int dir, int distance)"
                     << std::endl
                 ;
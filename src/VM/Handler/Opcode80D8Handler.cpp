@@ -3,6 +3,7 @@
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode80D8::_run(VM::Script& script)
             {
-                _logger->debug() << "[80D8] [=] void add_obj_to_inven(void* who, void* item)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80D8] [=] void add_obj_to_inven(void* who, void* item)" << std::endl;
                 auto item = dynamic_cast<Game::ItemObject *>(script.dataStack()->popObject());
                 auto invenObj = script.dataStack()->popObject();
 
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80D9Handler.h"
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/CritterObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode80D9::_run(VM::Script& script)
             {
-                _logger->debug() << "[80D9] [=] void rm_obj_from_inven(void* who, void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80D9] [=] void rm_obj_from_inven(void* who, void* obj)" << std::endl;
                 auto item = dynamic_cast<Game::ItemObject *>(script.dataStack()->popObject());
                 auto invenObj = script.dataStack()->popObject();
 
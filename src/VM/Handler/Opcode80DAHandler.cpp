@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80DAHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80DA::_run(VM::Script& script)
             {
-                _logger->debug() << "[80DA] [=] void wield_obj_critter(void* who, void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80DA] [=] void wield_obj_critter(void* who, void* obj)" << std::endl;
                 script.dataStack()->popObject();
                 script.dataStack()->popObject();
             }
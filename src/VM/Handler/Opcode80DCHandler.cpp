@@ -1,5 +1,11 @@
 // Project includes
 #include "../../VM/Handler/Opcode80DCHandler.h"
+#include "../../Game/Game.h"
+#include "../../Game/Object.h"
+#include "../../Logger.h"
+#include "../../PathFinding/Hexagon.h"
+#include "../../PathFinding/HexagonGrid.h"
+#include "../../State/Location.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,13 +25,18 @@ namespace Falltergeist
 
             void Opcode80DC::_run(VM::Script& script)
             {
-                _logger->debug()
-                    << "[80DC] [=] int obj_can_see_obj(GameObject* src_obj, GameObject* dst_obj)"
+                FALLTERGEIST_LOG_DEBUG(_logger)
+                    << "[80DC] [+] int obj_can_see_obj(GameObject* src_obj, GameObject* dst_obj)"
                     << std::endl
                 ;
-                script.dataStack()->popObject();
-                script.dataStack()->popObject();
-                script.dataStack()->push(1);
+                auto to = script.dataStack()->popObject();
+                auto from = script.dataStack()->popObject();
+                int result = 0;
+                if (from && to && from->elevation() == to->elevation() && from->hexagon() && to->hexagon()) {
+                    auto grid = Game::Game::getInstance()->locationState()->hexagonGrid();
+                    result = grid->lineOfSight(from->hexagon(), to->hexagon()) ? 1 : 0;
+                }
+                script.dataStack()->push(result);
             }
         }
     }
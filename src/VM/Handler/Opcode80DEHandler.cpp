@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80DEHandler.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/CritterDialog.h"
 #include "../../State/CritterInteract.h"
 #include "../../UI/ResourceManager.h"
@@ -24,7 +25,7 @@ namespace Falltergeist
 
             void Opcode80DE::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80DE] [*] void start_gdialog(int msgFileID, GameCritterObject* critter, int mood, int headID, int backgroundID)"
                     << std::endl
                 ;
@@ -40,7 +41,7 @@ namespace Falltergeist
                 int msgFileID = script.dataStack()->popInteger();
                 if (headID > -1) {
                     auto reaction = script.LVARS()->at(0).integerValue();
-                    _logger->debug() << "Initial reaction: " << reaction << std::endl;
+                    FALLTERGEIST_LOG_DEBUG(_logger) << "Initial reaction: " << reaction << std::endl;
                     if (reaction <= -10) {
                         mood = State::CritterInteract::Mood::BAD;
                     } else if (reaction <= 10) {
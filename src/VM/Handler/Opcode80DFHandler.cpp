@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80DFHandler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode80DF::_run(VM::Script& script)
             {
-                _logger->debug() << "[80DF] [?] end_dialogue" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80DF] [?] end_dialogue" << std::endl;
                 auto game = Game::Game::getInstance();
                 game->popState(); // interact state
             }
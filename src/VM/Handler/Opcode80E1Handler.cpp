@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E1Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -22,7 +23,7 @@ namespace Falltergeist
             void Opcode80E1::_run(VM::Script& script)
             {
                 // @TODO: add implementation
-                _logger->debug() << "[80E1] [*] int metarule3(int meta, int p1, int p2, int p3)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E1] [*] int metarule3(int meta, int p1, int p2, int p3)" << std::endl;
                 auto dataStack = script.dataStack();
 
                 auto arg3 = dataStack->pop();
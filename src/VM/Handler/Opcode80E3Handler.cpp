@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E3Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80E3::_run(VM::Script& script)
             {
-                _logger->debug() << "[80E3] [=] void set_obj_visibility(void* obj, int visibility)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E3] [=] void set_obj_visibility(void* obj, int visibility)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->popObject();
             }
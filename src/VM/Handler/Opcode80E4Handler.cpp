@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E4Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80E4::_run(VM::Script& script)
             {
-                _logger->debug() << "[80E4] [=] void load_map(string* map, int param)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E4] [=] void load_map(string* map, int param)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->popObject();
             }
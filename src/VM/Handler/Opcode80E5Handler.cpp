@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E5Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80E5::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80E5] [=] void wm_area_set_pos(int areaIdx, int xPos, int yPos)"
                     << std::endl
                 ;
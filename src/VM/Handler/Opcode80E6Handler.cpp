@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E6Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,12 +20,12 @@ namespace Falltergeist
 
             void Opcode80E6::_run(VM::Script& script)
             {
-                _logger->debug() << "[80E6] [=] void set_exit_grids(int mapId, int elevation, int tileNum, int rotation)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E6] [=] void set_exit_grids(int mapId, int elevation, int tileNum, int rotation)" << std::endl;
                 auto rotation = script.dataStack()->popInteger();
                 auto tile = script.dataStack()->popInteger();
                 auto elevation = script.dataStack()->popInteger();
                 auto mapId = script.dataStack()->popInteger();
-                _logger->debug() << "mapId=" << mapId << "elevation=" << elevation << " tile=" << tile << " rotation=" << rotation << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "mapId=" << mapId << "elevation=" << elevation << " tile=" << tile << " rotation=" << rotation << std::endl;
             }
         }
     }
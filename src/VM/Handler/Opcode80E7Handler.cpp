@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E7Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80E7::_run(VM::Script& script)
             {
-                _logger->debug() << "[80E7] [=] int anim_busy(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E7] [=] int anim_busy(void* obj)" << std::endl;
                 script.dataStack()->popObject();//auto object = (GameObject*)popDataPointer();
                 //pushDataInteger(object->animationQueue()->enabled());
                 script.dataStack()->push(1);
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E8Handler.h"
+#include "../../Logger.h"
 #include "../../Game/CritterObject.h"
 #include "../../VM/Script.h"
 
@@ -20,12 +21,9 @@ namespace Falltergeist
 
             void Opcode80E8::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug()
-                    << "[80E8] [+] void critter_heal(ObjectPtr who, int amount)"
-                    << std::endl
-                ;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E8] [+] void critter_heal(ObjectPtr who, int amount)" << std::endl;
                 int amount = script.dataStack()->popInteger();
-                debug << "    amount = " << amount << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    amount = " << amount << std::endl;
                 auto critter = dynamic_cast<Game::CritterObject *>(script.dataStack()->popObject());
                 if (!critter) {
                     _error("VM::critter_heal - invalid critter pointer");
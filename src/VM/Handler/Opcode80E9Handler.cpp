@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80E9Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80E9::_run(VM::Script& script)
             {
-                _logger->debug() << "[80E9] [*] void set_light_level(int level)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80E9] [*] void set_light_level(int level)" << std::endl;
                 auto level = script.dataStack()->popInteger();
 
                 if (level > 100 || level < 0) {
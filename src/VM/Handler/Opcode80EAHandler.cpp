@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80EAHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -16,7 +17,7 @@ namespace Falltergeist {
             }
 
             void Opcode80EA::_run(VM::Script& script) {
-                _logger->debug() << "[80EA] [*] int gameTime()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80EA] [*] int gameTime()" << std::endl;
                 script.dataStack()->push((int)_time->ticks());
             }
         }
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80ECHandler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode80EC::_run(VM::Script& script)
             {
-                _logger->debug() << "[80EC] [=] int elevation(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80EC] [=] int elevation(void* obj)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("elevation - object is NULL");
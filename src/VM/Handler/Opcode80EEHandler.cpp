@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80EEHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80EE::_run(VM::Script& script)
             {
-                _logger->debug() << "[80EE] [=] void kill_critter_type(int pid)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80EE] [=] void kill_critter_type(int pid)" << std::endl;
                 script.dataStack()->popInteger();
             }
         }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80EFHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80EF::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80EF] void critter_dmg(ObjectPtr who, int dmg_amount, int dmg_type)"
                     << std::endl
                 ;
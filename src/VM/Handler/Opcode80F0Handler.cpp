@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F0Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80F0::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80F0] [=] void add_timer_event(void* obj, int time, int info)"
                     << std::endl
                 ;
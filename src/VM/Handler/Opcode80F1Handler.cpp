@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F1Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80F1::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F1] [=] void rm_timer_event (void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F1] [=] void rm_timer_event (void* obj)" << std::endl;
                 Game::Object *object = script.dataStack()->popObject();
                 auto state = Game::Game::getInstance()->locationState();
                 if (state) {
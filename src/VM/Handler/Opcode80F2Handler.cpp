@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F2Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80F2::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F2] [=] int game_ticks(int seconds)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F2] [=] int game_ticks(int seconds)" << std::endl;
                 auto seconds = script.dataStack()->popInteger();
                 // one second equals 10 game ticks
                 script.dataStack()->push(seconds * 10);
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F3Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80F3::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F3] [=] int has_trait(int type,void* who, int trait)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F3] [=] int has_trait(int type,void* who, int trait)" << std::endl;
                 auto dataStack = script.dataStack();
                 dataStack->popInteger();
                 dataStack->popObject();
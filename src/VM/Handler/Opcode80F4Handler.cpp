@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F4Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80F4::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F4] [=] int destroy_object(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F4] [=] int destroy_object(void* obj)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 Game::Game::getInstance()->locationState()->destroyObject(object);
                 script.dataStack()->push(0);
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80F6Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Time.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode80F6::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F6] [*] int game_time_hour" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F6] [*] int game_time_hour" << std::endl;
                 unsigned int hours = Game::Game::getInstance()->gameTime()->hours();
                 unsigned int minutes = Game::Game::getInstance()->gameTime()->minutes();
 
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F7Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80F7::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F7] [=] int fixed_param()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F7] [=] int fixed_param()" << std::endl;
                 script.dataStack()->push(script.fixedParam());
             }
         }
@@ -3,6 +3,7 @@
 #include "../../Game/Game.h"
 #include "../../Graphics/Rect.h"
 #include "../../LocationCamera.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
@@ -27,7 +28,7 @@ namespace Falltergeist
 
             void Opcode80F8::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F8] [=] bool tile_is_visible (int hex)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F8] [=] bool tile_is_visible (int hex)" << std::endl;
                 int hexnum = script.dataStack()->popInteger();
                 auto& hex = Game::Game::getInstance()->locationState()->hexagonGrid()->at(hexnum);
                 bool inrect = Graphics::Rect::inRect(
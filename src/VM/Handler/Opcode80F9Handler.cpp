@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80F9Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80F9::_run(VM::Script& script)
             {
-                _logger->debug() << "[80F9] [=] void dialogue_system_enter()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80F9] [=] void dialogue_system_enter()" << std::endl;
             }
         }
     }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80FAHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode80FA::_run(VM::Script& script)
             {
-                _logger->debug() << "[80FA] [+] int action_being_used()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80FA] [+] int action_being_used()" << std::endl;
                 script.dataStack()->push((signed) script.usedSkill());
             }
         }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80FBHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -17,7 +18,7 @@ namespace Falltergeist
 
             void Opcode80FB::_run(VM::Script& script)
             {
-                _logger->debug() << "[80FB] [=] int critter_state(void* who)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80FB] [=] int critter_state(void* who)" << std::endl;
                 script.dataStack()->popObject();
                 script.dataStack()->push(0);
             }
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode80FCHandler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Time.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -22,7 +23,7 @@ namespace Falltergeist
             void Opcode80FC::_run(VM::Script& script)
             {
                 int amount = script.dataStack()->popInteger();
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80FC] [=] void game_time_advance(int amount)" << std::endl
                     << "    amount = " << amount << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80FDHandler.h"
+#include "../../Logger.h"
 #include "../../Game/DudeObject.h"
 #include "../../VM/Script.h"
 
@@ -20,10 +21,9 @@ namespace Falltergeist
 
             void Opcode80FD::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[80FD] [+] void radiation_inc(GameObject* who, int amount)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80FD] [+] void radiation_inc(GameObject* who, int amount)" << std::endl;
                 int amount = script.dataStack()->popInteger();
-                debug << "    amount = " << amount << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    amount = " << amount << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("radiation_inc - object is NULL");
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode80FEHandler.h"
+#include "../../Logger.h"
 #include "../../Game/DudeObject.h"
 #include "../../VM/Script.h"
 
@@ -19,10 +20,9 @@ namespace Falltergeist
             }
 
             void Opcode80FE::_run(VM::Script& script) {
-                auto &debug = _logger->debug();
-                debug << "[80FE] [+] void radiation_dec(GameObject* who, int amount)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[80FE] [+] void radiation_dec(GameObject* who, int amount)" << std::endl;
                 int amount = script.dataStack()->popInteger();
-                debug << "    amount = " << amount << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    amount = " << amount << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("radiation_dec - object is NULL");
@@ -3,6 +3,7 @@
 #include "../../Game/CritterObject.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../ResourceManager.h"
@@ -26,7 +27,7 @@ namespace Falltergeist
 
             void Opcode80FF::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[80FF] [*] int critter_attempt_placement(GameCritterObject* critter, int position, int elevation)"
                     << std::endl
                 ;
@@ -3,6 +3,7 @@
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
 #include "../../Game/ObjectFactory.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode8100::_run(VM::Script& script)
             {
-                _logger->debug() << "[8100] [+] int obj_pid(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8100] [+] int obj_pid(void* obj)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     script.dataStack()->push(0);
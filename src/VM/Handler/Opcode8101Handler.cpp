@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8101Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8101::_run(VM::Script& script)
             {
-                _logger->debug() << "[8101] [=] int cur_map_index()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8101] [=] int cur_map_index()" << std::endl;
                 script.dataStack()->push(Game::Game::getInstance()->locationState()->currentMapIndex());
             }
         }
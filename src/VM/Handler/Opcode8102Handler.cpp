@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8102Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -18,7 +19,7 @@ namespace Falltergeist
             }
 
             void Opcode8102::_run(VM::Script& script) {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8102] [*] int critter_add_trait(void* who, int trait_type, int trait, int amount) "
                     << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8105Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8105::_run(VM::Script& script)
             {
-                _logger->debug() << "[8105] [+] string message_str(int msg_list, int msg_num);" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8105] [+] string message_str(int msg_list, int msg_num);" << std::endl;
                 auto msgNum = script.dataStack()->popInteger();
                 auto msgList = script.dataStack()->popInteger();
                 script.dataStack()->push(script.msgMessage(msgList, msgNum));
@@ -4,6 +4,7 @@
 #include "../../Game/CritterObject.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode8106::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8106] [=] void* (int) critter_inven_obj(GameCritterObject* critter, int where)"
                     << std::endl
                 ;
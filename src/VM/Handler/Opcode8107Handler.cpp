@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8107Handler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8107::_run(VM::Script& script)
             {
-                _logger->debug() << "[8107] [*] void obj_set_light_level(Object* object, int level, int radius)"
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8107] [*] void obj_set_light_level(Object* object, int level, int radius)"
                                         << std::endl;
                 auto object = script.dataStack()->popObject();
                 auto level = script.dataStack()->popInteger();
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode810AHandler.h"
 #include "../../Game/Object.h"
 #include "../../Graphics/Color.h"
+#include "../../Logger.h"
 #include "../../ResourceManager.h"
 #include "../../UI/TextArea.h"
 #include "../../VM/Script.h"
@@ -24,7 +25,7 @@ namespace Falltergeist
 
             void Opcode810A::_run(VM::Script& script)
             {
-                _logger->debug() << "[810A] [=] void float_msg(object who, string msg, int type) " << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[810A] [=] void float_msg(object who, string msg, int type) " << std::endl;
                 int type = script.dataStack()->popInteger();
                 Graphics::Color color = {0x00, 0x00, 0x00, 0xff};
                 switch (type) {
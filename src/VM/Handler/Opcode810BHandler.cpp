@@ -5,6 +5,7 @@
 #include "../../Game/SceneryObject.h"
 #include "../../Game/ElevatorSceneryObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Location.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../PathFinding/Hexagon.h"
@@ -30,7 +31,7 @@ namespace Falltergeist
 
             void Opcode810B::_run(VM::Script& script)
             {
-                _logger->debug() << "[810B] [*] int metarule(int type, value)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[810B] [*] int metarule(int type, value)" << std::endl;
                 auto value = script.dataStack()->pop();
                 auto type = script.dataStack()->popInteger();
 
@@ -47,29 +48,28 @@ namespace Falltergeist
                         if (auto critter = dynamic_cast<Game::CritterObject *>(object)) {
                             _logger->info() << "Triggered critter PID = " << critter->PID() << std::endl;
 
-                            bool found = false;
-                            for (int i = 1; i < 6; i++) {
-                                if (!found) {
-                                    auto hexagons = Game::Game::getInstance()->locationState()->hexagonGrid()->ring(critter->hexagon(), i);
-
-                                    for (auto hexagon: hexagons) {
-                                        if (!found) {
-                                            auto position = hexagon->number();
-                                            auto objects = Game::Game::getInstance()->locationState()->hexagonGrid()->at(position)->objects();
-
-                                            for (auto object : *objects) {
-                                                if (object->type() == Game::Object::Type::SCENERY && object->PID() == PID_ELEVATOR_STUB) {
-                                                    if (auto elevatorStub = dynamic_cast<Game::ElevatorSceneryObject *>(object)) {
-                                                        _logger->info() << "[ELEVATOR] stub found: type = " << (uint32_t)elevatorStub->elevatorType() << " level = " << (uint32_t)elevatorStub->elevatorLevel() << std::endl;
-                                                        found = true;
-                                                        auto elevatorDialog = new State::ElevatorDialog(std::make_shared<UI::ResourceManager>(), _logger, elevatorStub->elevatorType(), elevatorStub->elevatorLevel());
-                                                        Game::Game::getInstance()->pushState(elevatorDialog);
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
+                            // nearest elevator stub within 5 hexes
+                            auto locationState = Game::Game::getInstance()->locationState();
+                            Game::ElevatorSceneryObject* elevatorStub = nullptr;
+                            unsigned int nearest = 6;
+                            for (auto object : locationState->objectsWithPID(PID_ELEVATOR_STUB)) {
+                                if (object->type() != Game::Object::Type::SCENERY || !object->hexagon()) {
+                                    continue;
+                                }
+                                auto distance = locationState->hexagonGrid()->distance(critter->hexagon(), object->hexagon());
+                                if (distance == 0 || distance >= nearest) {
+                                    continue;
                                 }
+                                if (auto stub = dynamic_cast<Game::ElevatorSceneryObject *>(object)) {
+                                    elevatorStub = stub;
+                                    nearest = distance;
+                                }
+                            }
+
+                            if (elevatorStub) {
+                                _logger->info() << "[ELEVATOR] stub found: type = " << (uint32_t)elevatorStub->elevatorType() << " level = " << (uint32_t)elevatorStub->elevatorLevel() << std::endl;
+                                auto elevatorDialog = new State::ElevatorDialog(std::make_shared<UI::ResourceManager>(), _logger, elevatorStub->elevatorType(), elevatorStub->elevatorLevel());
+                                Game::Game::getInstance()->pushState(elevatorDialog);
                             }
                         }
 
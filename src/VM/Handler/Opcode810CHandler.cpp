@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode810CHandler.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -25,7 +26,7 @@ namespace Falltergeist
                 int animation = script.dataStack()->popInteger();
                 auto object = static_cast<Game::Object *>(script.dataStack()->popObject());
 
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[810C] [*] void anim(GameCritterObject* who, int animation, int direction)"
                     << std::endl
                     << "    direction = 0x" << std::hex << direction << std::endl
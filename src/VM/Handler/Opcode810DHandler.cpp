@@ -3,6 +3,7 @@
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/ItemObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode810D::_run(VM::Script& script)
             {
-                _logger->debug() << "[810D] [=] void* obj_carrying_pid_obj(void* who, int pid)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[810D] [=] void* obj_carrying_pid_obj(void* who, int pid)" << std::endl;
                 const int pid = script.dataStack()->popInteger();
                 auto who = script.dataStack()->popObject();
 
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode810EHandler.h"
 #include "../../Game/CritterObject.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../UI/AnimationQueue.h"
 #include "../../VM/Script.h"
 
@@ -22,7 +23,7 @@ namespace Falltergeist
 
             void Opcode810E::_run(VM::Script& script)
             {
-                _logger->debug() << "[810E] [=] void reg_anim_func(int mode, int arg)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[810E] [=] void reg_anim_func(int mode, int arg)" << std::endl;
                 auto arg = script.dataStack()->pop(); // pointer or integer
                 auto p1 = script.dataStack()->popInteger();
                 switch (p1) {
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode810FHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode810F::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[810F] [=] void reg_anim_animate(void* what, int anim, int delay) "
                     << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8113Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8113::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8113] [=] void reg_anim_obj_move_to_tile(void* who, int dest_tile, int delay)"
                     << std::endl
                 ;
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8115Handler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/Movie.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8115::_run(VM::Script& script)
             {
-                _logger->debug() << "[8115] [*] void playMovie(int movie)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8115] [*] void playMovie(int movie)" << std::endl;
                 int movie = script.dataStack()->popInteger();
                 auto state = new State::Movie(movie);
                 Game::Game::getInstance()->pushState(state);
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8117Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8117::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8117] [=] int rm_mult_objs_from_inven(void* who, void* obj, int count)"
                     << std::endl
                 ;
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8118Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Time.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8118::_run(VM::Script& script)
             {
-                _logger->debug() << "[8118] [*] int get_month" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8118] [*] int get_month" << std::endl;
                 script.dataStack()->push(Game::Game::getInstance()->gameTime()->month());
             }
         }
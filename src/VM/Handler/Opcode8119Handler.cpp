@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8119Handler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Time.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -22,7 +23,7 @@ namespace Falltergeist
             void Opcode8119::_run(VM::Script& script)
             {
                 script.dataStack()->push(Game::Game::getInstance()->gameTime()->day());
-                _logger->debug() << "[8119] [*] int get_day()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8119] [*] int get_day()" << std::endl;
             }
         }
     }
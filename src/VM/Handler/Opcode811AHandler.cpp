@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode811AHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,11 +20,11 @@ namespace Falltergeist
 
             void Opcode811A::_run(VM::Script& script)
             {
-                _logger->debug() << "[811A] [=] int explosion(int where, int elevation, int damage)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[811A] [=] int explosion(int where, int elevation, int damage)" << std::endl;
                 auto damageRadius = script.dataStack()->popInteger();
                 auto elevation = script.dataStack()->popInteger();
                 auto tile = script.dataStack()->popInteger();
-                _logger->debug() << "Triggered explosion on elevation " << elevation << " on tile " << tile << " with damage radius " << damageRadius << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "Triggered explosion on elevation " << elevation << " on tile " << tile << " with damage radius " << damageRadius << std::endl;
                 script.dataStack()->push(0);
             }
         }
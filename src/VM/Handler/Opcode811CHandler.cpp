@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode811CHandler.h"
 #include "../../Game/Game.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../State/CritterDialog.h"
 #include "../../State/CritterDialogReview.h"
 #include "../../State/CritterInteract.h"
@@ -24,7 +25,7 @@ namespace Falltergeist
 
             void Opcode811C::_run(VM::Script& script)
             {
-                _logger->debug() << "[811C] [?] gsay_start" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[811C] [?] gsay_start" << std::endl;
 
                 if (auto interact = dynamic_cast<Falltergeist::State::CritterInteract *>(Game::Game::getInstance()->topState())) {
                     interact->dialogReview()->setCritterName(script.owner()->scrName());
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode811DHandler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/CritterDialog.h"
 #include "../../State/CritterInteract.h"
 #include "../../VM/HaltException.h"
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode811D::_run(VM::Script& script)
             {
-                _logger->debug() << "[811D] [?] gsay_end" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[811D] [?] gsay_end" << std::endl;
                 auto dialog = dynamic_cast<State::CritterDialog *>(Game::Game::getInstance()->topState());
                 if (dialog->hasAnswers()) {
                     script.dataStack()->push(0); // function return value
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode811EHandler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/CritterDialog.h"
 #include "../../State/CritterInteract.h"
 #include "../../VM/Script.h"
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode811E::_run(VM::Script& script)
             {
-                _logger->debug() << "[811E] [=] void gSay_Reply(int msg_file_num, int msg_num)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[811E] [=] void gSay_Reply(int msg_file_num, int msg_num)" << std::endl;
                 auto dialog = dynamic_cast<State::CritterDialog *>(Game::Game::getInstance()->topState());
                 dialog->deleteAnswers();
                 if (script.dataStack()->top().type() == StackValue::Type::STRING) {
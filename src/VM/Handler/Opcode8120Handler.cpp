@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8120Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8120::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8120] [=] void gSay_Message(int msg_list, int msg_num, int reaction)"
                     << std::endl
                 ;
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8121Handler.h"
 #include "../../Game/DudeObject.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../State/CritterDialog.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode8121::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8121] [+] void giQ_Option(int iq_test, int msg_list, int msg_num, procedure target, int reaction)"
                     << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8122Handler.h"
+#include "../../Logger.h"
 #include "../../Game/CritterObject.h"
 #include "../../VM/Script.h"
 
@@ -20,10 +21,9 @@ namespace Falltergeist
 
             void Opcode8122::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug();
-                debug << "[8122] [+] void poison(GameCritterObject* who, int amount)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8122] [+] void poison(GameCritterObject* who, int amount)" << std::endl;
                 int amount = script.dataStack()->popInteger();
-                debug << "    amount = " << amount << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "    amount = " << amount << std::endl;
                 auto critter = dynamic_cast<Game::CritterObject *>(script.dataStack()->popObject());
                 if (!critter) {
                     _error("poison - WHO is not critter");
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8123Handler.h"
 #include "../../Game/CritterObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -23,7 +24,7 @@ namespace Falltergeist
                 auto critter = dynamic_cast<Game::CritterObject *>(script.dataStack()->popObject());
                 auto value = critter->poisonLevel();
                 script.dataStack()->push(value);
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8123] [+] int value = GetPoison(GameCritterObject* critter)" << std::endl
                     << "    value = " << value << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8125Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8125::_run(VM::Script& script)
             {
-                _logger->debug() << "[8125] [=] void party_remove(void* who)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8125] [=] void party_remove(void* who)" << std::endl;
                 script.dataStack()->popObject();
             }
         }
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8126Handler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../UI/AnimationQueue.h"
 #include "../../VM/Script.h"
 
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8126::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8126] [-] void reg_anim_animate_forever(GameObject* obj , int delay)"
                     << std::endl
                 ;
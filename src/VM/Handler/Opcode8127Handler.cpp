@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8127Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8127::_run(VM::Script& script)
             {
-                _logger->debug() << "[8127] [*] void critter_injure(ObjectPtr who, int how)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8127] [*] void critter_injure(ObjectPtr who, int how)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->popObject();
             }
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8128Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8128::_run(VM::Script& script)
             {
-                _logger->debug() << "[8128] [=] int combat_is_initialized()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8128] [=] int combat_is_initialized()" << std::endl;
                 script.dataStack()->push(0);
             }
         }
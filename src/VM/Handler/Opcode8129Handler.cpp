@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8129Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8129::_run(VM::Script& script)
             {
-                _logger->debug() << "[8129] [=] void gdialog_mod_barter(int modifier)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8129] [=] void gdialog_mod_barter(int modifier)" << std::endl;
                 script.dataStack()->popInteger();
             }
         }
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode812DHandler.h"
 #include "../../Game/DoorSceneryObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode812D::_run(VM::Script& script)
             {
-                _logger->debug() << "[812D] [+] int is_locked(GameDoorSceneryObject* object)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[812D] [+] int is_locked(GameDoorSceneryObject* object)" << std::endl;
                 auto object = dynamic_cast<Game::DoorSceneryObject *>(script.dataStack()->popObject());
                 script.dataStack()->push(object->locked());
             }
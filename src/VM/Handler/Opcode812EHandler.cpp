@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode812EHandler.h"
+#include "../../Logger.h"
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/DoorSceneryObject.h"
 #include "../../VM/Script.h"
@@ -21,10 +22,10 @@ namespace Falltergeist
 
             void Opcode812E::_run(VM::Script& script)
             {
-                auto &debug = _logger->debug() << "[812E] [+] void obj_lock(GameObject* object)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[812E] [+] void obj_lock(GameObject* object)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (object) {
-                    debug << "    PID: 0x" << std::hex << (object ? object->PID() : 0) << std::endl;
+                    FALLTERGEIST_LOG_DEBUG(_logger) << "    PID: 0x" << std::hex << (object ? object->PID() : 0) << std::endl;
                     if (auto door = dynamic_cast<Game::DoorSceneryObject *>(object)) {
                         door->setLocked(true);
                     } else if (auto container = dynamic_cast<Game::ContainerItemObject *>(object)) {
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode812FHandler.h"
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/DoorSceneryObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode812F::_run(VM::Script& script)
             {
-                _logger->debug() << "[812F] [+] void obj_unlock(GameObject* object)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[812F] [+] void obj_unlock(GameObject* object)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (object) {
                     if (auto door = dynamic_cast<Game::DoorSceneryObject *>(object)) {
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8131Handler.h"
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/DoorSceneryObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8131::_run(VM::Script& script)
             {
-                _logger->debug() << "[8131] [+] void obj_open(GameDoorSceneryObject* object) " << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8131] [+] void obj_open(GameDoorSceneryObject* object) " << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("obj_open: object is NULL");
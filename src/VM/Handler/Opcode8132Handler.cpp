@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8132Handler.h"
 #include "../../Game/ContainerItemObject.h"
 #include "../../Game/DoorSceneryObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
 
             void Opcode8132::_run(VM::Script& script)
             {
-                _logger->debug() << "[8132] [+] void obj_close(GameDoorSceneryObject* object) " << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8132] [+] void obj_close(GameDoorSceneryObject* object) " << std::endl;
                 auto object = script.dataStack()->popObject();
                 if (!object) {
                     _error("obj_close: object is NULL");
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8134Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8134::_run(VM::Script& script)
             {
-                _logger->debug() << "[8134] [=] void game_ui_enable()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8134] [=] void game_ui_enable()" << std::endl;
             }
         }
     }
@@ -2,6 +2,7 @@
 #include "../../VM/Handler/Opcode8137Handler.h"
 #include "../../Game/Game.h"
 #include "../../Graphics/Renderer.h"
+#include "../../Logger.h"
 #include "../../State/State.h"
 #include "../../VM/HaltException.h"
 #include "../../VM/Script.h"
@@ -24,7 +25,7 @@ namespace Falltergeist
             void Opcode8137::_run(VM::Script& script)
             {
                 int time = script.dataStack()->popInteger(); // original engine ignores time
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8137] [=] void gfade_in(int time)" << std::endl
                     << "    time = " << time << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8138Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8138::_run(VM::Script& script)
             {
-                _logger->debug() << "[8138] [=] int item_caps_total(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8138] [=] int item_caps_total(void* obj)" << std::endl;
                 script.dataStack()->popObject();
                 script.dataStack()->push(0);
             }
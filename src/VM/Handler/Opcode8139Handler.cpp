@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8139Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8139::_run(VM::Script& script)
             {
-                _logger->debug() << "[8139] [=] int item_caps_adjust(void* obj, int amount)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8139] [=] int item_caps_adjust(void* obj, int amount)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->popObject();
                 script.dataStack()->push(0);
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode813CHandler.h"
 #include "../../Game/CritterObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -26,7 +27,7 @@ namespace Falltergeist
 
                 critter->setSkillGainedValue((SKILL) skill, critter->skillGainedValue((SKILL) skill) + amount);
 
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[813C] void critter_mod_skill(GameCritterObject* who, int skill, int amount)" << std::endl
                     << "    skill = " << skill << std::endl
                     << "    amount = " << amount << std::endl
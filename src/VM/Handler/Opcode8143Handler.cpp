@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8143Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8143::_run(VM::Script& script)
             {
-                _logger->debug() << "[8143] [=] void attack_setup(ObjectPtr who, ObjectPtr victim)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8143] [=] void attack_setup(ObjectPtr who, ObjectPtr victim)" << std::endl;
                 script.dataStack()->popObject();
                 script.dataStack()->popObject();
             }
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8145Handler.h"
 #include "../../Game/CritterObject.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -20,7 +21,7 @@ namespace Falltergeist
 
             void Opcode8145::_run(VM::Script& script)
             {
-                _logger->debug() << "[8145] [=] void use_obj_on_obj(void* item, void* target)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8145] [=] void use_obj_on_obj(void* item, void* target)" << std::endl;
                 auto selfCritter = dynamic_cast<Game::CritterObject *>(script.owner());
                 if (!selfCritter) {
                     _error("use_obj_on_obj: owner is not a critter!");
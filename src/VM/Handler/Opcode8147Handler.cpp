@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8147Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8147::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8147] [=] void move_obj_inven_to_obj(void* srcObj, void* destObj)"
                     << std::endl
                 ;
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode8149Handler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
             void Opcode8149::_run(VM::Script& script)
             {
                 // TODO: should it return FID of current animation?
-                _logger->debug() << "[8149] [+] int obj_art_fid(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8149] [+] int obj_art_fid(void* obj)" << std::endl;
                 auto object = script.dataStack()->popObject();
                 script.dataStack()->push(object->FID());
             }
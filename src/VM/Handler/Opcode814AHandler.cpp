@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode814AHandler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
             void Opcode814A::_run(VM::Script& script)
             {
                 // @TODO
-                _logger->debug() << "[814A] [*] int art_anim(int fid)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[814A] [*] int art_anim(int fid)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->push(0);
             }
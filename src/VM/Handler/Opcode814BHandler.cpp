@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode814BHandler.h"
 #include "../../Game/Object.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -21,7 +22,7 @@ namespace Falltergeist
             void Opcode814B::_run(VM::Script& script)
             {
                 // @TODO
-                _logger->debug() << "[814B] [*] void* party_member_obj(int pid)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[814B] [*] void* party_member_obj(int pid)" << std::endl;
                 script.dataStack()->popInteger();
                 script.dataStack()->push((Game::Object *) nullptr);
             }
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/Opcode814CHandler.h"
 #include "../../Game/Game.h"
+#include "../../Logger.h"
 #include "../../PathFinding/Hexagon.h"
 #include "../../PathFinding/HexagonGrid.h"
 #include "../../State/Location.h"
@@ -23,7 +24,7 @@ namespace Falltergeist
 
             void Opcode814C::_run(VM::Script& script)
             {
-                _logger->debug() << "[814C] [=] int rotation_to_tile(int srcTile, int destTile)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[814C] [=] int rotation_to_tile(int srcTile, int destTile)" << std::endl;
                 // TODO: error checking
                 auto to_index = script.dataStack()->popInteger();
                 auto from_index = script.dataStack()->popInteger();
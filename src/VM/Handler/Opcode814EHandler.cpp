@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode814EHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode814E::_run(VM::Script& script)
             {
-                _logger->debug() << "[814E] [=] void gdialog_set_barter_mod(int mod)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[814E] [=] void gdialog_set_barter_mod(int mod)" << std::endl;
                 script.dataStack()->popInteger();
             }
         }
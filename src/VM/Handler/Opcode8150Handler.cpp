@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8150Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8150::_run(VM::Script& script)
             {
-                _logger->debug() << "[8150] [=] int obj_on_screen(void* obj)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8150] [=] int obj_on_screen(void* obj)" << std::endl;
                 script.dataStack()->popObject();
                 script.dataStack()->push(1);
             }
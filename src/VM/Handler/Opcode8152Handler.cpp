@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8152Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8152::_run(VM::Script& script)
             {
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[8152] [=] void op_critter_set_flee_state(critter who, boolean flag)"
                     << std::endl
                 ;
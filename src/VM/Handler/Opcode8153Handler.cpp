@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8153Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,7 +20,7 @@ namespace Falltergeist
 
             void Opcode8153::_run(VM::Script& script)
             {
-                _logger->debug() << "[8153] [=] void terminate_combat()" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8153] [=] void terminate_combat()" << std::endl;
             }
         }
     }
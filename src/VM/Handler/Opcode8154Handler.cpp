@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/Opcode8154Handler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 
 // Third-party includes
@@ -19,9 +20,9 @@ namespace Falltergeist
 
             void Opcode8154::_run(VM::Script& script)
             {
-                _logger->debug() << "[8154] [*] void debug(string*)" << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8154] [*] void debug(string*)" << std::endl;
                 auto value = script.dataStack()->pop();
-                _logger->debug() << value.toString() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << value.toString() << std::endl;
             }
         }
     }
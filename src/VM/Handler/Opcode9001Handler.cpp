@@ -1,6 +1,7 @@
 ﻿// Project includes
 #include "../../VM/Handler/Opcode9001Handler.h"
 #include "../../Format/Int/File.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -21,8 +22,8 @@ namespace Falltergeist
 
             void Opcode9001::_run(VM::Script& script)
             {
-                unsigned int data = script.intFile()->readValue();
-                unsigned short nextOpcode = script.intFile()->readOpcode();
+                unsigned int data = script.readValue();
+                unsigned short nextOpcode = script.readOpcode();
 
                 // Skip 4 readed bytes
                 script.setProgramCounter(script.programCounter() + 4);
@@ -42,7 +43,7 @@ namespace Falltergeist
                 }
 
                 auto value = script.dataStack()->top();
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[9001] [*] push_d string" << std::endl
                     << "     type: " << value.typeName() << std::endl
                     << "    value: " << value.toString() << std::endl
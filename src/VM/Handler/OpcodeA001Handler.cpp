@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/OpcodeA001Handler.h"
 #include "../../Format/Int/File.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -26,13 +27,13 @@ namespace Falltergeist
                     float fValue;
                 } uValue;
 
-                uValue.iValue = script.intFile()->readValue();
+                uValue.iValue = script.readValue();
 
                 // Skip 4 bytes for read float value
                 script.setProgramCounter(script.programCounter() + 4);
                 script.dataStack()->push(StackValue(uValue.fValue));
 
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[A001] [*] push_d float" << std::endl
                     << "    value: " << std::to_string(uValue.fValue) << std::endl
                 ;
@@ -1,6 +1,7 @@
 // Project includes
 #include "../../VM/Handler/OpcodeC001Handler.h"
 #include "../../Format/Int/File.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -21,13 +22,13 @@ namespace Falltergeist
 
             void OpcodeC001::_run(VM::Script& script)
             {
-                int value = script.intFile()->readValue();
+                int value = script.readValue();
 
                 // Skip 4 bytes for readed integer value
                 script.setProgramCounter(script.programCounter() + 4);
                 script.dataStack()->push(StackValue(value));
 
-                _logger->debug()
+                FALLTERGEIST_LOG_DEBUG(_logger)
                     << "[C001] [*] push_d integer" << std::endl
                     << "    value: " << std::to_string(value) << std::endl
                 ;
@@ -1,5 +1,6 @@
 // Project includes
 #include "../../VM/Handler/OpcodeComparisonHandler.h"
+#include "../../Logger.h"
 #include "../../VM/Script.h"
 #include "../../VM/StackValue.h"
 
@@ -40,7 +41,7 @@ namespace Falltergeist
 
             void OpcodeComparison::_run(VM::Script& script)
             {
-                _logger->debug() << "[8033-8038] [*] " << _cmpOpcodeName() << std::endl;
+                FALLTERGEIST_LOG_DEBUG(_logger) << "[8033-8038] [*] " << _cmpOpcodeName() << std::endl;
                 auto bValue = script.dataStack()->pop();
                 auto aValue = script.dataStack()->pop();
                 int result = 0;
@@ -0,0 +1,139 @@
+// Project includes
+#include "../Game/Object.h"
+#include "../VM/Profiler.h"
+#include "../VM/Script.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace Falltergeist
+{
+    namespace VM
+    {
+        bool Profiler::_enabled = false;
+        std::unordered_map<Profiler::Key, Profiler::ProcedureStats, Profiler::KeyHash> Profiler::_procedures;
+        std::unordered_map<std::string, unsigned> Profiler::_procedureIds;
+        std::vector<std::string> Profiler::_procedureNames;
+        std::vector<Profiler::Frame> Profiler::_frames;
+
+        void Profiler::setEnabled(bool value)
+        {
+            // don't leave frames that will never be closed
+            if (!value) {
+                _frames.clear();
+            }
+            _enabled = value;
+        }
+
+        void Profiler::reset()
+        {
+            _procedures.clear();
+            _procedureIds.clear();
+            _procedureNames.clear();
+            _frames.clear();
+        }
+
+        unsigned Profiler::_procedureId(const std::string& procedure)
+        {
+            auto it = _procedureIds.find(procedure);
+            if (it != _procedureIds.end()) {
+                return it->second;
+            }
+            unsigned id = static_cast<unsigned>(_procedureNames.size());
+            _procedureNames.push_back(procedure);
+            _procedureIds.emplace(procedure, id);
+            return id;
+        }
+
+        void Profiler::_enter(Script& script, const std::string& procedure)
+        {
+            Game::Object* owner = script.owner();
+            Key key{owner ? static_cast<const void*>(owner) : &script, _procedureId(procedure)};
+            auto inserted = _procedures.try_emplace(key);
+            auto& stats = inserted.first->second;
+            if (inserted.second) {
+                // the filename is set by ResourceManager::intFileType()
+                stats.script = script.filename();
+                if (owner) {
+                    std::ostringstream label;
+                    label << owner->name() << " 0x" << std::hex << std::uppercase << owner->PID();
+                    stats.owner = label.str();
+                }
+            }
+            stats.calls++;
+            bool recursive = std::any_of(_frames.begin(), _frames.end(), [&stats](const Frame& frame) {
+                return frame.stats == &stats;
+            });
+            _frames.push_back(Frame{&stats, Clock::now(), Clock::duration::zero(), recursive});
+        }
+
+        void Profiler::_leave()
+        {
+            if (_frames.empty()) {
+                return;
+            }
+            auto frame = _frames.back();
+            _frames.pop_back();
+
+            auto elapsed = Clock::now() - frame.start;
+            // time of a procedure re-entered through another script is already counted by the outer frame
+            if (!frame.recursive) {
+                frame.stats->inclusive += elapsed;
+            }
+            frame.stats->exclusive += elapsed - frame.children;
+            if (!_frames.empty()) {
+                _frames.back().children += elapsed;
+            }
+        }
+
+        void Profiler::_countOpcode(unsigned short opcode)
+        {
+            _frames.back().stats->opcodes[opcode]++;
+        }
+
+        bool Profiler::writeReport(const std::string& filename)
+        {
+            std::ofstream stream(filename);
+            if (!stream) {
+                return false;
+            }
+
+            std::vector<std::pair<const std::string*, const ProcedureStats*>> sorted;
+            for (auto& it : _procedures) {
+                sorted.emplace_back(&_procedureNames[it.first.procedure], &it.second);
+            }
+            std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second->exclusive > rhs.second->exclusive;
+            });
+
+            auto microseconds = [](Clock::duration duration) {
+                return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+            };
+
+            stream << "type,script,owner,procedure,opcode,count,inclusive_us,exclusive_us" << std::endl;
+            for (auto& item : sorted) {
+                auto& procedure = *item.first;
+                auto& stats = *item.second;
+                // object names may contain commas
+                stream << "procedure," << stats.script << ",\"" << stats.owner << "\"," << procedure << ",," << stats.calls << ","
+                       << microseconds(stats.inclusive) << "," << microseconds(stats.exclusive) << std::endl;
+
+                std::vector<std::pair<unsigned short, unsigned long long>> opcodes(stats.opcodes.begin(), stats.opcodes.end());
+                std::sort(opcodes.begin(), opcodes.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second > rhs.second;
+                });
+                for (auto& opcode : opcodes) {
+                    stream << "opcode," << stats.script << ",\"" << stats.owner << "\"," << procedure << ",0x"
+                           << std::hex << std::uppercase << opcode.first << std::dec << std::nouppercase << ","
+                           << opcode.second << ",," << std::endl;
+                }
+            }
+            return true;
+        }
+    }
+}
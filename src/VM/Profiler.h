@@ -0,0 +1,129 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <chrono>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Falltergeist
+{
+    namespace VM
+    {
+        class Script;
+
+        /**
+         * Opt-in profiler of script execution.
+         * Collects call counts, inclusive and exclusive wall time and executed opcodes per script procedure
+         * of every object running it.
+         * While disabled every hook is a single branch.
+         */
+        class Profiler final
+        {
+            public:
+                // Measures one procedure run for as long as it is alive
+                class Scope final
+                {
+                    public:
+                        Scope(Script& script, const std::string& procedure)
+                        {
+                            if (Profiler::enabled()) {
+                                Profiler::_enter(script, procedure);
+                                _active = true;
+                            }
+                        }
+
+                        ~Scope()
+                        {
+                            if (_active) {
+                                Profiler::_leave();
+                            }
+                        }
+
+                        Scope(const Scope&) = delete;
+                        Scope& operator=(const Scope&) = delete;
+
+                    private:
+                        bool _active = false;
+                };
+
+                static inline bool enabled()
+                {
+                    return _enabled;
+                }
+
+                static void setEnabled(bool value);
+
+                static inline void countOpcode(unsigned short opcode)
+                {
+                    if (_enabled && !_frames.empty()) {
+                        _countOpcode(opcode);
+                    }
+                }
+
+                static void reset();
+
+                // Writes collected statistics as CSV, procedures sorted by exclusive time
+                static bool writeReport(const std::string& filename);
+
+            private:
+                using Clock = std::chrono::steady_clock;
+
+                // Rows belong to the object running the script, or to the script itself if it has no owner
+                struct Key
+                {
+                    const void* owner;
+                    unsigned procedure;
+
+                    bool operator==(const Key& other) const
+                    {
+                        return owner == other.owner && procedure == other.procedure;
+                    }
+                };
+
+                struct KeyHash
+                {
+                    size_t operator()(const Key& key) const
+                    {
+                        return std::hash<const void*>()(key.owner) ^ (std::hash<unsigned>()(key.procedure) << 1);
+                    }
+                };
+
+                struct ProcedureStats
+                {
+                    // captured on the first call, the owner may be gone when the report is written
+                    std::string script;
+                    std::string owner;
+                    unsigned long long calls = 0;
+                    Clock::duration inclusive = Clock::duration::zero();
+                    Clock::duration exclusive = Clock::duration::zero();
+                    std::unordered_map<unsigned short, unsigned long long> opcodes;
+                };
+
+                struct Frame
+                {
+                    ProcedureStats* stats;
+                    Clock::time_point start;
+                    Clock::duration children;
+                    bool recursive;
+                };
+
+                static bool _enabled;
+                static std::unordered_map<Key, ProcedureStats, KeyHash> _procedures;
+                // procedure names are interned, rows keep their index only
+                static std::unordered_map<std::string, unsigned> _procedureIds;
+                static std::vector<std::string> _procedureNames;
+                static std::vector<Frame> _frames;
+
+                static unsigned _procedureId(const std::string& procedure);
+                static void _enter(Script& script, const std::string& procedure);
+                static void _leave();
+                static void _countOpcode(unsigned short opcode);
+        };
+    }
+}
@@ -2,7 +2,6 @@
 #include "../Exception.h"
 #include "../Format/Int/File.h"
 #include "../Format/Int/Procedure.h"
-#include "../Format/Lst/File.h"
 #include "../Format/Msg/File.h"
 #include "../Format/Msg/Message.h"
 #include "../Game/Game.h"
@@ -12,6 +11,7 @@
 #include "../VM/ErrorException.h"
 #include "../VM/HaltException.h"
 #include "../VM/OpcodeFactory.h"
+#include "../VM/Profiler.h"
 #include "../VM/Script.h"
 #include "../VM/StackValue.h"
 
@@ -27,7 +27,7 @@ namespace Falltergeist
     namespace VM
     {
         Script::Script(
-            std::unique_ptr<Format::Int::File> intFile,
+            std::shared_ptr<Format::Int::File> intFile,
             Game::Object *owner
         ) : _owner(owner), _intFile(std::move(intFile)) {
         }
@@ -50,13 +50,14 @@ namespace Falltergeist
                 return;
             }
 
+            Profiler::Scope profilerScope(*this, name);
             _programCounter = procedure->bodyOffset();
             _dataStack.push(0); // arguments counter;
             _returnStack.push(0); // return address
-            Logger::debug("SCRIPT") << "CALLED: " << name << " [" << _intFile->filename() << "]" << std::endl;
+            FALLTERGEIST_LOG_DEBUG_STATIC("SCRIPT") << "CALLED: " << name << " [" << _intFile->filename() << "]" << std::endl;
             run();
             _dataStack.popInteger(); // remove function result
-            Logger::debug("SCRIPT") << "Function ended" << std::endl;
+            FALLTERGEIST_LOG_DEBUG_STATIC("SCRIPT") << "Function ended" << std::endl;
 
             // reset special script arguments
             _sourceObject = _targetObject = nullptr;
@@ -68,6 +69,9 @@ namespace Falltergeist
             if (_initialized) {
                 return;
             }
+            // kept static so no string is built per script when profiling is disabled
+            static const std::string startProcedure = "@start";
+            Profiler::Scope profilerScope(*this, startProcedure);
             _programCounter = 0;
             run();
             _dataStack.popInteger(); // remove @start function result
@@ -80,8 +84,9 @@ namespace Falltergeist
                     return;
                 }
                 auto offset = _programCounter;
-                _intFile->setPosition(_programCounter);
-                unsigned short opcode = _intFile->readOpcode();
+                _position = _programCounter;
+                unsigned short opcode = readOpcode();
+                Profiler::countOpcode(opcode);
 
                 std::unique_ptr<OpcodeHandler> opcodeHandler(OpcodeFactory::createOpcode(opcode));
                 try {
@@ -100,12 +105,9 @@ namespace Falltergeist
 
         std::string Script::msgMessage(int msg_file_num, int msg_num)
         {
-            auto lst = ResourceManager::getInstance()->lstFileType("scripts/scripts.lst");
-            auto scriptName = lst->strings()->at(msg_file_num - 1);
-            auto msg = ResourceManager::getInstance()->msgFileType(
-                    "text/english/dialog/" + scriptName.substr(0, scriptName.find(".int")).append(".msg"));
+            auto msg = ResourceManager::getInstance()->dialogMsgFileType(msg_file_num - 1);
             if (!msg) {
-                Logger::debug("SCRIPT")
+                FALLTERGEIST_LOG_DEBUG_STATIC("SCRIPT")
                         << "Script::msgMessage(file, num) not found. file: " + std::to_string(msg_file_num) + " num: " +
                            std::to_string(msg_num) << std::endl;
                 return "";
@@ -115,12 +117,9 @@ namespace Falltergeist
 
         std::string Script::msgSpeech(int msg_file_num, int msg_num)
         {
-            auto lst = ResourceManager::getInstance()->lstFileType("scripts/scripts.lst");
-            auto scriptName = lst->strings()->at(msg_file_num - 1);
-            auto msg = ResourceManager::getInstance()->msgFileType(
-                    "text/english/dialog/" + scriptName.substr(0, scriptName.find(".int")).append(".msg"));
+            auto msg = ResourceManager::getInstance()->dialogMsgFileType(msg_file_num - 1);
             if (!msg) {
-                Logger::debug("SCRIPT")
+                FALLTERGEIST_LOG_DEBUG_STATIC("SCRIPT")
                         << "Script::msgSpeech(file, num) not found. file: " + std::to_string(msg_file_num) + " num: " +
                            std::to_string(msg_num) << std::endl;
                 return "";
@@ -128,11 +127,25 @@ namespace Falltergeist
             return msg->message(msg_num)->sound();
         }
 
-        std::unique_ptr<Format::Int::File>& Script::intFile()
+        const std::shared_ptr<Format::Int::File>& Script::intFile() const
         {
             return _intFile;
         }
 
+        uint16_t Script::readOpcode()
+        {
+            auto opcode = _intFile->opcodeAt(_position);
+            _position += 2;
+            return opcode;
+        }
+
+        uint32_t Script::readValue()
+        {
+            auto value = _intFile->valueAt(_position);
+            _position += 4;
+            return value;
+        }
+
         unsigned int Script::programCounter()
         {
             return _programCounter;
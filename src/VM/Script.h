@@ -9,6 +9,7 @@
 // Third-party includes
 
 // stdlib
+#include <memory>
 #include <string>
 
 namespace Falltergeist
@@ -29,7 +30,7 @@ namespace Falltergeist
         class Script final
         {
             public:
-                Script(std::unique_ptr<Format::Int::File> intFile, Game::Object *owner);
+                Script(std::shared_ptr<Format::Int::File> intFile, Game::Object *owner);
 
                 ~Script() = default;
 
@@ -56,7 +57,11 @@ namespace Falltergeist
 
                 void call(const std::string &name);
 
-                std::unique_ptr<Format::Int::File>& intFile();
+                const std::shared_ptr<Format::Int::File>& intFile() const;
+
+                // read the next opcode or value of the program code
+                uint16_t readOpcode();
+                uint32_t readValue();
 
                 Game::Object *owner();
 
@@ -107,7 +112,11 @@ namespace Falltergeist
 
                 int _actionUsed = 0;
 
-                std::unique_ptr<Format::Int::File> _intFile;
+                // shared with every other script running the same program
+                std::shared_ptr<Format::Int::File> _intFile;
+
+                // read position in the program code
+                size_t _position = 0;
 
                 bool _initialized = false;
 
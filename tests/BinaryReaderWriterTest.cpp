@@ -0,0 +1,107 @@
+// Project includes
+#include "../src/Base/BinaryReader.h"
+#include "../src/Base/BinaryWriter.h"
+#include "../src/Exception.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace Falltergeist;
+
+namespace
+{
+    void testRoundTrip()
+    {
+        Base::BinaryWriter writer;
+        writer.write<uint8_t>(7);
+        writer.write<int32_t>(-123456);
+        writer.write<uint64_t>(0x0102030405060708ULL);
+        writer.write<double>(0.25);
+        writer.writeString("Arroyo");
+        writer.writeString("");
+        writer.writeArray(std::vector<int32_t>{1, -2, 3});
+        writer.writeArray(std::vector<uint16_t>{});
+
+        Base::BinaryReader reader(writer.data());
+        CHECK(reader.read<uint8_t>() == 7);
+        CHECK(reader.read<int32_t>() == -123456);
+        CHECK(reader.read<uint64_t>() == 0x0102030405060708ULL);
+        CHECK(reader.read<double>() == 0.25);
+        CHECK(reader.readString() == "Arroyo");
+        CHECK(reader.readString() == "");
+        std::vector<int32_t> values;
+        reader.readArray(values);
+        CHECK((values == std::vector<int32_t>{1, -2, 3}));
+        std::vector<uint16_t> empty{1};
+        reader.readArray(empty);
+        CHECK(empty.empty());
+        CHECK(reader.atEnd());
+        CHECK(reader.position() == writer.size());
+    }
+
+    void testWriteAt()
+    {
+        Base::BinaryWriter writer;
+        writer.write<uint32_t>(0);
+        writer.write<uint32_t>(2);
+        writer.writeAt<uint32_t>(0, 1);
+
+        Base::BinaryReader reader(writer.data());
+        CHECK(reader.read<uint32_t>() == 1);
+        CHECK(reader.read<uint32_t>() == 2);
+    }
+
+    void testReadBytes()
+    {
+        std::string data = "abcdef";
+        Base::BinaryReader reader(data);
+        auto bytes = reader.readBytes(4);
+        CHECK(bytes == "abcd");
+        // views point into the source, nothing is copied
+        CHECK(bytes.data() == data.data());
+        CHECK(reader.position() == 4);
+    }
+
+    void testTruncatedDataThrows()
+    {
+        Base::BinaryWriter writer;
+        writer.writeString("truncated");
+        writer.writeArray(std::vector<uint32_t>{1, 2, 3});
+        auto& data = writer.data();
+
+        for (size_t size = 0; size != data.size(); ++size) {
+            Base::BinaryReader reader(std::string_view(data).substr(0, size));
+            bool thrown = false;
+            try {
+                reader.readString();
+                std::vector<uint32_t> values;
+                reader.readArray(values);
+            } catch (const Exception&) {
+                thrown = true;
+            }
+            CHECK(thrown);
+        }
+
+        Base::BinaryReader reader("\x01\x02");
+        CHECK_THROWS(Exception, reader.read<uint32_t>());
+        // a huge length prefix must not be trusted
+        Base::BinaryWriter lying;
+        lying.write<uint32_t>(0xFFFFFFFF);
+        Base::BinaryReader lyingReader(lying.data());
+        CHECK_THROWS(Exception, lyingReader.readString());
+    }
+}
+
+int main()
+{
+    testRoundTrip();
+    testWriteAt();
+    testReadBytes();
+    testTruncatedDataThrows();
+    return Tests::result();
+}
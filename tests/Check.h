@@ -0,0 +1,51 @@
+#pragma once
+
+// Project includes
+
+// Third-party includes
+
+// stdlib
+#include <iostream>
+
+// Minimal assertions for the unit tests, every test program returns non-zero when any check failed
+namespace Falltergeist
+{
+    namespace Tests
+    {
+        inline int& failures()
+        {
+            static int failures = 0;
+            return failures;
+        }
+
+        inline void check(bool passed, const char* expression, const char* file, int line)
+        {
+            if (!passed) {
+                std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+                failures()++;
+            }
+        }
+
+        inline int result()
+        {
+            if (failures() != 0) {
+                std::cerr << failures() << " check(s) failed" << std::endl;
+                return 1;
+            }
+            return 0;
+        }
+    }
+}
+
+#define CHECK(expression) ::Falltergeist::Tests::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#define CHECK_THROWS(ExceptionType, expression) \
+    do { \
+        bool thrown = false; \
+        try { \
+            (void) (expression); \
+        } catch (const ExceptionType&) { \
+            thrown = true; \
+        } \
+        ::Falltergeist::Tests::check(thrown, #expression " throws " #ExceptionType, __FILE__, __LINE__); \
+    } while (false)
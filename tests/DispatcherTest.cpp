@@ -0,0 +1,154 @@
+// Project includes
+#include "../src/Event/Dispatcher.h"
+#include "../src/Event/EventTarget.h"
+#include "../src/Event/Keyboard.h"
+#include "../src/Event/Mouse.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdlib>
+#include <new>
+
+using namespace Falltergeist;
+
+namespace
+{
+    size_t allocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    using Mouse = Event::Mouse;
+    using Keyboard = Event::Keyboard;
+
+    void testAssignmentReusesEvent()
+    {
+        Mouse event(Mouse::Type::MOVE);
+        event.stopPropagation();
+
+        Mouse down(Mouse::Type::BUTTON_DOWN);
+        down.setButton(Mouse::Button::RIGHT);
+        down.setPosition({12, 34});
+        down.setShiftPressed(true);
+        event = down;
+        CHECK(event.name() == "mousedown");
+        CHECK(event.originalType() == Mouse::Type::BUTTON_DOWN);
+        CHECK(event.rightButton());
+        CHECK(event.position() == Graphics::Point(12, 34));
+        CHECK(event.shiftPressed());
+        CHECK(!event.controlPressed());
+        CHECK(!event.isHandled());
+
+        Keyboard key(Keyboard::Type::KEY_DOWN);
+        key.stopPropagation();
+        Keyboard up(Keyboard::Type::KEY_UP);
+        up.setKeyCode(42);
+        up.setAltPressed(true);
+        key = up;
+        CHECK(key.name() == "keyup");
+        CHECK(key.originalType() == Keyboard::Type::KEY_UP);
+        CHECK(key.keyCode() == 42);
+        CHECK(key.altPressed());
+        CHECK(!key.isHandled());
+
+        Mouse copy(down);
+        CHECK(copy.originalType() == Mouse::Type::BUTTON_DOWN);
+    }
+
+    void testHandlersRunInOrder()
+    {
+        Event::Dispatcher dispatcher;
+        Event::EventTarget target(&dispatcher);
+        int calls = 0;
+        Event::MouseHandler handler;
+        handler.add([&calls](Mouse* event) {
+            ++calls;
+            event->stopPropagation();
+        });
+        handler.add([&calls](Mouse*) {
+            calls += 100;
+        });
+
+        target.emitEvent(Mouse(Mouse::Type::MOVE), handler);
+        CHECK(calls == 0);
+        dispatcher.processScheduledEvents();
+        CHECK(calls == 1);
+    }
+
+    void testBlockedTarget()
+    {
+        Event::Dispatcher dispatcher;
+        int calls = 0;
+        Event::MouseHandler handler([&calls](Mouse*) { ++calls; });
+        {
+            Event::EventTarget target(&dispatcher);
+            target.emitEvent(Mouse(Mouse::Type::MOVE), handler);
+        }
+        dispatcher.processScheduledEvents();
+        CHECK(calls == 0);
+    }
+
+    // The way Game feeds OS input: one reused event per kind, emitted to a few targets each frame
+    void testSteadyStateDoesNotAllocate()
+    {
+        Event::Dispatcher dispatcher;
+        Event::EventTarget first(&dispatcher), second(&dispatcher);
+        Mouse mouseEvent(Mouse::Type::MOVE);
+        Keyboard keyboardEvent(Keyboard::Type::KEY_DOWN);
+        int sum = 0;
+        Event::MouseHandler mouseHandler([&sum](Mouse* event) { sum += event->position().x(); });
+        Event::KeyboardHandler keyboardHandler([&sum](Keyboard* event) { sum += event->keyCode(); });
+
+        auto frame = [&](int i) {
+            mouseEvent = Mouse(i % 3 ? Mouse::Type::MOVE : Mouse::Type::BUTTON_DOWN);
+            mouseEvent.setPosition({i % 640, i % 480});
+            first.emitEvent(mouseEvent, mouseHandler);
+            second.emitEvent(mouseEvent, mouseHandler);
+            keyboardEvent = Keyboard(i % 2 ? Keyboard::Type::KEY_UP : Keyboard::Type::KEY_DOWN);
+            keyboardEvent.setKeyCode(i % 128);
+            first.emitEvent(keyboardEvent, keyboardHandler);
+            dispatcher.processScheduledEvents();
+        };
+
+        for (int i = 0; i != 100; ++i) {
+            frame(i);
+        }
+
+        const size_t warm = allocations;
+        for (int i = 0; i != 200000; ++i) {
+            frame(i);
+        }
+        CHECK(allocations == warm);
+        CHECK(sum != 0);
+    }
+}
+
+int main()
+{
+    testAssignmentReusesEvent();
+    testHandlersRunInOrder();
+    testBlockedTarget();
+    testSteadyStateDoesNotAllocate();
+    return Tests::result();
+}
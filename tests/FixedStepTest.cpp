@@ -0,0 +1,117 @@
+// Project includes
+#include "../src/Game/FixedStep.h"
+#include "../src/Game/FrameClock.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+
+using namespace Falltergeist;
+using Game::FixedStep;
+
+namespace
+{
+    class FakeClock final : public Game::FrameClock
+    {
+        public:
+            double time = 0;
+
+            double now() override
+            {
+                return time;
+            }
+
+            void sleep(double milliseconds) override
+            {
+                time += milliseconds;
+            }
+    };
+
+    void testFirstFrameRunsOneStep()
+    {
+        FakeClock clock;
+        clock.time = 500;
+        FixedStep fixedStep(clock, 10, 5);
+        CHECK(fixedStep.beginFrame() == 1);
+        CHECK(fixedStep.frameStart() == 500);
+        CHECK(fixedStep.frameTime() == 0);
+    }
+
+    void testStepCounts()
+    {
+        FakeClock clock;
+        FixedStep fixedStep(clock, 10, 5);
+        fixedStep.beginFrame();
+
+        clock.time += 10;
+        CHECK(fixedStep.beginFrame() == 1);
+        CHECK(fixedStep.frameTime() == 10);
+
+        clock.time += 25;
+        CHECK(fixedStep.beginFrame() == 2);
+
+        // 5 ms carried over from the previous frame
+        clock.time += 5;
+        CHECK(fixedStep.beginFrame() == 1);
+
+        clock.time += 4;
+        CHECK(fixedStep.beginFrame() == 0);
+        clock.time += 6;
+        CHECK(fixedStep.beginFrame() == 1);
+    }
+
+    void testFastFramesAddUp()
+    {
+        FakeClock clock;
+        FixedStep fixedStep(clock, 10, 5);
+        fixedStep.beginFrame();
+
+        unsigned int steps = 0;
+        for (int i = 0; i != 100; ++i) {
+            clock.time += 2.5;
+            steps += fixedStep.beginFrame();
+        }
+        CHECK(steps == 25);
+    }
+
+    void testClampAfterStall()
+    {
+        FakeClock clock;
+        FixedStep fixedStep(clock, 10, 5);
+        fixedStep.beginFrame();
+
+        clock.time += 1000;
+        CHECK(fixedStep.beginFrame() == 5);
+        CHECK(fixedStep.frameTime() == 1000);
+
+        // at most one step is left from the stall, it isn't caught up later
+        CHECK(fixedStep.beginFrame() == 1);
+        CHECK(fixedStep.beginFrame() == 0);
+
+        clock.time += 10;
+        CHECK(fixedStep.beginFrame() == 1);
+    }
+
+    void testNoClampWithinLimit()
+    {
+        FakeClock clock;
+        FixedStep fixedStep(clock, 10, 5);
+        fixedStep.beginFrame();
+
+        clock.time += 45;
+        CHECK(fixedStep.beginFrame() == 4);
+        clock.time += 5;
+        CHECK(fixedStep.beginFrame() == 1);
+    }
+}
+
+int main()
+{
+    testFirstFrameRunsOneStep();
+    testStepCounts();
+    testFastFramesAddUp();
+    testClampAfterStall();
+    testNoClampWithinLimit();
+    return Tests::result();
+}
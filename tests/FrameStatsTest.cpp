@@ -0,0 +1,78 @@
+// Project includes
+#include "../src/Game/FrameStats.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+
+using namespace Falltergeist;
+using Game::FrameStats;
+using Phase = Game::FrameStats::Phase;
+
+namespace
+{
+    void testEmpty()
+    {
+        FrameStats stats(10);
+        CHECK(stats.size() == 0);
+        CHECK(stats.percentile(50) == 0);
+        CHECK(stats.percentile(Phase::RENDER, 99) == 0);
+    }
+
+    void testNearestRankPercentiles()
+    {
+        FrameStats stats(100);
+        // render takes 1..100 ms, frames added in reverse order
+        for (int i = 100; i != 0; --i) {
+            stats.add(Phase::RENDER, i);
+            stats.endFrame(1);
+        }
+        CHECK(stats.size() == 100);
+        CHECK(stats.percentile(Phase::RENDER, 50) == 50);
+        CHECK(stats.percentile(Phase::RENDER, 95) == 95);
+        CHECK(stats.percentile(Phase::RENDER, 99) == 99);
+        CHECK(stats.percentile(Phase::RENDER, 100) == 100);
+        CHECK(stats.percentile(Phase::RENDER, 0) == 1);
+        CHECK(stats.percentile(Phase::THINK, 99) == 0);
+    }
+
+    void testPhasesAddUp()
+    {
+        FrameStats stats(10);
+        stats.add(Phase::EVENTS, 1);
+        stats.add(Phase::THINK, 2);
+        stats.add(Phase::THINK, 3);
+        stats.add(Phase::RENDER, 4);
+        stats.add(Phase::SWAP, 5);
+        stats.endFrame(2);
+        CHECK(stats.percentile(Phase::THINK, 50) == 5);
+        CHECK(stats.percentile(50) == 15);
+
+        // the next frame starts empty
+        stats.endFrame(0);
+        CHECK(stats.percentile(0) == 0);
+    }
+
+    void testRingBufferKeepsLatestFrames()
+    {
+        FrameStats stats(4);
+        for (int i = 1; i <= 10; ++i) {
+            stats.add(Phase::RENDER, i);
+            stats.endFrame(1);
+        }
+        CHECK(stats.size() == 4);
+        // frames 7..10 are left
+        CHECK(stats.percentile(Phase::RENDER, 0) == 7);
+        CHECK(stats.percentile(Phase::RENDER, 100) == 10);
+    }
+}
+
+int main()
+{
+    testEmpty();
+    testNearestRankPercentiles();
+    testPhasesAddUp();
+    testRingBufferKeepsLatestFrames();
+    return Tests::result();
+}
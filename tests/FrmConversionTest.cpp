@@ -0,0 +1,220 @@
+// Project includes
+#include "../src/Format/Dat/Stream.h"
+#include "../src/Format/Frm/Direction.h"
+#include "../src/Format/Frm/File.h"
+#include "../src/Format/Frm/Frame.h"
+#include "../src/Format/Pal/Color.h"
+#include "../src/Format/Pal/File.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Falltergeist;
+
+namespace
+{
+    const std::string PAL_PATH = "FrmConversionTest.pal";
+    const std::string FRM_PATH = "FrmConversionTest.frm";
+
+    // FRM and PAL files are big-endian
+    void appendBig(std::string& data, uint32_t value, size_t bytes)
+    {
+        for (size_t i = bytes; i != 0; --i) {
+            data.push_back(static_cast<char>((value >> (8 * (i - 1))) & 0xff));
+        }
+    }
+
+    void writeFile(const std::string& path, const std::string& data)
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(data.data(), data.size());
+    }
+
+    std::unique_ptr<Format::Dat::Stream> readFile(const std::string& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::make_unique<Format::Dat::Stream>(stream);
+    }
+
+    std::unique_ptr<Format::Pal::File> palette()
+    {
+        std::string data(3, '\0');
+        for (unsigned i = 1; i != 256; ++i) {
+            data.push_back(static_cast<char>(i % 64));
+            data.push_back(static_cast<char>((i * 7) % 64));
+            data.push_back(static_cast<char>((i * 13) % 64));
+        }
+        writeFile(PAL_PATH, data);
+        return std::make_unique<Format::Pal::File>(std::move(*readFile(PAL_PATH)));
+    }
+
+    // Frame sizes of one direction, all directions share them.
+    // If unique is false, all six directions point to the same data, like a static image.
+    std::unique_ptr<Format::Frm::File> frm(const std::vector<std::pair<uint16_t, uint16_t>>& frames, bool unique)
+    {
+        std::string directionData;
+        for (auto& frame : frames) {
+            appendBig(directionData, frame.first, 2);
+            appendBig(directionData, frame.second, 2);
+            appendBig(directionData, static_cast<uint32_t>(frame.first) * frame.second, 4);
+            appendBig(directionData, 0, 2);
+            appendBig(directionData, 0, 2);
+            // every palette index, shifted per frame and row, so neighbors differ
+            for (uint32_t y = 0; y != frame.second; ++y) {
+                for (uint32_t x = 0; x != frame.first; ++x) {
+                    directionData.push_back(static_cast<char>((x + y * 3 + directionData.size()) % 256));
+                }
+            }
+        }
+
+        std::string data;
+        appendBig(data, 4, 4);
+        appendBig(data, 10, 2);
+        appendBig(data, 0, 2);
+        appendBig(data, static_cast<uint32_t>(frames.size()), 2);
+        for (unsigned i = 0; i != 12; ++i) {
+            appendBig(data, 0, 2);
+        }
+        for (unsigned i = 0; i != 6; ++i) {
+            appendBig(data, unique ? static_cast<uint32_t>(i * directionData.size()) : 0, 4);
+        }
+        appendBig(data, static_cast<uint32_t>(directionData.size() * (unique ? 6 : 1)), 4);
+        for (unsigned i = 0; i != (unique ? 6 : 1); ++i) {
+            // directions differ by their first index
+            std::string direction = directionData;
+            direction[12] = static_cast<char>(i * 40);
+            data.append(direction);
+        }
+        writeFile(FRM_PATH, data);
+        return std::make_unique<Format::Frm::File>(std::move(*readFile(FRM_PATH)));
+    }
+
+    // The per-pixel conversion that was used before Pal::File::expand()
+    void scalarConvert(const Format::Frm::File& file, Format::Pal::File* pal, std::vector<uint32_t>& rgba, std::vector<bool>& mask)
+    {
+        size_t w = file.width();
+        rgba.assign(w * file.height(), 0);
+        mask.assign(w * file.height(), true);
+        size_t positionY = 0;
+        for (auto& direction : file.directions()) {
+            size_t positionX = 0;
+            for (auto& frame : direction.frames()) {
+                for (uint16_t y = 0; y != frame.height(); ++y) {
+                    for (uint16_t x = 0; x != frame.width(); ++x) {
+                        auto color = pal->color(frame.index(x, y));
+                        rgba[(y + positionY) * w + x + positionX] = *color;
+                        mask[(y + positionY) * w + x + positionX] = color->alpha() > 0;
+                    }
+                }
+                positionX += frame.width();
+            }
+            positionY += direction.height();
+        }
+    }
+
+    bool sameAsScalar(Format::Frm::File& file, Format::Pal::File* pal)
+    {
+        std::vector<uint32_t> rgba;
+        std::vector<bool> mask;
+        scalarConvert(file, pal, rgba, mask);
+        size_t size = static_cast<size_t>(file.width()) * file.height();
+        return rgba.size() == size
+            && std::memcmp(file.rgba(pal), rgba.data(), size * sizeof(uint32_t)) == 0
+            && file.mask(pal) == mask;
+    }
+
+    void testAllPaletteIndexes()
+    {
+        auto pal = palette();
+        std::vector<uint32_t> table(256);
+        std::vector<bool> mask(256);
+        std::vector<uint8_t> indexes(256);
+        for (unsigned i = 0; i != 256; ++i) {
+            indexes[i] = static_cast<uint8_t>(i);
+        }
+        pal->expand(indexes.data(), indexes.size(), table.data(), mask.begin());
+        bool same = true;
+        for (unsigned i = 0; i != 256; ++i) {
+            same = same && table[i] == static_cast<unsigned int>(*pal->color(i)) && mask[i] == (pal->color(i)->alpha() > 0);
+        }
+        CHECK(same);
+        // index 0 is transparent, animated colors are not
+        CHECK(!mask[0]);
+        CHECK(mask[229]);
+    }
+
+    void testSingleDirection()
+    {
+        auto pal = palette();
+        auto file = frm({{1, 1}, {7, 3}, {13, 5}, {3, 9}}, false);
+        CHECK(file->directions().size() == 1);
+        CHECK(sameAsScalar(*file, pal.get()));
+    }
+
+    void testOddWidths()
+    {
+        auto pal = palette();
+        for (uint16_t width = 1; width != 40; width += 3) {
+            auto file = frm({{width, 3}, {static_cast<uint16_t>(width + 2), 1}}, true);
+            CHECK(sameAsScalar(*file, pal.get()));
+        }
+    }
+
+    void testParallelConversion()
+    {
+        auto pal = palette();
+        // six directions of about 60K pixels each take the threaded path
+        auto file = frm({{101, 231}, {77, 180}, {33, 231}}, true);
+        CHECK(file->directions().size() == 6);
+        CHECK(static_cast<size_t>(file->width()) * file->height() >= 256 * 1024);
+        CHECK(sameAsScalar(*file, pal.get()));
+    }
+
+    void benchmark()
+    {
+        auto pal = palette();
+        const int runs = 20;
+        double scalar = 0;
+        double converted = 0;
+        for (int i = 0; i != runs; ++i) {
+            auto file = frm({{101, 231}, {77, 180}, {33, 231}}, true);
+            std::vector<uint32_t> rgba;
+            std::vector<bool> mask;
+            auto start = std::chrono::steady_clock::now();
+            scalarConvert(*file, pal.get(), rgba, mask);
+            auto middle = std::chrono::steady_clock::now();
+            file->rgba(pal.get());
+            auto end = std::chrono::steady_clock::now();
+            scalar += std::chrono::duration<double, std::milli>(middle - start).count();
+            converted += std::chrono::duration<double, std::milli>(end - middle).count();
+        }
+        std::cout << "FRM conversion of " << 6 * 3 << " frames, average of " << runs << " runs: "
+                  << "per pixel " << scalar / runs << " ms, expand() " << converted / runs << " ms" << std::endl;
+    }
+}
+
+// Pass --benchmark to time the conversion against the per-pixel one
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--benchmark") {
+        benchmark();
+    } else {
+        testAllPaletteIndexes();
+        testSingleDirection();
+        testOddWidths();
+        testParallelConversion();
+    }
+    std::remove(PAL_PATH.c_str());
+    std::remove(FRM_PATH.c_str());
+    return Tests::result();
+}
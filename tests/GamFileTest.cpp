@@ -0,0 +1,134 @@
+// Project includes
+#include "../src/Exception.h"
+#include "../src/Format/Dat/Stream.h"
+#include "../src/Format/Gam/File.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+
+using namespace Falltergeist;
+
+namespace
+{
+    const std::string GAM_PATH = "GamFileTest.gam";
+
+    std::unique_ptr<Format::Gam::File> parse(const std::string& data)
+    {
+        std::ofstream(GAM_PATH, std::ios::binary | std::ios::trunc).write(data.data(), data.size());
+        std::ifstream stream(GAM_PATH, std::ios::binary);
+        return std::make_unique<Format::Gam::File>(Format::Dat::Stream(stream));
+    }
+
+    void testFileOrder()
+    {
+        auto file = parse(
+            "// Fallout 2 global variables\r\n"
+            "GAME_GLOBAL_VARS:\r\n"
+            "GVAR_PLAYER_REPUTATION      :=0;    //  (0)\r\n"
+            "GVAR_CHILDKILLER            :=0;    //  (1)\r\n"
+            "GVAR_BAD_MONSTER            :=7;    //  (2)\r\n"
+            "\r\n"
+            "GVAR_ARROYO_GOOD            := -3;\n"
+        );
+        // alphabetical order would put GVAR_ARROYO_GOOD first
+        CHECK(file->GVARS().size() == 4);
+        CHECK(file->GVAR(2u) == 7);
+        CHECK(file->GVAR(3u) == -3);
+        CHECK(file->GVARnumber("GVAR_BAD_MONSTER") == 2);
+        CHECK(file->GVARnumber("GVAR_ARROYO_GOOD") == 3);
+        CHECK(file->GVAR("GVAR_ARROYO_GOOD") == -3);
+        CHECK(file->MVARS().empty());
+        CHECK_THROWS(Exception, file->GVAR(4u));
+        CHECK_THROWS(Exception, file->GVARnumber("GVAR_UNKNOWN"));
+    }
+
+    void testMapVars()
+    {
+        auto file = parse(
+            "MAP_GLOBAL_VARS:\n"
+            "MVAR_Zeta  := 1;\n"
+            "MVAR_Alpha := 2; // comment\n"
+        );
+        CHECK(file->MVARS().size() == 2);
+        CHECK(file->MVAR(0u) == 1);
+        CHECK(file->MVAR(1u) == 2);
+        CHECK(file->MVARnumber("MVAR_Alpha") == 1);
+        CHECK(file->MVAR("MVAR_Zeta") == 1);
+        CHECK_THROWS(Exception, file->MVAR(2u));
+    }
+
+    void testInvalidLine()
+    {
+        CHECK_THROWS(Exception, parse("GAME_GLOBAL_VARS:\nGVAR_BROKEN 1;\n"));
+        CHECK_THROWS(Exception, parse("GVAR_NO_MODE := 1;\n"));
+    }
+
+    // As many variables as vault13.gam declares
+    std::string bigGam()
+    {
+        std::string data = "GAME_GLOBAL_VARS:\r\n";
+        for (unsigned i = 0; i != 700; ++i) {
+            data += "GVAR_" + std::to_string((i * 7919) % 700) + "_" + std::to_string(i) + " := " + std::to_string(i) + ";\r\n";
+        }
+        return data;
+    }
+
+    // The way GVAR(number) was looked up before: a walk over variables sorted by name
+    int mapGVAR(const std::map<std::string, int>& GVARS, unsigned int number)
+    {
+        unsigned int i = 0;
+        for (auto gvar : GVARS) {
+            if (i == number) {
+                return gvar.second;
+            }
+            i++;
+        }
+        throw Exception("mapGVAR() - not found: " + std::to_string(number));
+    }
+
+    void benchmark()
+    {
+        auto file = parse(bigGam());
+        std::map<std::string, int> GVARS;
+        for (unsigned i = 0; i != file->GVARS().size(); ++i) {
+            GVARS.emplace("GVAR_" + std::to_string((i * 7919) % 700) + "_" + std::to_string(i), file->GVAR(i));
+        }
+
+        const unsigned lookups = 100000;
+        long long sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i != lookups; ++i) {
+            sum += mapGVAR(GVARS, (i * 31) % 700);
+        }
+        auto middle = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i != lookups; ++i) {
+            sum += file->GVAR((i * 31) % 700);
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::cout << lookups << " GVAR(number) lookups over 700 variables: "
+                  << "map walk " << std::chrono::duration<double, std::milli>(middle - start).count() << " ms, "
+                  << "index " << std::chrono::duration<double, std::milli>(end - middle).count() << " ms"
+                  << " (checksum " << sum << ")" << std::endl;
+    }
+}
+
+// Pass --benchmark to time GVAR(number) against the old map walk
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--benchmark") {
+        benchmark();
+    } else {
+        testFileOrder();
+        testMapVars();
+        testInvalidLine();
+    }
+    return Tests::result();
+}
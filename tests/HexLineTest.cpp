@@ -0,0 +1,112 @@
+// Project includes
+#include "../src/PathFinding/HexLine.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace Falltergeist;
+
+namespace
+{
+    using Hexes = std::vector<std::pair<int, int>>;
+
+    Hexes walk(int fromX, int fromZ, int toX, int toZ)
+    {
+        Hexes hexes;
+        HexLine::walk(fromX, fromZ, toX, toZ, [&hexes](int x, int z) {
+            hexes.emplace_back(x, z);
+            return true;
+        });
+        return hexes;
+    }
+
+    void testDistance()
+    {
+        CHECK(HexLine::distance(0, 0, 0, 0) == 0);
+        CHECK(HexLine::distance(0, 0, 3, 0) == 3);
+        CHECK(HexLine::distance(0, 0, 0, -4) == 4);
+        CHECK(HexLine::distance(0, 0, 2, -2) == 2);
+        CHECK(HexLine::distance(1, 1, -2, 4) == 3);
+        CHECK(HexLine::distance(0, 0, 2, 3) == 5);
+    }
+
+    void testNeighboursSeeEachOther()
+    {
+        CHECK(walk(5, 5, 5, 5).empty());
+        CHECK(walk(5, 5, 6, 5).empty());
+        CHECK(walk(5, 5, 5, 4).empty());
+    }
+
+    void testStraightLines()
+    {
+        CHECK((walk(0, 0, 3, 0) == Hexes{{1, 0}, {2, 0}}));
+        CHECK((walk(0, 0, 0, 3) == Hexes{{0, 1}, {0, 2}}));
+        CHECK((walk(0, 0, 3, -3) == Hexes{{1, -1}, {2, -2}}));
+    }
+
+    void testLineIsConnected()
+    {
+        std::mt19937 random(7);
+        std::uniform_int_distribution<int> coordinate(-30, 30);
+        for (int i = 0; i != 1000; ++i) {
+            int fromX = coordinate(random), fromZ = coordinate(random);
+            int toX = coordinate(random), toZ = coordinate(random);
+            auto hexes = walk(fromX, fromZ, toX, toZ);
+            auto steps = HexLine::distance(fromX, fromZ, toX, toZ);
+            CHECK(hexes.size() == (steps > 0 ? steps - 1 : 0));
+
+            // every hex is one step further from the start and one step closer to the end
+            int previousX = fromX, previousZ = fromZ;
+            for (size_t j = 0; j != hexes.size(); ++j) {
+                CHECK(HexLine::distance(previousX, previousZ, hexes[j].first, hexes[j].second) == 1);
+                CHECK(HexLine::distance(fromX, fromZ, hexes[j].first, hexes[j].second) == j + 1);
+                previousX = hexes[j].first;
+                previousZ = hexes[j].second;
+            }
+            if (!hexes.empty()) {
+                CHECK(HexLine::distance(previousX, previousZ, toX, toZ) == 1);
+            }
+        }
+    }
+
+    void testBlockerStopsWalk()
+    {
+        std::set<std::pair<int, int>> blocked{{2, 0}};
+        auto visible = [&blocked](int fromX, int fromZ, int toX, int toZ) {
+            return HexLine::walk(fromX, fromZ, toX, toZ, [&blocked](int x, int z) {
+                return blocked.count(std::make_pair(x, z)) == 0;
+            });
+        };
+        CHECK(!visible(0, 0, 4, 0));
+        CHECK(!visible(4, 0, 0, 0));
+        // blocked endpoints don't matter
+        CHECK(visible(0, 0, 2, 0));
+        CHECK(visible(2, 0, 3, 0));
+        // lines passing beside the blocker
+        CHECK(visible(0, 1, 4, 1));
+        CHECK(visible(0, -1, 4, -1));
+
+        int visited = 0;
+        HexLine::walk(0, 0, 6, 0, [&visited](int x, int) {
+            visited++;
+            return x < 2;
+        });
+        CHECK(visited == 2);
+    }
+}
+
+int main()
+{
+    testDistance();
+    testNeighboursSeeEachOther();
+    testStraightLines();
+    testLineIsConnected();
+    testBlockerStopsWalk();
+    return Tests::result();
+}
@@ -0,0 +1,178 @@
+// Project includes
+#include "../src/Exception.h"
+#include "../src/Format/Dat/Stream.h"
+#include "../src/Format/Msg/File.h"
+#include "../src/Format/Msg/Message.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Falltergeist;
+
+namespace
+{
+    const std::string MSG_PATH = "MsgFileTest.msg";
+
+    struct Parsed
+    {
+        unsigned int number;
+        std::string sound;
+        std::string text;
+    };
+
+    std::unique_ptr<Format::Dat::Stream> stream(const std::string& data)
+    {
+        std::ofstream(MSG_PATH, std::ios::binary | std::ios::trunc).write(data.data(), data.size());
+        std::ifstream file(MSG_PATH, std::ios::binary);
+        return std::make_unique<Format::Dat::Stream>(file);
+    }
+
+    // The byte by byte parser Msg::File used before it scanned the buffer
+    std::vector<Parsed> referenceParse(Format::Dat::Stream& stream)
+    {
+        std::vector<Parsed> messages;
+        stream.setPosition(0);
+        while (stream.position() < stream.size()) {
+            uint8_t chr = stream.uint8();
+            if (chr != '{') {
+                continue;
+            }
+            std::string number, sound, text;
+            chr = 0;
+            while (chr != '{') {
+                chr = stream.uint8();
+                if (chr != '{' && chr != '}') {
+                    number += chr;
+                }
+            }
+            chr = 0;
+            while (chr != '{') {
+                chr = stream.uint8();
+                if (chr != '{' && chr != '}') {
+                    sound += chr;
+                }
+            }
+            chr = 0;
+            while (chr != '}' && chr != '{' && stream.position() < stream.size()) {
+                chr = stream.uint8();
+                if (chr != '{' && chr != '}') {
+                    text += chr;
+                }
+            }
+            stream.setPosition(stream.position() - 1);
+            while (text.find("\n") != std::string::npos) {
+                text.replace(text.find("\n"), 1, "");
+            }
+            while (text.find("\r") != std::string::npos) {
+                text.replace(text.find("\r"), 1, "");
+            }
+            messages.push_back({static_cast<unsigned int>(std::stoi(number)), sound, text});
+        }
+        return messages;
+    }
+
+    std::unique_ptr<Format::Msg::File> parse(const std::string& data)
+    {
+        return std::make_unique<Format::Msg::File>(std::move(*stream(data)));
+    }
+
+    void checkSameAsReference(const std::string& data)
+    {
+        auto file = parse(data);
+        auto expected = referenceParse(*stream(data));
+        CHECK(!expected.empty());
+        for (auto& message : expected) {
+            auto parsed = file->message(message.number);
+            CHECK(parsed->sound() == message.sound);
+            CHECK(parsed->text() == message.text);
+        }
+    }
+
+    void testPlainMessages()
+    {
+        std::string data = "# comment outside of braces\r\n{100}{}{Hello}\r\n{101}{snd01}{Two\r\nlines}\r\n{ 102 }{}{Unix\nline}\n";
+        checkSameAsReference(data);
+        auto file = parse(data);
+        CHECK(file->message(101)->sound() == "snd01");
+        CHECK(file->message(101)->text() == "Twolines");
+        CHECK(file->message(102)->text() == "Unixline");
+        CHECK_THROWS(Exception, file->message(103));
+    }
+
+    // CMBATAI2.MSG has several messages on one line and stray closing braces
+    void testBrokenBraces()
+    {
+        std::string data = "{1382}{}{First}{1383}{}{Second}}\r\n{32020}}{}{Third}}}\r\n{32021}{}{No closing brace";
+        checkSameAsReference(data);
+        auto file = parse(data);
+        CHECK(file->message(1383)->text() == "Second");
+        CHECK(file->message(32020)->text() == "Third");
+        CHECK(file->message(32021)->text() == "No closing brace");
+    }
+
+    void testFirstDuplicateWins()
+    {
+        auto file = parse("{5}{}{first}\n{5}{}{second}\n");
+        CHECK(file->message(5)->text() == "first");
+    }
+
+    // Size of the biggest dialog files of the game
+    std::string bigMsg()
+    {
+        std::string data;
+        for (unsigned i = 0; i != 4000; ++i) {
+            data += "{" + std::to_string(100 + i) + "}{" + (i % 5 ? "" : "snd" + std::to_string(i)) + "}"
+                    "{You see a man in a leather jacket, he looks at you with\r\nsome suspicion. #" + std::to_string(i) + "}\r\n";
+        }
+        return data;
+    }
+
+    void testBigFile()
+    {
+        checkSameAsReference(bigMsg());
+    }
+
+    void benchmark()
+    {
+        std::string data = bigMsg();
+        const int runs = 50;
+        double reference = 0, scanned = 0;
+        for (int i = 0; i != runs; ++i) {
+            // file reading is not timed
+            auto referenceStream = stream(data);
+            auto scannedStream = stream(data);
+            auto start = std::chrono::steady_clock::now();
+            referenceParse(*referenceStream);
+            auto middle = std::chrono::steady_clock::now();
+            Format::Msg::File file(std::move(*scannedStream));
+            auto end = std::chrono::steady_clock::now();
+            reference += std::chrono::duration<double, std::milli>(middle - start).count();
+            scanned += std::chrono::duration<double, std::milli>(end - middle).count();
+        }
+        std::cout << "MSG parsing of " << data.size() << " bytes, average of " << runs << " runs: "
+                  << "byte by byte " << reference / runs << " ms, scanned " << scanned / runs << " ms" << std::endl;
+    }
+}
+
+// Pass --benchmark to time the parser against the byte by byte one
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--benchmark") {
+        benchmark();
+    } else {
+        testPlainMessages();
+        testBrokenBraces();
+        testFirstDuplicateWins();
+        testBigFile();
+    }
+    return Tests::result();
+}
@@ -0,0 +1,188 @@
+// Project includes
+#include "../src/Game/PidIndex.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace Falltergeist;
+
+namespace
+{
+    // Stands in for Game::Object placed on a hexagon
+    struct Object
+    {
+        int pid;
+        unsigned int hexagon;
+        int elevation;
+
+        int PID() const
+        {
+            return pid;
+        }
+    };
+
+    typedef Game::PidIndex<Object> Index;
+
+    struct Map
+    {
+        std::vector<std::list<Object*>> hexagons = std::vector<std::list<Object*>>(200 * 200);
+        std::list<Object> objects;
+        Index index;
+
+        Object* add(int PID, unsigned int hexagon, int elevation)
+        {
+            objects.push_back({PID, hexagon, elevation});
+            Object* object = &objects.back();
+            hexagons[hexagon].push_back(object);
+            index.add(object);
+            return object;
+        }
+
+        Object* find(int PID, unsigned int hexagon, int elevation) const
+        {
+            return index.find(PID, hexagons[hexagon], [hexagon, elevation](Object* object) {
+                return object->hexagon == hexagon && object->elevation == elevation;
+            });
+        }
+
+        // The way tile_contains_pid_obj looked objects up before
+        Object* scan(int PID, unsigned int hexagon, int elevation) const
+        {
+            for (auto object : hexagons[hexagon]) {
+                if (object->PID() == PID && object->elevation == elevation) {
+                    return object;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    void testAddRemove()
+    {
+        Index index;
+        Object a{1, 10, 0}, b{1, 11, 0}, c{2, 10, 0};
+        index.add(&a);
+        index.add(&b);
+        index.add(&c);
+        CHECK(index.objects(1).size() == 2);
+        CHECK(index.objects(2).size() == 1);
+        CHECK(index.objects(3).empty());
+
+        index.remove(&a);
+        CHECK(index.objects(1).size() == 1);
+        CHECK(index.objects(1)[0] == &b);
+        // removing twice or removing unknown objects is harmless
+        index.remove(&a);
+        Object unknown{7, 0, 0};
+        index.remove(&unknown);
+        index.remove(&c);
+        CHECK(index.objects(2).empty());
+
+        index.clear();
+        CHECK(index.objects(1).empty());
+    }
+
+    void testFindWalksEitherList()
+    {
+        Map map;
+        // PID bucket is shorter than the hexagon list, which is too long to just walk it
+        for (int i = 0; i != 20; ++i) {
+            map.add(100 + i, 500, 0);
+        }
+        Object* door = map.add(42, 500, 1);
+        CHECK(map.find(42, 500, 1) == door);
+        CHECK(map.find(42, 500, 0) == nullptr);
+        CHECK(map.find(42, 501, 1) == nullptr);
+
+        // hexagon list is shorter than the PID bucket
+        for (unsigned i = 0; i != 20; ++i) {
+            map.add(7, 1000 + i, 0);
+        }
+        for (int i = 0; i != 10; ++i) {
+            map.add(200 + i, 2000, 2);
+        }
+        Object* rock = map.add(7, 2000, 2);
+        CHECK(map.find(7, 2000, 2) == rock);
+        CHECK(map.find(7, 2000, 0) == nullptr);
+        CHECK(map.find(7, 1005, 0) != nullptr);
+        CHECK(map.find(8, 1005, 0) == nullptr);
+    }
+
+    // Elevation is checked on lookup, scripts may change it after placing an object
+    void testElevationChangedAfterPlacing()
+    {
+        Map map;
+        Object* object = map.add(5, 300, 0);
+        object->elevation = 2;
+        CHECK(map.find(5, 300, 0) == nullptr);
+        CHECK(map.find(5, 300, 2) == object);
+    }
+
+    void testSameAsScan()
+    {
+        Map map;
+        for (unsigned i = 0; i != 5000; ++i) {
+            map.add(static_cast<int>((i * 37) % 300), (i * 7919) % 40000, static_cast<int>(i % 3));
+        }
+        for (unsigned i = 0; i != 20000; ++i) {
+            int PID = static_cast<int>(i % 300);
+            unsigned int hexagon = (i * 7919) % 40000;
+            int elevation = static_cast<int>(i % 3);
+            CHECK(map.find(PID, hexagon, elevation) == map.scan(PID, hexagon, elevation));
+        }
+    }
+
+    void benchmark()
+    {
+        const unsigned lookups = 1000000;
+        Map map;
+        // a typical map: 5,000 objects, mostly one or two per hexagon
+        for (unsigned i = 0; i != 5000; ++i) {
+            map.add(static_cast<int>((i * 37) % 300), (i * 7919) % 40000, 0);
+        }
+        // and one crowded hexagon, like a pile of dropped items
+        for (int i = 0; i != 300; ++i) {
+            map.add(1000 + i, 20100, 0);
+        }
+
+        auto time = [&](const char* title, unsigned int (*hexagon)(unsigned)) {
+            size_t found = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (unsigned i = 0; i != lookups; ++i) {
+                found += map.scan(static_cast<int>(1000 + i % 400), hexagon(i), 0) != nullptr;
+            }
+            auto middle = std::chrono::steady_clock::now();
+            for (unsigned i = 0; i != lookups; ++i) {
+                found += map.find(static_cast<int>(1000 + i % 400), hexagon(i), 0) != nullptr;
+            }
+            auto end = std::chrono::steady_clock::now();
+            std::cout << lookups << " lookups, " << title << ": "
+                      << "hexagon scan " << std::chrono::duration<double, std::milli>(middle - start).count() << " ms, "
+                      << "index " << std::chrono::duration<double, std::milli>(end - middle).count() << " ms"
+                      << " (found " << found << ")" << std::endl;
+        };
+        time("typical hexagons", [](unsigned i) { return (i * 7919) % 40000; });
+        time("crowded hexagon", [](unsigned) { return 20100u; });
+    }
+}
+
+// Pass --benchmark to time lookups against the hexagon scan the opcodes did before
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "--benchmark") {
+        benchmark();
+    } else {
+        testAddRemove();
+        testFindWalksEitherList();
+        testElevationChangedAfterPlacing();
+        testSameAsScan();
+    }
+    return Tests::result();
+}
@@ -0,0 +1,188 @@
+// Project includes
+#include "../src/Format/Dat/Entry.h"
+#include "../src/Format/Dat/File.h"
+#include "../src/Format/Dat/Prefetcher.h"
+#include "../src/Format/Dat/Stream.h"
+#include "Check.h"
+
+// Third-party includes
+#include <zlib.h>
+
+// stdlib
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Falltergeist;
+using Format::Dat::Prefetcher;
+
+namespace
+{
+    const std::string DAT_PATH = "PrefetcherTest.dat";
+
+    struct Item
+    {
+        std::string filename;
+        std::string data;
+        bool compressed;
+    };
+
+    std::string contents(size_t size, char seed)
+    {
+        std::string data(size, '\0');
+        for (size_t i = 0; i != size; ++i) {
+            data[i] = static_cast<char>(seed + i * 7 + i / 13);
+        }
+        return data;
+    }
+
+    std::vector<Item> items()
+    {
+        return {
+            {"maps/arcaves.map", contents(5000, 1), false},
+            {"art/tiles/grid000.frm", contents(20000, 2), true},
+            {"scripts/acklint.int", contents(300, 3), false}
+        };
+    }
+
+    template<typename T>
+    void append(std::string& data, T value)
+    {
+        data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // DAT2 layout: file data, number of entries, entries, size of the tree, size of the whole file
+    void writeDat()
+    {
+        std::string data;
+        std::string tree;
+        for (auto& item : items()) {
+            std::string packed = item.data;
+            if (item.compressed) {
+                uLongf packedSize = compressBound(static_cast<uLong>(item.data.size()));
+                packed.resize(packedSize);
+                compress(reinterpret_cast<Bytef*>(&packed[0]), &packedSize, reinterpret_cast<const Bytef*>(item.data.data()), static_cast<uLong>(item.data.size()));
+                packed.resize(packedSize);
+            }
+            append<uint32_t>(tree, static_cast<uint32_t>(item.filename.size()));
+            tree.append(item.filename);
+            append<uint8_t>(tree, item.compressed ? 1 : 0);
+            append<uint32_t>(tree, static_cast<uint32_t>(item.data.size()));
+            append<uint32_t>(tree, static_cast<uint32_t>(packed.size()));
+            append<uint32_t>(tree, static_cast<uint32_t>(data.size()));
+            data.append(packed);
+        }
+        append<uint32_t>(data, static_cast<uint32_t>(items().size()));
+        data.append(tree);
+        append<uint32_t>(data, static_cast<uint32_t>(tree.size() + 4));
+        append<uint32_t>(data, static_cast<uint32_t>(data.size() + 4));
+        std::ofstream(DAT_PATH, std::ios::binary | std::ios::trunc).write(data.data(), data.size());
+    }
+
+    bool waitUntilReady(Prefetcher& prefetcher, const std::string& filename)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!prefetcher.ready(filename)) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    void testPrefetchedFilesNeedNoDatReads()
+    {
+        writeDat();
+        Format::Dat::File dat(DAT_PATH);
+        Prefetcher prefetcher;
+        auto batch = prefetcher.startBatch(1024 * 1024);
+        for (auto& item : items()) {
+            CHECK(prefetcher.request(batch, item.filename, dat.entry(item.filename), DAT_PATH));
+        }
+        for (auto& item : items()) {
+            CHECK(waitUntilReady(prefetcher, item.filename));
+            CHECK(!prefetcher.pending(item.filename));
+        }
+
+        // the map transition happens after the DAT file has become unreadable:
+        // everything it needs must come from memory
+        std::ofstream(DAT_PATH, std::ios::binary | std::ios::trunc);
+        for (auto& item : items()) {
+            auto stream = prefetcher.take(item.filename);
+            CHECK(stream != nullptr);
+            if (stream) {
+                CHECK(stream->view() == item.data);
+            }
+            CHECK(!prefetcher.ready(item.filename));
+        }
+        // taken streams are handed over only once
+        CHECK(prefetcher.take(items()[0].filename) == nullptr);
+    }
+
+    void testBudget()
+    {
+        writeDat();
+        Format::Dat::File dat(DAT_PATH);
+        auto all = items();
+        Prefetcher prefetcher;
+        // the map and the script fit, the tile doesn't
+        auto batch = prefetcher.startBatch(all[0].data.size() + all[2].data.size());
+        CHECK(prefetcher.request(batch, all[0].filename, dat.entry(all[0].filename), DAT_PATH));
+        CHECK(!prefetcher.request(batch, all[1].filename, dat.entry(all[1].filename), DAT_PATH));
+        CHECK(prefetcher.request(batch, all[2].filename, dat.entry(all[2].filename), DAT_PATH));
+        CHECK(!prefetcher.pending(all[1].filename));
+        CHECK(waitUntilReady(prefetcher, all[0].filename));
+        CHECK(waitUntilReady(prefetcher, all[2].filename));
+
+        // taking a file returns its memory to the batch
+        CHECK(prefetcher.take(all[0].filename) != nullptr);
+        CHECK(!prefetcher.request(batch, all[1].filename, dat.entry(all[1].filename), DAT_PATH));
+        CHECK(prefetcher.take(all[2].filename) != nullptr);
+        // unknown batch
+        CHECK(prefetcher.request(0, all[1].filename, dat.entry(all[1].filename), DAT_PATH) == false);
+    }
+
+    void testCancel()
+    {
+        writeDat();
+        Format::Dat::File dat(DAT_PATH);
+        Prefetcher prefetcher;
+        auto batch = prefetcher.startBatch(1024 * 1024);
+        auto other = prefetcher.startBatch(1024 * 1024);
+        auto all = items();
+        CHECK(prefetcher.request(batch, all[0].filename, dat.entry(all[0].filename), DAT_PATH));
+        CHECK(prefetcher.request(other, all[2].filename, dat.entry(all[2].filename), DAT_PATH));
+        CHECK(waitUntilReady(prefetcher, all[0].filename));
+        CHECK(waitUntilReady(prefetcher, all[2].filename));
+
+        prefetcher.cancel(batch);
+        CHECK(!prefetcher.ready(all[0].filename));
+        CHECK(prefetcher.take(all[0].filename) == nullptr);
+        CHECK(!prefetcher.request(batch, all[1].filename, dat.entry(all[1].filename), DAT_PATH));
+        // other batches are kept
+        CHECK(prefetcher.take(all[2].filename) != nullptr);
+    }
+
+    void testNotRequested()
+    {
+        Prefetcher prefetcher;
+        CHECK(!prefetcher.ready("maps/arcaves.map"));
+        CHECK(!prefetcher.pending("maps/arcaves.map"));
+        CHECK(prefetcher.take("maps/arcaves.map") == nullptr);
+    }
+}
+
+int main()
+{
+    testPrefetchedFilesNeedNoDatReads();
+    testBudget();
+    testCancel();
+    testNotRequested();
+    std::remove(DAT_PATH.c_str());
+    return Tests::result();
+}
@@ -0,0 +1,66 @@
+// Project includes
+#include "../src/Graphics/Rect.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <utility>
+
+using namespace Falltergeist;
+using Graphics::Point;
+using Graphics::Rect;
+using Graphics::Size;
+
+namespace
+{
+    void testInRect()
+    {
+        CHECK(Rect::inRect(Point(0, 0), Size(10, 10)));
+        CHECK(Rect::inRect(Point(9, 9), Size(10, 10)));
+        CHECK(!Rect::inRect(Point(10, 5), Size(10, 10)));
+        CHECK(!Rect::inRect(Point(-1, 5), Size(10, 10)));
+        CHECK(Rect::inRect(Point(15, 15), Point(10, 10), Size(10, 10)));
+        CHECK(!Rect::inRect(Point(20, 15), Point(10, 10), Size(10, 10)));
+    }
+
+    void testVisibleTilesExamples()
+    {
+        // 20 tiles of 50 pixels, 120 pixels wide view
+        CHECK((Rect::visibleTiles(0, 120, 50, 20) == std::make_pair(0, 2)));
+        CHECK((Rect::visibleTiles(30, 120, 50, 20) == std::make_pair(0, 2)));
+        CHECK((Rect::visibleTiles(31, 120, 50, 20) == std::make_pair(0, 3)));
+        CHECK((Rect::visibleTiles(50, 100, 50, 20) == std::make_pair(1, 2)));
+        // the view ends past the last tile
+        CHECK((Rect::visibleTiles(950, 120, 50, 20) == std::make_pair(19, 19)));
+        // the view is larger than the whole row and starts before it
+        CHECK((Rect::visibleTiles(-100, 2000, 50, 20) == std::make_pair(0, 19)));
+        // nothing is visible
+        CHECK(Rect::visibleTiles(-200, 100, 50, 20).first > Rect::visibleTiles(-200, 100, 50, 20).second);
+        CHECK(Rect::visibleTiles(1000, 100, 50, 20).first > Rect::visibleTiles(1000, 100, 50, 20).second);
+    }
+
+    void testVisibleTilesMatchBruteForce()
+    {
+        const unsigned int tileSize = 50;
+        const unsigned int tilesNumber = 20;
+        for (int offset = -300; offset <= 1300; offset += 7) {
+            for (unsigned int length : {1u, 49u, 50u, 51u, 120u, 640u, 1500u}) {
+                auto range = Rect::visibleTiles(offset, length, tileSize, tilesNumber);
+                for (int tile = 0; tile != static_cast<int>(tilesNumber); ++tile) {
+                    bool overlaps = tile * static_cast<int>(tileSize) < offset + static_cast<int>(length)
+                        && offset < (tile + 1) * static_cast<int>(tileSize);
+                    CHECK(overlaps == (tile >= range.first && tile <= range.second));
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    testInRect();
+    testVisibleTilesExamples();
+    testVisibleTilesMatchBruteForce();
+    return Tests::result();
+}
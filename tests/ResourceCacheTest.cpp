@@ -0,0 +1,183 @@
+// Project includes
+#include "../src/ResourceCache.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <map>
+#include <set>
+#include <string>
+
+using namespace Falltergeist;
+using Category = ResourceCache::Category;
+
+namespace
+{
+    // Owner side of the cache, the way ResourceManager keeps its files
+    class Resources
+    {
+        public:
+            ResourceCache cache;
+            std::map<std::string, size_t> decoded;
+            std::set<std::string> resident;
+            std::set<std::string> inUse;
+
+            void load(const std::string& name, size_t size)
+            {
+                if (resident.count(name)) {
+                    cache.hit(Category::FRM, name);
+                    return;
+                }
+                resident.insert(name);
+                decoded[name] = 0;
+                cache.miss(Category::FRM, name, size, [this, name, size]() { return size + decoded[name]; });
+            }
+
+            void trim(size_t budget)
+            {
+                cache.trim(budget, [this](Category, const std::string& name) {
+                    if (inUse.count(name)) {
+                        return false;
+                    }
+                    resident.erase(name);
+                    decoded.erase(name);
+                    return true;
+                });
+            }
+    };
+
+    void testStaysUnderBudget()
+    {
+        const size_t budget = 10000;
+        Resources resources;
+        for (int i = 0; i != 100; ++i) {
+            resources.load("art/critters/" + std::to_string(i) + ".frm", 700);
+            resources.trim(budget);
+            CHECK(resources.cache.evictableBytes() <= budget);
+        }
+        CHECK(resources.resident.size() == budget / 700);
+        CHECK(resources.cache.stats().misses == 100);
+        CHECK(resources.cache.stats().evictions == 100 - budget / 700);
+        // the most recently loaded ones stay
+        CHECK(resources.resident.count("art/critters/99.frm") == 1);
+        CHECK(resources.resident.count("art/critters/0.frm") == 0);
+    }
+
+    void testDecodedSizeIsCounted()
+    {
+        const size_t budget = 10000;
+        Resources resources;
+        for (int i = 0; i != 10; ++i) {
+            resources.load(std::to_string(i), 100);
+        }
+        resources.trim(budget);
+        CHECK(resources.cache.evictableBytes() == 1000);
+        CHECK(resources.resident.size() == 10);
+
+        // converting images makes the files much bigger than their streams
+        for (auto& file : resources.decoded) {
+            file.second = 2000;
+        }
+        resources.trim(budget);
+        CHECK(resources.cache.evictableBytes() <= budget);
+        CHECK(resources.cache.evictableBytes() == 4 * 2100);
+        CHECK(resources.cache.stats().bytes[static_cast<size_t>(Category::FRM)] == 4 * 2100);
+        CHECK(resources.resident.size() == 4);
+    }
+
+    void testLeastRecentlyUsedIsEvicted()
+    {
+        Resources resources;
+        resources.load("a", 100);
+        resources.load("b", 100);
+        resources.load("c", 100);
+        resources.load("a", 100);
+        resources.trim(200);
+        CHECK(resources.resident.count("a") == 1);
+        CHECK(resources.resident.count("b") == 0);
+        CHECK(resources.resident.count("c") == 1);
+        CHECK(resources.cache.stats().hits == 1);
+    }
+
+    void testResourcesInUseStay()
+    {
+        Resources resources;
+        resources.load("a", 100);
+        resources.load("b", 100);
+        resources.load("c", 100);
+        resources.inUse.insert("a");
+        resources.trim(100);
+        CHECK(resources.resident.count("a") == 1);
+        CHECK(resources.resident.count("b") == 0);
+        CHECK(resources.resident.count("c") == 0);
+        CHECK(resources.cache.evictableBytes() == 100);
+
+        // evicted as soon as nobody uses it
+        resources.inUse.clear();
+        resources.load("d", 100);
+        resources.trim(100);
+        CHECK(resources.resident.count("a") == 0);
+        CHECK(resources.resident.count("d") == 1);
+        CHECK(resources.cache.evictableBytes() == 100);
+    }
+
+    void testNoBudget()
+    {
+        Resources resources;
+        for (int i = 0; i != 10; ++i) {
+            resources.load(std::to_string(i), 1000);
+        }
+        resources.trim(0);
+        CHECK(resources.resident.size() == 10);
+        CHECK(resources.cache.stats().evictions == 0);
+    }
+
+    void testOtherIsNotEvictable()
+    {
+        ResourceCache cache;
+        cache.miss(Category::OTHER, "color.pal", 500);
+        cache.miss(Category::TEXTURE, "art/intrface/iface.frm", 300);
+        cache.miss(Category::FRM, "art/intrface/iface.frm", 100);
+        CHECK(cache.stats().totalBytes() == 900);
+        CHECK(cache.evictableBytes() == 400);
+
+        std::set<Category> evicted;
+        cache.trim(1, [&evicted](Category category, const std::string&) {
+            evicted.insert(category);
+            return true;
+        });
+        CHECK(evicted.count(Category::OTHER) == 0);
+        CHECK(evicted.size() == 2);
+        CHECK(cache.evictableBytes() == 0);
+    }
+
+    void testClearKeepsCategory()
+    {
+        ResourceCache cache;
+        cache.miss(Category::TEXTURE, "a", 300);
+        cache.miss(Category::FRM, "a", 100);
+        cache.miss(Category::INT, "b", 50);
+        cache.clear(Category::TEXTURE);
+        CHECK(cache.evictableBytes() == 300);
+
+        std::set<Category> evicted;
+        cache.trim(1, [&evicted](Category category, const std::string&) {
+            evicted.insert(category);
+            return true;
+        });
+        CHECK(evicted == std::set<Category>{Category::TEXTURE});
+    }
+}
+
+int main()
+{
+    testStaysUnderBudget();
+    testDecodedSizeIsCounted();
+    testLeastRecentlyUsedIsEvicted();
+    testResourcesInUseStay();
+    testNoBudget();
+    testOtherIsNotEvictable();
+    testClearKeepsCategory();
+    return Tests::result();
+}
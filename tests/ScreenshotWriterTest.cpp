@@ -0,0 +1,175 @@
+// Project includes
+#include "../src/Graphics/ScreenshotWriter.h"
+#include "../src/Graphics/Size.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Falltergeist;
+using Graphics::ScreenshotWriter;
+using Graphics::Size;
+
+namespace
+{
+    // Writes raw pixels, like a PNG encoder without compression
+    std::string writeRaw(const std::string& filename, const Size&, std::vector<uint8_t>& pixels)
+    {
+        std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+        return stream ? "" : "can't write " + filename;
+    }
+
+    std::string readFile(const std::string& filename)
+    {
+        std::ifstream stream(filename, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    }
+
+    // RGBA image with alpha left by blending
+    std::vector<uint8_t> image(const Size& size)
+    {
+        std::vector<uint8_t> pixels(static_cast<size_t>(size.width()) * size.height() * 4);
+        for (size_t i = 0; i != pixels.size(); ++i) {
+            pixels[i] = static_cast<uint8_t>(i * 31);
+        }
+        return pixels;
+    }
+
+    std::vector<ScreenshotWriter::Result> waitForResults(ScreenshotWriter& writer, size_t count)
+    {
+        std::vector<ScreenshotWriter::Result> results;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (results.size() < count && std::chrono::steady_clock::now() < deadline) {
+            for (auto& result : writer.finished()) {
+                results.push_back(result);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return results;
+    }
+
+    void testWritesOpaqueImage()
+    {
+        const std::string filename = "ScreenshotWriterTest.raw";
+        // odd width, so rows are not a multiple of 8 bytes
+        Size size(7, 5);
+        auto pixels = image(size);
+        {
+            ScreenshotWriter writer(2, writeRaw);
+            CHECK(writer.write(filename, size, pixels));
+            auto results = waitForResults(writer, 1);
+            CHECK(results.size() == 1);
+            if (!results.empty()) {
+                CHECK(results[0].filename == filename);
+                CHECK(results[0].error.empty());
+            }
+        }
+
+        auto written = readFile(filename);
+        CHECK(written.size() == pixels.size());
+        bool opaque = true;
+        bool sameColors = true;
+        for (size_t i = 0; i != written.size() && i != pixels.size(); ++i) {
+            if (i % 4 == 3) {
+                opaque = opaque && static_cast<uint8_t>(written[i]) == 255;
+            } else {
+                sameColors = sameColors && static_cast<uint8_t>(written[i]) == pixels[i];
+            }
+        }
+        CHECK(opaque);
+        CHECK(sameColors);
+        std::remove(filename.c_str());
+    }
+
+    void testFullQueueDrops()
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool encoding = false;
+        bool released = false;
+        std::vector<std::string> encoded;
+
+        // the first image blocks the worker, the next ones wait in the queue
+        auto encoder = [&](const std::string& filename, const Size&, std::vector<uint8_t>&) {
+            std::unique_lock<std::mutex> lock(mutex);
+            encoding = true;
+            changed.notify_all();
+            changed.wait(lock, [&released]() { return released; });
+            encoded.push_back(filename);
+            return std::string();
+        };
+
+        Size size(2, 2);
+        {
+            ScreenshotWriter writer(2, encoder);
+            CHECK(writer.write("0", size, image(size)));
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&encoding]() { return encoding; });
+            }
+            CHECK(writer.write("1", size, image(size)));
+            CHECK(writer.write("2", size, image(size)));
+            CHECK(!writer.write("3", size, image(size)));
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                released = true;
+            }
+            changed.notify_all();
+            auto results = waitForResults(writer, 3);
+            CHECK(results.size() == 3);
+
+            // there is room again
+            CHECK(writer.write("4", size, image(size)));
+        }
+        // queued images are written before the writer goes away
+        CHECK((encoded == std::vector<std::string>{"0", "1", "2", "4"}));
+    }
+
+    void testEncoderError()
+    {
+        auto failing = [](const std::string&, const Size&, std::vector<uint8_t>&) {
+            return std::string("disk full");
+        };
+        ScreenshotWriter writer(1, failing);
+        Size size(1, 1);
+        CHECK(writer.write("screenshot.png", size, image(size)));
+        auto results = waitForResults(writer, 1);
+        CHECK(results.size() == 1);
+        if (!results.empty()) {
+            CHECK(results[0].filename == "screenshot.png");
+            CHECK(results[0].error == "disk full");
+        }
+    }
+
+    void testFlipRows()
+    {
+        const uint8_t source[] = {1, 2, 3, 4, 5, 6};
+        uint8_t destination[6] = {};
+        ScreenshotWriter::flipRows(source, destination, 2, 3);
+        const uint8_t expected[] = {5, 6, 3, 4, 1, 2};
+        CHECK(std::equal(std::begin(expected), std::end(expected), std::begin(destination)));
+    }
+}
+
+int main()
+{
+    testWritesOpaqueImage();
+    testFullQueueDrops();
+    testEncoderError();
+    testFlipRows();
+    return Tests::result();
+}
@@ -0,0 +1,130 @@
+// Project includes
+#include "../src/Base/SharedCache.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <memory>
+#include <vector>
+
+using namespace Falltergeist;
+
+namespace
+{
+    // Stands in for the sprite behind an inventory image
+    struct Sprite
+    {
+        static unsigned constructed;
+
+        int FID;
+
+        explicit Sprite(int FID) : FID(FID)
+        {
+            ++constructed;
+        }
+    };
+
+    unsigned Sprite::constructed = 0;
+
+    typedef Base::SharedCache<int, Sprite> Cache;
+
+    // Same lazy accessors as Game::ItemObject, minus everything which needs SDL
+    struct Item
+    {
+        int inventoryFID;
+        std::shared_ptr<Sprite> inventoryUi, inventorySlotUi, inventoryDragUi;
+
+        static std::shared_ptr<Sprite> build(int FID)
+        {
+            return std::make_shared<Sprite>(FID);
+        }
+
+        std::shared_ptr<Sprite> ui(Cache& cache, std::shared_ptr<Sprite>& slot)
+        {
+            if (!slot) {
+                slot = cache.get(inventoryFID, build);
+            }
+            return slot;
+        }
+    };
+
+    const int ITEMS = 5000;
+    const int FIDS = 37;
+
+    std::vector<Item> loadMap()
+    {
+        std::vector<Item> items(ITEMS);
+        for (int i = 0; i != ITEMS; ++i) {
+            items[i].inventoryFID = 0x07000000 + i % FIDS;
+        }
+        return items;
+    }
+
+    void testLoadingBuildsNothing()
+    {
+        Sprite::constructed = 0;
+        auto items = loadMap();
+        CHECK(Sprite::constructed == 0);
+    }
+
+    void testOneSpritePerFidAndKind()
+    {
+        Sprite::constructed = 0;
+        Cache inventoryUis, inventorySlotUis, inventoryDragUis;
+        auto items = loadMap();
+
+        for (auto& item : items) {
+            CHECK(item.ui(inventoryUis, item.inventoryUi)->FID == item.inventoryFID);
+            item.ui(inventorySlotUis, item.inventorySlotUi);
+        }
+        CHECK(Sprite::constructed == 2 * FIDS);
+
+        // Asking again is free
+        for (auto& item : items) {
+            item.ui(inventoryUis, item.inventoryUi);
+        }
+        CHECK(Sprite::constructed == 2 * FIDS);
+
+        // Only the dragged item needs its big image
+        items[0].ui(inventoryDragUis, items[0].inventoryDragUi);
+        CHECK(Sprite::constructed == 2 * FIDS + 1);
+        CHECK(inventoryUis.alive() == FIDS);
+        CHECK(inventoryDragUis.alive() == 1);
+        CHECK(items[FIDS].inventoryUi == items[0].inventoryUi);
+    }
+
+    void testReleasedWithLastUser()
+    {
+        Sprite::constructed = 0;
+        Cache cache;
+        auto items = loadMap();
+        for (auto& item : items) {
+            item.ui(cache, item.inventoryUi);
+        }
+        CHECK(cache.alive() == FIDS);
+
+        for (auto& item : items) {
+            if (item.inventoryFID == 0x07000000) {
+                item.inventoryUi.reset();
+            }
+        }
+        CHECK(cache.alive() == FIDS - 1);
+
+        // Built again on the next request
+        items[0].ui(cache, items[0].inventoryUi);
+        CHECK(Sprite::constructed == FIDS + 1);
+        CHECK(cache.alive() == FIDS);
+
+        items.clear();
+        CHECK(cache.alive() == 0);
+    }
+}
+
+int main()
+{
+    testLoadingBuildsNothing();
+    testOneSpritePerFidAndKind();
+    testReleasedWithLastUser();
+    return Tests::result();
+}
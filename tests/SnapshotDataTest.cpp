@@ -0,0 +1,233 @@
+// Project includes
+#include "../src/Exception.h"
+#include "../src/Game/SnapshotData.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using namespace Falltergeist;
+using Game::SnapshotData;
+
+namespace
+{
+    SnapshotData::Object sampleObject(int32_t PID)
+    {
+        SnapshotData::Object object;
+        object.PID = PID;
+        object.FID = 0x01000000 | PID;
+        object.SID = PID % 3 ? -1 : PID + 100;
+        object.position = 12345 + PID;
+        object.elevation = PID % 3;
+        object.orientation = 5;
+        object.lightOrientation = 2;
+        object.lightRadius = 8;
+        object.lightIntensity = 65536;
+        object.flags = SnapshotData::FLAG_FLAT | SnapshotData::FLAG_SHOOT_THRU;
+        object.trans = 3;
+        object.amount = 17;
+        object.opened = true;
+        object.hitPoints = -4;
+        SnapshotData::Variable integer;
+        integer.integerValue = -77;
+        SnapshotData::Variable floating;
+        floating.isFloat = true;
+        floating.floatValue = 2.5f;
+        object.LVARS = {integer, floating};
+        return object;
+    }
+
+    SnapshotData sampleSnapshot()
+    {
+        SnapshotData snapshot;
+        snapshot.time = {302400, 999, 59, 30, 23, 31, 12, 2241};
+        snapshot.GVARS = {0, -1, 2, 300000};
+        snapshot.location = "ARTEMPLE.MAP";
+        snapshot.elevation = 2;
+        snapshot.MVARS = {7, 0, -7};
+        snapshot.playerPosition = 20100;
+        snapshot.playerOrientation = 4;
+
+        auto& player = snapshot.player;
+        player.name = "Chosen One";
+        player.gender = GENDER::FEMALE;
+        player.age = 25;
+        for (unsigned i = 0; i != SnapshotData::STATS; ++i) {
+            player.stats[i] = {static_cast<int32_t>(i + 1), -static_cast<int32_t>(i)};
+        }
+        for (unsigned i = 0; i != SnapshotData::SKILLS; ++i) {
+            player.skills[i] = {static_cast<int32_t>(i % 2), static_cast<int32_t>(i * 10)};
+        }
+        for (unsigned i = 0; i != SnapshotData::TRAITS; ++i) {
+            player.traits[i] = i % 5 == 0 ? 1 : 0;
+        }
+        player.hitPoints = 31;
+        player.poisonLevel = 2;
+        player.radiationLevel = 150;
+        player.experience = 4200;
+        player.level = 4;
+        player.statsPoints = 1;
+        player.skillsPoints = 33;
+        player.inventory = {sampleObject(1), sampleObject(2)};
+        player.armorSlot = std::make_unique<SnapshotData::Object>(sampleObject(3));
+        player.rightHandSlot = std::make_unique<SnapshotData::Object>(sampleObject(4));
+
+        // a container with a nested container
+        auto container = sampleObject(5);
+        auto bag = sampleObject(6);
+        bag.inventory = {sampleObject(7)};
+        container.inventory = {bag, sampleObject(8)};
+        snapshot.objects = {container, sampleObject(9), sampleObject(10)};
+
+        snapshot.timers = {{0, 1500.5, 1}, {3, 100, -2}};
+        return snapshot;
+    }
+
+    bool sameObject(const SnapshotData::Object& a, const SnapshotData::Object& b);
+
+    bool sameObjects(const std::vector<SnapshotData::Object>& a, const std::vector<SnapshotData::Object>& b)
+    {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0; i != a.size(); ++i) {
+            if (!sameObject(a[i], b[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool sameObject(const SnapshotData::Object& a, const SnapshotData::Object& b)
+    {
+        if (a.LVARS.size() != b.LVARS.size()) {
+            return false;
+        }
+        for (size_t i = 0; i != a.LVARS.size(); ++i) {
+            if (a.LVARS[i].isFloat != b.LVARS[i].isFloat
+                || a.LVARS[i].integerValue != b.LVARS[i].integerValue
+                || a.LVARS[i].floatValue != b.LVARS[i].floatValue
+            ) {
+                return false;
+            }
+        }
+        return a.PID == b.PID
+            && a.FID == b.FID
+            && a.SID == b.SID
+            && a.position == b.position
+            && a.elevation == b.elevation
+            && a.orientation == b.orientation
+            && a.lightOrientation == b.lightOrientation
+            && a.lightRadius == b.lightRadius
+            && a.lightIntensity == b.lightIntensity
+            && a.flags == b.flags
+            && a.trans == b.trans
+            && a.amount == b.amount
+            && a.opened == b.opened
+            && a.hitPoints == b.hitPoints
+            && sameObjects(a.inventory, b.inventory);
+    }
+
+    bool sameOptionalObject(const std::unique_ptr<SnapshotData::Object>& a, const std::unique_ptr<SnapshotData::Object>& b)
+    {
+        if (!a || !b) {
+            return !a && !b;
+        }
+        return sameObject(*a, *b);
+    }
+
+    void testRoundTrip()
+    {
+        auto saved = sampleSnapshot();
+        SnapshotData loaded;
+        CHECK(loaded.read(saved.write()));
+
+        CHECK(loaded.time == saved.time);
+        CHECK(loaded.GVARS == saved.GVARS);
+        CHECK(loaded.location == saved.location);
+        CHECK(loaded.elevation == saved.elevation);
+        CHECK(loaded.MVARS == saved.MVARS);
+        CHECK(loaded.playerPosition == saved.playerPosition);
+        CHECK(loaded.playerOrientation == saved.playerOrientation);
+
+        CHECK(loaded.player.name == saved.player.name);
+        CHECK(loaded.player.gender == saved.player.gender);
+        CHECK(loaded.player.age == saved.player.age);
+        CHECK(loaded.player.stats == saved.player.stats);
+        CHECK(loaded.player.skills == saved.player.skills);
+        CHECK(loaded.player.traits == saved.player.traits);
+        CHECK(loaded.player.hitPoints == saved.player.hitPoints);
+        CHECK(loaded.player.poisonLevel == saved.player.poisonLevel);
+        CHECK(loaded.player.radiationLevel == saved.player.radiationLevel);
+        CHECK(loaded.player.experience == saved.player.experience);
+        CHECK(loaded.player.level == saved.player.level);
+        CHECK(loaded.player.statsPoints == saved.player.statsPoints);
+        CHECK(loaded.player.skillsPoints == saved.player.skillsPoints);
+        CHECK(sameObjects(loaded.player.inventory, saved.player.inventory));
+        CHECK(sameOptionalObject(loaded.player.armorSlot, saved.player.armorSlot));
+        CHECK(!loaded.player.leftHandSlot);
+        CHECK(sameOptionalObject(loaded.player.rightHandSlot, saved.player.rightHandSlot));
+
+        CHECK(sameObjects(loaded.objects, saved.objects));
+        CHECK(loaded.objects[0].inventory[0].inventory[0].PID == 7);
+
+        CHECK(loaded.timers.size() == saved.timers.size());
+        for (size_t i = 0; i != loaded.timers.size() && i != saved.timers.size(); ++i) {
+            CHECK(loaded.timers[i].object == saved.timers[i].object);
+            CHECK(loaded.timers[i].remaining == saved.timers[i].remaining);
+            CHECK(loaded.timers[i].fixedParam == saved.timers[i].fixedParam);
+        }
+
+        // nothing is lost or added, saving the loaded game gives the same file
+        CHECK(loaded.write() == saved.write());
+    }
+
+    void testEmptyGame()
+    {
+        SnapshotData saved;
+        SnapshotData loaded = sampleSnapshot();
+        CHECK(loaded.read(saved.write()));
+        CHECK(loaded.location.empty());
+        CHECK(loaded.objects.empty());
+        CHECK(loaded.player.inventory.empty());
+        CHECK(!loaded.player.armorSlot);
+        CHECK(loaded.timers.empty());
+    }
+
+    void testBrokenFileKeepsData()
+    {
+        auto data = sampleSnapshot().write();
+        SnapshotData loaded = sampleSnapshot();
+        loaded.location = "KEEP.MAP";
+
+        CHECK(!loaded.read("not a save file"));
+        CHECK(loaded.location == "KEEP.MAP");
+
+        // the section table is intact, the last section is cut
+        data.resize(data.size() - 4);
+        CHECK_THROWS(Exception, loaded.read(data));
+        CHECK(loaded.location == "KEEP.MAP");
+        CHECK(loaded.objects.size() == 3);
+    }
+
+    void testTimerOfUnknownObject()
+    {
+        auto saved = sampleSnapshot();
+        saved.timers.push_back({static_cast<uint32_t>(saved.objects.size() + 1), 10, 0});
+        SnapshotData loaded;
+        CHECK_THROWS(Exception, loaded.read(saved.write()));
+    }
+}
+
+int main()
+{
+    testRoundTrip();
+    testEmptyGame();
+    testBrokenFileKeepsData();
+    testTimerOfUnknownObject();
+    return Tests::result();
+}
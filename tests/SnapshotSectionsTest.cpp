@@ -0,0 +1,108 @@
+// Project includes
+#include "../src/Base/BinaryReader.h"
+#include "../src/Base/BinaryWriter.h"
+#include "../src/Exception.h"
+#include "../src/Game/SnapshotSections.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using namespace Falltergeist;
+using Game::SnapshotSections;
+
+namespace
+{
+    const uint32_t TIME = SnapshotSections::id("TIME");
+    const uint32_t GVARS = SnapshotSections::id("GVAR");
+    const uint32_t EMPTY = SnapshotSections::id("NONE");
+
+    std::string sampleFile()
+    {
+        std::map<uint32_t, Base::BinaryWriter> sections;
+        sections[TIME].write<uint32_t>(302400);
+        sections[GVARS].writeArray(std::vector<int32_t>{0, 1, 2, 3});
+        sections[EMPTY];
+        return SnapshotSections::write(sections);
+    }
+
+    void testId()
+    {
+        CHECK(TIME == (uint32_t('T') | uint32_t('I') << 8 | uint32_t('M') << 16 | uint32_t('E') << 24));
+        CHECK(TIME != GVARS);
+    }
+
+    void testRoundTrip()
+    {
+        auto data = sampleFile();
+        std::unordered_map<uint32_t, std::string_view> sections;
+        CHECK(SnapshotSections::read(data, sections));
+        CHECK(sections.size() == 3);
+
+        Base::BinaryReader time(sections[TIME]);
+        CHECK(time.read<uint32_t>() == 302400);
+        CHECK(time.atEnd());
+
+        Base::BinaryReader gvars(sections[GVARS]);
+        std::vector<int32_t> values;
+        gvars.readArray(values);
+        CHECK((values == std::vector<int32_t>{0, 1, 2, 3}));
+        CHECK(gvars.atEnd());
+
+        CHECK(sections.count(EMPTY) == 1);
+        CHECK(sections[EMPTY].empty());
+    }
+
+    void testOtherFilesAreRejected()
+    {
+        std::unordered_map<uint32_t, std::string_view> sections;
+        CHECK(!SnapshotSections::read("", sections));
+        CHECK(!SnapshotSections::read("SAVEGAME", sections));
+
+        auto data = sampleFile();
+        // newer version
+        auto newer = data;
+        newer[4]++;
+        CHECK(!SnapshotSections::read(newer, sections));
+        // other byte order
+        auto swapped = data;
+        std::swap(swapped[8], swapped[11]);
+        std::swap(swapped[9], swapped[10]);
+        CHECK(!SnapshotSections::read(swapped, sections));
+        CHECK(sections.empty());
+    }
+
+    void testBrokenFilesThrow()
+    {
+        auto data = sampleFile();
+
+        // section table cut short
+        std::unordered_map<uint32_t, std::string_view> sections;
+        CHECK_THROWS(Exception, SnapshotSections::read(std::string_view(data).substr(0, 20), sections));
+
+        // section data cut short
+        CHECK_THROWS(Exception, SnapshotSections::read(std::string_view(data).substr(0, data.size() - 1), sections));
+
+        // section offset past the end of file, the first table entry starts at byte 16
+        auto corrupt = data;
+        uint32_t offset = 0x7FFFFFFF;
+        std::memcpy(&corrupt[20], &offset, sizeof(offset));
+        CHECK_THROWS(Exception, SnapshotSections::read(corrupt, sections));
+    }
+}
+
+int main()
+{
+    testId();
+    testRoundTrip();
+    testOtherFilesAreRejected();
+    testBrokenFilesThrow();
+    return Tests::result();
+}
@@ -0,0 +1,118 @@
+// Project includes
+#include "../src/Graphics/Rect.h"
+#include "../src/Graphics/SpatialGrid.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Falltergeist;
+using Graphics::Point;
+using Graphics::Size;
+
+namespace
+{
+    bool contains(const std::vector<unsigned int>& ids, unsigned int id)
+    {
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+
+    void testItemsAreFoundInCoveredCells()
+    {
+        Graphics::SpatialGrid grid(Size(64, 64));
+        grid.reset(Point(0, 0), Size(640, 480));
+        grid.insert(0, Point(10, 10), Size(20, 20));
+        grid.insert(1, Point(60, 60), Size(10, 10));
+
+        CHECK(contains(grid.itemsAt(Point(15, 15)), 0));
+        CHECK(!contains(grid.itemsAt(Point(100, 15)), 0));
+        CHECK(!contains(grid.itemsAt(Point(130, 15)), 1));
+        // item 1 spans four cells
+        CHECK(contains(grid.itemsAt(Point(63, 63)), 1));
+        CHECK(contains(grid.itemsAt(Point(64, 64)), 1));
+        CHECK(contains(grid.itemsAt(Point(64, 0)), 1));
+        CHECK(grid.itemsAt(Point(200, 200)).empty());
+    }
+
+    void testInsertionOrderIsKept()
+    {
+        Graphics::SpatialGrid grid(Size(32, 32));
+        grid.reset(Point(0, 0), Size(100, 100));
+        for (unsigned int id = 0; id != 5; ++id) {
+            grid.insert(id, Point(0, 0), Size(10, 10));
+        }
+        CHECK((grid.itemsAt(Point(1, 1)) == std::vector<unsigned int>{0, 1, 2, 3, 4}));
+    }
+
+    void testOutsideOfAreaIsIgnored()
+    {
+        Graphics::SpatialGrid grid(Size(64, 64));
+        grid.reset(Point(100, 100), Size(200, 200));
+        grid.insert(0, Point(0, 0), Size(50, 50));
+        grid.insert(1, Point(80, 80), Size(40, 40));
+        grid.insert(2, Point(120, 120), Size(0, 10));
+
+        CHECK(grid.itemsAt(Point(10, 10)).empty());
+        CHECK(grid.itemsAt(Point(99, 150)).empty());
+        CHECK(grid.itemsAt(Point(300, 150)).empty());
+        CHECK((grid.itemsAt(Point(105, 105)) == std::vector<unsigned int>{1}));
+    }
+
+    void testResetRemovesItems()
+    {
+        Graphics::SpatialGrid grid(Size(64, 64));
+        grid.reset(Point(0, 0), Size(128, 128));
+        grid.insert(0, Point(0, 0), Size(128, 128));
+        grid.reset(Point(0, 0), Size(128, 128));
+        CHECK(grid.itemsAt(Point(10, 10)).empty());
+        CHECK(grid.itemsAt(Point(100, 100)).empty());
+    }
+
+    void testMatchesBruteForce()
+    {
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> position(-50, 700);
+        std::uniform_int_distribution<int> extent(1, 150);
+
+        struct Box
+        {
+            Point topLeft;
+            Size size;
+        };
+        std::vector<Box> boxes;
+        Graphics::SpatialGrid grid(Size(64, 64));
+        grid.reset(Point(0, 0), Size(640, 480));
+        for (unsigned int id = 0; id != 200; ++id) {
+            boxes.push_back(Box{Point(position(random), position(random)), Size(extent(random), extent(random))});
+            grid.insert(id, boxes.back().topLeft, boxes.back().size);
+        }
+
+        for (int i = 0; i != 2000; ++i) {
+            Point point(position(random) % 640, position(random) % 480);
+            if (point.x() < 0 || point.y() < 0) {
+                continue;
+            }
+            auto& candidates = grid.itemsAt(point);
+            for (unsigned int id = 0; id != boxes.size(); ++id) {
+                // every item containing the point must be a candidate
+                if (Graphics::Rect::inRect(point, boxes[id].topLeft, boxes[id].size)) {
+                    CHECK(contains(candidates, id));
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    testItemsAreFoundInCoveredCells();
+    testInsertionOrderIsKept();
+    testOutsideOfAreaIsIgnored();
+    testResetRemovesItems();
+    testMatchesBruteForce();
+    return Tests::result();
+}
@@ -0,0 +1,94 @@
+// Project includes
+#include "../src/Exception.h"
+#include "../src/Format/Dat/TextScanner.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <string>
+
+using namespace Falltergeist;
+using Format::Dat::TextScanner;
+
+namespace
+{
+    void testLines()
+    {
+        TextScanner scanner("first\r\nsecond\n\nlast");
+        CHECK(scanner.line() == "first");
+        CHECK(scanner.line() == "second");
+        CHECK(scanner.line() == "");
+        CHECK(!scanner.atEnd());
+        CHECK(scanner.line() == "last");
+        CHECK(scanner.atEnd());
+    }
+
+    void testMsgEntry()
+    {
+        // {number}{sound}{text} as in MSG files
+        TextScanner scanner("# comment\n{100}{}{Hello\n world}");
+        CHECK(scanner.skipPast('{'));
+        CHECK(scanner.until('}') == "100");
+        CHECK(scanner.skipPast('{'));
+        CHECK(scanner.until('}') == "");
+        CHECK(scanner.skipPast('{'));
+        CHECK(scanner.until('}') == "Hello\n world");
+        CHECK(!scanner.skipPast('{'));
+        CHECK(scanner.atEnd());
+    }
+
+    void testUntilAnyDoesNotConsumeDelimiter()
+    {
+        TextScanner scanner("GVAR_PLAYER_REPUTATION :=0; // comment");
+        CHECK(TextScanner::rtrim(scanner.untilAny(":;")) == "GVAR_PLAYER_REPUTATION");
+        CHECK(scanner.until(';') == ":=0");
+        CHECK(scanner.untilAny("\n") == " // comment");
+        CHECK(scanner.atEnd());
+    }
+
+    void testUntilWithoutDelimiterReturnsRest()
+    {
+        TextScanner scanner("no delimiter");
+        CHECK(scanner.until(';') == "no delimiter");
+        CHECK(scanner.atEnd());
+        CHECK(scanner.until(';') == "");
+    }
+
+    void testTrim()
+    {
+        CHECK(TextScanner::trim("  \t value \r\n") == "value");
+        CHECK(TextScanner::rtrim("  value  ") == "  value");
+        CHECK(TextScanner::trim("   ") == "");
+    }
+
+    void testAppendWithout()
+    {
+        std::string text = "prefix:";
+        TextScanner::appendWithout(text, "a\nb\rc\n", "\r\n");
+        CHECK(text == "prefix:abc");
+    }
+
+    void testToInt()
+    {
+        CHECK(TextScanner::toInt("42") == 42);
+        CHECK(TextScanner::toInt(" -7 ") == -7);
+        CHECK(TextScanner::toInt("+5") == 5);
+        // trailing garbage is ignored like std::stoi does
+        CHECK(TextScanner::toInt("12abc") == 12);
+        CHECK_THROWS(Exception, TextScanner::toInt("abc"));
+        CHECK_THROWS(Exception, TextScanner::toInt(""));
+    }
+}
+
+int main()
+{
+    testLines();
+    testMsgEntry();
+    testUntilAnyDoesNotConsumeDelimiter();
+    testUntilWithoutDelimiterReturnsRest();
+    testTrim();
+    testAppendWithout();
+    testToInt();
+    return Tests::result();
+}
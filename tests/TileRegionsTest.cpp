@@ -0,0 +1,125 @@
+// Project includes
+#include "../src/UI/TileRegions.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace Falltergeist;
+using UI::TileRegions;
+
+namespace
+{
+    // Same adjacency as the flood fill the regions replace
+    std::vector<unsigned int> floodFill(const std::vector<unsigned int>& numbers, unsigned int& count)
+    {
+        std::set<unsigned int> tiles(numbers.begin(), numbers.end());
+        std::map<unsigned int, unsigned int> labels;
+        count = 0;
+        for (auto number : numbers) {
+            if (labels.count(number)) {
+                continue;
+            }
+            std::queue<unsigned int> queue;
+            queue.push(number);
+            labels[number] = count;
+            while (!queue.empty()) {
+                auto tile = queue.front();
+                queue.pop();
+                for (long long neighbour : {(long long) tile - 1, (long long) tile + 1, (long long) tile - 100, (long long) tile + 100}) {
+                    if (neighbour < 0 || !tiles.count(neighbour) || labels.count(neighbour)) {
+                        continue;
+                    }
+                    labels[neighbour] = count;
+                    queue.push(neighbour);
+                }
+            }
+            count++;
+        }
+        std::vector<unsigned int> regions;
+        for (auto number : numbers) {
+            regions.push_back(labels[number]);
+        }
+        return regions;
+    }
+
+    void testSeparateRoofs()
+    {
+        // two 2x2 roofs and a single tile
+        std::vector<unsigned int> numbers{0, 1, 10, 11, 100, 101, 110, 111, 505};
+        std::vector<unsigned int> regions;
+        CHECK(TileRegions::label(numbers, regions) == 3);
+        CHECK((regions == std::vector<unsigned int>{0, 0, 1, 1, 0, 0, 1, 1, 2}));
+    }
+
+    void testRegionsJoinedLater()
+    {
+        // U shape, both arms are labeled apart until the bottom row joins them
+        std::vector<unsigned int> numbers{0, 2, 100, 102, 200, 201, 202};
+        std::vector<unsigned int> regions;
+        CHECK(TileRegions::label(numbers, regions) == 1);
+        CHECK((regions == std::vector<unsigned int>(7, 0)));
+    }
+
+    void testRowWrap()
+    {
+        // tile 99 is the right edge of the first row, 100 starts the next one
+        std::vector<unsigned int> numbers{99, 100};
+        std::vector<unsigned int> regions;
+        CHECK(TileRegions::label(numbers, regions) == 1);
+    }
+
+    void testFullRoof()
+    {
+        std::vector<unsigned int> numbers;
+        for (unsigned int i = 0; i != 100 * 100; ++i) {
+            numbers.push_back(i);
+        }
+        std::vector<unsigned int> regions;
+        CHECK(TileRegions::label(numbers, regions) == 1);
+        CHECK(regions.size() == numbers.size());
+    }
+
+    void testEmpty()
+    {
+        std::vector<unsigned int> regions{1, 2, 3};
+        CHECK(TileRegions::label({}, regions) == 0);
+        CHECK(regions.empty());
+    }
+
+    void testMatchesFloodFill()
+    {
+        std::mt19937 random(3);
+        for (int density : {20, 45, 60, 80}) {
+            std::bernoulli_distribution isRoof(density / 100.0);
+            std::vector<unsigned int> numbers;
+            for (unsigned int i = 0; i != 100 * 100; ++i) {
+                if (isRoof(random)) {
+                    numbers.push_back(i);
+                }
+            }
+            std::vector<unsigned int> regions;
+            unsigned int expectedCount = 0;
+            auto expected = floodFill(numbers, expectedCount);
+            CHECK(TileRegions::label(numbers, regions) == expectedCount);
+            CHECK(regions == expected);
+        }
+    }
+}
+
+int main()
+{
+    testSeparateRoofs();
+    testRegionsJoinedLater();
+    testRowWrap();
+    testFullRoof();
+    testEmpty();
+    testMatchesFloodFill();
+    return Tests::result();
+}
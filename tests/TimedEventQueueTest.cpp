@@ -0,0 +1,138 @@
+// Project includes
+#include "../src/Game/TimedEventQueue.h"
+#include "Check.h"
+
+// Third-party includes
+
+// stdlib
+#include <utility>
+#include <vector>
+
+using namespace Falltergeist;
+using Game::Object;
+using Game::TimedEventQueue;
+
+namespace
+{
+    // objects are only compared by address
+    Object* const first = reinterpret_cast<Object*>(0x10);
+    Object* const second = reinterpret_cast<Object*>(0x20);
+
+    using Fired = std::vector<std::pair<Object*, int>>;
+
+    Fired think(TimedEventQueue& queue, float deltaTime)
+    {
+        Fired fired;
+        queue.think(deltaTime, [&fired](Object* object, int fixedParam) {
+            fired.emplace_back(object, fixedParam);
+        });
+        return fired;
+    }
+
+    void testEventsFireInDueOrder()
+    {
+        TimedEventQueue queue;
+        queue.add(first, 3.0f, 3);
+        queue.add(first, 1.0f, 1);
+        queue.add(second, 2.0f, 2);
+        queue.add(second, 1.0f, 4);
+
+        CHECK(think(queue, 0.5f).empty());
+        // same due time keeps the order of adding
+        CHECK((think(queue, 0.5f) == Fired{{first, 1}, {second, 4}}));
+        CHECK((think(queue, 5.0f) == Fired{{second, 2}, {first, 3}}));
+        CHECK(think(queue, 5.0f).empty());
+    }
+
+    void testCancelByHandle()
+    {
+        TimedEventQueue queue;
+        auto handle = queue.add(first, 1.0f, 1);
+        queue.add(first, 1.0f, 2);
+        queue.cancel(handle);
+        CHECK((think(queue, 1.0f) == Fired{{first, 2}}));
+    }
+
+    void testCancelByObject()
+    {
+        TimedEventQueue queue;
+        queue.add(first, 1.0f, 1);
+        queue.add(second, 1.0f, 2);
+        queue.cancel(first);
+        // events added after cancelling are kept
+        queue.add(first, 1.0f, 3);
+        CHECK((think(queue, 1.0f) == Fired{{second, 2}, {first, 3}}));
+    }
+
+    void testCancelByFixedParam()
+    {
+        TimedEventQueue queue;
+        queue.add(first, 1.0f, 1);
+        queue.add(first, 1.0f, 2);
+        queue.add(second, 1.0f, 1);
+        queue.cancel(first, 1);
+        CHECK((think(queue, 1.0f) == Fired{{first, 2}, {second, 1}}));
+    }
+
+    void testEventsAddedByHandlerWaitForNextThink()
+    {
+        TimedEventQueue queue;
+        queue.add(first, 0.0f, 1);
+        int calls = 0;
+        queue.think(1.0f, [&queue, &calls](Object* object, int fixedParam) {
+            calls++;
+            queue.add(object, 0.0f, fixedParam + 1);
+        });
+        CHECK(calls == 1);
+        CHECK((think(queue, 0.0f) == Fired{{first, 2}}));
+    }
+
+    void testForEachSkipsCancelled()
+    {
+        TimedEventQueue queue;
+        queue.add(second, 5.0f, 1);
+        auto handle = queue.add(first, 2.0f, 2);
+        queue.add(first, 3.0f, 3);
+        queue.cancel(handle);
+        think(queue, 1.0f);
+
+        std::vector<std::pair<double, int>> pending;
+        queue.forEach([&pending](Object*, double remaining, int fixedParam) {
+            pending.emplace_back(remaining, fixedParam);
+        });
+        CHECK((pending == std::vector<std::pair<double, int>>{{4.0, 1}, {2.0, 3}}));
+    }
+
+    void testCompactionKeepsLiveEvents()
+    {
+        TimedEventQueue queue;
+        queue.add(second, 10.0f, -1);
+        for (int i = 0; i != 5000; ++i) {
+            queue.cancel(queue.add(first, 1.0f, i));
+        }
+        queue.add(first, 1.0f, 5000);
+        CHECK((think(queue, 1.0f) == Fired{{first, 5000}}));
+        CHECK((think(queue, 10.0f) == Fired{{second, -1}}));
+    }
+
+    void testClear()
+    {
+        TimedEventQueue queue;
+        queue.add(first, 1.0f, 1);
+        queue.clear();
+        CHECK(think(queue, 2.0f).empty());
+    }
+}
+
+int main()
+{
+    testEventsFireInDueOrder();
+    testCancelByHandle();
+    testCancelByObject();
+    testCancelByFixedParam();
+    testEventsAddedByHandlerWaitForNextThink();
+    testForEachSkipsCancelled();
+    testCompactionKeepsLiveEvents();
+    testClear();
+    return Tests::result();
+}